@@ -28,9 +28,13 @@
 #endif
 #include "Public/Systems/Config/PlatformConfig.h"
 #include "Public/Exchanges/Bybit/Bybitwebsocketmanager.h"
+#include "Public/Exchanges/Bybit/WebSocketIoService.h"
 #include "Public/Exchanges/Bybit/BybitSpot.h"
 #include "Public/Exchanges/Bybit/BybitMargin.h"
 #include "Public/Exchanges/Bybit/LiquidationCalculator.h"
+#include "Public/Exchanges/Bybit/BybitOrderGateway.h"
+#include "Public/Systems/WorkStealingExecutor.h"
+#include "Public/Systems/SelfCheck.h"
 using namespace Bybit;
 
 
@@ -38,7 +42,13 @@ void printSeparator() {
     std::cout << "\n" << std::string(60, '=') << "\n\n";
 }
 
-int main() {
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "--self-check") {
+        int code = SelfCheck::run();
+        WorkStealingExecutor::getInstance().shutdown();
+        return code;
+    }
+
     std::cout << std::fixed << std::setprecision(2);
 
     Config::getInstance();
@@ -107,7 +117,10 @@ int main() {
         glfwSwapBuffers(window);
     }
 
+    Bybit::BybitOrderGateway::getInstance().shutdown();
     BybitWebSocketManager::getInstance().shutdown();
+    WebSocketIoService::getInstance().shutdown();
+    WorkStealingExecutor::getInstance().shutdown();
 
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
@@ -0,0 +1,113 @@
+#include "../../Public/Blueprints/BacktestSession.h"
+#include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/Chart/CandleChart.h"
+#include "../../Public/Chart/CandleChartManager.h"
+#include "../../Public/Chart/MappedCandleSeries.h"
+#include <iostream>
+
+BacktestSession::BacktestSession(CandlestickDataManager* dataManager)
+    : dataManager(dataManager) {
+}
+
+bool BacktestSession::start(const std::string& path) {
+    end();
+
+    if (dataManager->GetChart()) dataManager->GetChart()->clearAllTradingElements();
+    dataManager->GetBlueprintManager()->clearAllBeforeLoad();
+    if (!dataManager->GetBlueprintManager()->loadBlueprint(path)) {
+        std::cout << "[BacktestSession] Failed to load " << path << std::endl;
+        return false;
+    }
+
+    dataManager->beginIndicatorBatch();
+    if (dataManager->hasMappedSeries())
+    {
+        MappedCandleSeries* series = dataManager->getMappedSeries();
+        series->adviseSequential();
+        for (size_t i = 0; i < series->size(); ++i)
+        {
+            dataManager->setMappedVisibleCount(i + 1);
+            dataManager->GetBlueprintManager()->executeFromEntry();
+        }
+        mapped = true;
+        processed = series->size();
+    }
+    else
+    {
+        std::vector<MarketData>* data = dataManager->getPublicDataPtr();
+        const std::vector<MarketData>& source = dataManager->getData();
+        size_t closed = closedCount();
+        data->clear();
+        for (size_t i = 0; i < closed; ++i)
+        {
+            data->push_back(source[i]);
+            dataManager->GetBlueprintManager()->executeFromEntry();
+        }
+        mapped = false;
+        processed = closed;
+    }
+    // Resumed candles run past the end of the batch; the indicator nodes fall back to
+    // the per-candle path and the indicator cache there.
+    dataManager->endIndicatorBatch();
+
+    blueprintPath = path;
+    lastTimestamp = processed > 0 && !mapped ? dataManager->getData()[processed - 1].timestamp : 0;
+    active = true;
+
+    std::cout << "[BacktestSession] Evaluated " << processed << " candles" << std::endl;
+    return true;
+}
+
+size_t BacktestSession::resume() {
+    if (!active || mapped) return 0;
+
+    if (!isPrefixIntact()) {
+        std::cout << "[BacktestSession] Evaluated candles changed, run the backtest again" << std::endl;
+        end();
+        return 0;
+    }
+
+    const std::vector<MarketData>& source = dataManager->getData();
+    size_t first = processed;
+    size_t closed = closedCount();
+    if (closed <= first) return 0;
+
+    // addCandle() also appends to the public series while no strategy runs live; drop
+    // those so every candle is evaluated with exactly the history before it.
+    std::vector<MarketData>* data = dataManager->getPublicDataPtr();
+    data->resize(first);
+
+    for (size_t i = first; i < closed; ++i)
+    {
+        data->push_back(source[i]);
+        dataManager->GetBlueprintManager()->executeFromEntry();
+    }
+
+    processed = closed;
+    lastTimestamp = source[closed - 1].timestamp;
+    return closed - first;
+}
+
+void BacktestSession::end() {
+    active = false;
+    mapped = false;
+    processed = 0;
+    lastTimestamp = 0;
+}
+
+size_t BacktestSession::getPendingCount() const {
+    if (!active || mapped) return 0;
+    size_t closed = closedCount();
+    return closed > processed ? closed - processed : 0;
+}
+
+size_t BacktestSession::closedCount() const {
+    size_t size = dataManager->getData().size();
+    return size > 0 ? size - 1 : 0;
+}
+
+bool BacktestSession::isPrefixIntact() const {
+    const std::vector<MarketData>& source = dataManager->getData();
+    if (source.size() < processed || dataManager->getPublicData().size() < processed) return false;
+    return processed == 0 || source[processed - 1].timestamp == lastTimestamp;
+}
@@ -0,0 +1,500 @@
+#include "../../Public/Blueprints/BlueprintBinary.h"
+#include <unordered_map>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+
+static const char BLUEPRINT_MAGIC[4] = { 'D', 'X', 'B', 'P' };
+
+namespace {
+
+// Scalar variable types, same values as PinType.
+enum : uint8_t {
+    TYPE_INT = 1,
+    TYPE_FLOAT = 2,
+    TYPE_DOUBLE = 3,
+    TYPE_BOOL = 4,
+    TYPE_STRING = 5
+};
+
+// Smallest encoded size of each record, as written by BlueprintBinary::write.
+constexpr size_t STRING_MIN_SIZE = 4;
+constexpr size_t VARIABLE_SIZE = 32;
+constexpr size_t NODE_MIN_SIZE = 36;
+constexpr size_t PIN_SIZE = 30;
+constexpr size_t CONNECTION_SIZE = 8;
+
+class StringInterner {
+public:
+    explicit StringInterner(std::vector<std::string>& strings) : table(strings) {
+        table.clear();
+        intern("");
+    }
+
+    uint32_t intern(const std::string& value) {
+        auto it = lookup.find(value);
+        if (it != lookup.end()) return it->second;
+        uint32_t index = (uint32_t)table.size();
+        table.push_back(value);
+        lookup.emplace(value, index);
+        return index;
+    }
+
+private:
+    std::vector<std::string>& table;
+    std::unordered_map<std::string, uint32_t> lookup;
+};
+
+class Writer {
+public:
+    explicit Writer(std::vector<uint8_t>& out) : buffer(out) {}
+
+    template<typename T>
+    void put(T value) {
+        size_t offset = buffer.size();
+        buffer.resize(offset + sizeof(T));
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    void putBytes(const void* data, size_t size) {
+        if (size == 0) return;
+        size_t offset = buffer.size();
+        buffer.resize(offset + size);
+        std::memcpy(buffer.data() + offset, data, size);
+    }
+
+private:
+    std::vector<uint8_t>& buffer;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : cursor(data), end(data + size) {}
+
+    template<typename T>
+    bool get(T& value) {
+        if ((size_t)(end - cursor) < sizeof(T)) return false;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    bool getBytes(size_t size, const uint8_t*& data) {
+        if ((size_t)(end - cursor) < size) return false;
+        data = cursor;
+        cursor += size;
+        return true;
+    }
+
+    // A count read from the file is only trusted if that many records can still follow.
+    bool fits(uint32_t count, size_t recordSize) const {
+        return count <= (size_t)(end - cursor) / recordSize;
+    }
+
+private:
+    const uint8_t* cursor;
+    const uint8_t* end;
+};
+
+template<typename T>
+T jsonValue(const nlohmann::json& obj, const char* key, T fallback) {
+    auto it = obj.find(key);
+    if (it == obj.end() || it->is_null()) return fallback;
+    return it->get<T>();
+}
+
+}
+
+bool BlueprintBinary::isBinary(const uint8_t* data, size_t size) {
+    return size >= sizeof(BLUEPRINT_MAGIC) && std::memcmp(data, BLUEPRINT_MAGIC, sizeof(BLUEPRINT_MAGIC)) == 0;
+}
+
+bool BlueprintBinary::fromJson(const nlohmann::json& blueprint, Graph& graph) {
+    graph = Graph();
+    StringInterner strings(graph.strings);
+
+    try {
+        if (blueprint.contains("variables")) {
+            for (const auto& var_json : blueprint["variables"]) {
+                VariableRecord var;
+                var.guid = strings.intern(var_json["guid"].get<std::string>());
+                var.name = strings.intern(var_json["name"].get<std::string>());
+                var.type = (uint8_t)var_json["type"].get<int>();
+                var.global = var_json["global"].get<bool>() ? 1 : 0;
+
+                auto value = var_json.find("value");
+                if (value != var_json.end() && !value->is_null()) {
+                    var.hasValue = 1;
+                    switch (var.type) {
+                    case TYPE_INT: var.intValue = value->get<int32_t>(); break;
+                    case TYPE_FLOAT: var.floatValue = value->get<float>(); break;
+                    case TYPE_DOUBLE: var.doubleValue = value->get<double>(); break;
+                    case TYPE_BOOL: var.boolValue = value->get<bool>() ? 1 : 0; break;
+                    case TYPE_STRING: var.stringValue = strings.intern(value->get<std::string>()); break;
+                    default: var.hasValue = 0; break;
+                    }
+                }
+                graph.variables.push_back(var);
+            }
+        }
+
+        std::unordered_map<std::string, uint32_t> pinIndex;
+
+        if (blueprint.contains("nodes")) {
+            graph.nodes.reserve(blueprint["nodes"].size());
+            for (const auto& node_json : blueprint["nodes"]) {
+                NodeRecord node;
+                node.guid = strings.intern(node_json["guid"].get<std::string>());
+                node.type = strings.intern(node_json["type"].get<std::string>());
+                node.name = strings.intern(jsonValue<std::string>(node_json, "name", ""));
+                node.x = node_json["position"]["x"].get<float>();
+                node.y = node_json["position"]["y"].get<float>();
+                if (node_json.contains("size")) {
+                    node.width = node_json["size"]["x"].get<float>();
+                    node.height = node_json["size"]["y"].get<float>();
+                }
+                if (node_json.contains("data") && !node_json["data"].is_null()) {
+                    node.data = nlohmann::json::to_cbor(node_json["data"]);
+                }
+
+                node.firstPin = (uint32_t)graph.pins.size();
+
+                if (node_json.contains("inputs")) {
+                    for (const auto& pin_json : node_json["inputs"]) {
+                        PinRecord pin;
+                        std::string guid = pin_json["guid"].get<std::string>();
+                        pin.guid = strings.intern(guid);
+                        pin.type = (uint8_t)jsonValue<int>(pin_json, "type", 0);
+                        pin.name = strings.intern(jsonValue<std::string>(pin_json, "name", ""));
+                        pin.storedInt = jsonValue<int32_t>(pin_json, "stored_int", 0);
+                        pin.storedFloat = jsonValue<float>(pin_json, "stored_float", 0.0f);
+                        pin.storedDouble = jsonValue<double>(pin_json, "stored_double", 0.0);
+                        pin.storedBool = jsonValue<bool>(pin_json, "stored_bool", false) ? 1 : 0;
+                        pin.storedString = strings.intern(jsonValue<std::string>(pin_json, "stored_string", ""));
+                        pinIndex[guid] = (uint32_t)graph.pins.size();
+                        graph.pins.push_back(pin);
+                        ++node.inputCount;
+                    }
+                }
+
+                if (node_json.contains("outputs")) {
+                    for (const auto& pin_json : node_json["outputs"]) {
+                        PinRecord pin;
+                        std::string guid = pin_json["guid"].get<std::string>();
+                        pin.guid = strings.intern(guid);
+                        pin.type = (uint8_t)jsonValue<int>(pin_json, "type", 0);
+                        pin.name = strings.intern(jsonValue<std::string>(pin_json, "name", ""));
+                        pinIndex[guid] = (uint32_t)graph.pins.size();
+                        graph.pins.push_back(pin);
+                        ++node.outputCount;
+                    }
+                }
+
+                graph.nodes.push_back(std::move(node));
+            }
+        }
+
+        if (blueprint.contains("connections")) {
+            for (const auto& conn_json : blueprint["connections"]) {
+                auto from = pinIndex.find(conn_json["from_pin"].get<std::string>());
+                auto to = pinIndex.find(conn_json["to_pin"].get<std::string>());
+                if (from == pinIndex.end() || to == pinIndex.end()) continue;
+
+                ConnectionRecord conn;
+                conn.fromPin = from->second;
+                conn.toPin = to->second;
+                graph.connections.push_back(conn);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cout << "[BlueprintBinary] Invalid blueprint JSON: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void BlueprintBinary::toJson(const Graph& graph, nlohmann::json& blueprint) {
+    blueprint = nlohmann::json::object();
+
+    blueprint["nodes"] = nlohmann::json::array();
+    for (const auto& node : graph.nodes) {
+        nlohmann::json node_json;
+        node_json["guid"] = graph.str(node.guid);
+        node_json["type"] = graph.str(node.type);
+        node_json["name"] = graph.str(node.name);
+        node_json["position"]["x"] = node.x;
+        node_json["position"]["y"] = node.y;
+        node_json["size"]["x"] = node.width;
+        node_json["size"]["y"] = node.height;
+        node_json["data"] = node.data.empty() ? nlohmann::json() : nlohmann::json::from_cbor(node.data);
+
+        node_json["inputs"] = nlohmann::json::array();
+        for (uint32_t i = 0; i < node.inputCount; ++i) {
+            const PinRecord& pin = graph.pins[node.firstPin + i];
+            nlohmann::json pin_json;
+            pin_json["guid"] = graph.str(pin.guid);
+            pin_json["type"] = (int)pin.type;
+            pin_json["name"] = graph.str(pin.name);
+            pin_json["stored_int"] = pin.storedInt;
+            pin_json["stored_float"] = pin.storedFloat;
+            pin_json["stored_double"] = pin.storedDouble;
+            pin_json["stored_bool"] = pin.storedBool != 0;
+            pin_json["stored_string"] = graph.str(pin.storedString);
+            node_json["inputs"].push_back(pin_json);
+        }
+
+        node_json["outputs"] = nlohmann::json::array();
+        for (uint32_t i = 0; i < node.outputCount; ++i) {
+            const PinRecord& pin = graph.pins[node.firstPin + node.inputCount + i];
+            nlohmann::json pin_json;
+            pin_json["guid"] = graph.str(pin.guid);
+            pin_json["type"] = (int)pin.type;
+            pin_json["name"] = graph.str(pin.name);
+            node_json["outputs"].push_back(pin_json);
+        }
+
+        blueprint["nodes"].push_back(node_json);
+    }
+
+    blueprint["connections"] = nlohmann::json::array();
+    for (const auto& conn : graph.connections) {
+        nlohmann::json conn_json;
+        conn_json["from_pin"] = graph.str(graph.pins[conn.fromPin].guid);
+        conn_json["to_pin"] = graph.str(graph.pins[conn.toPin].guid);
+        blueprint["connections"].push_back(conn_json);
+    }
+
+    blueprint["variables"] = nlohmann::json::array();
+    for (const auto& var : graph.variables) {
+        nlohmann::json var_json;
+        var_json["guid"] = graph.str(var.guid);
+        var_json["name"] = graph.str(var.name);
+        var_json["type"] = (int)var.type;
+        var_json["global"] = var.global != 0;
+
+        if (var.hasValue) {
+            switch (var.type) {
+            case TYPE_INT: var_json["value"] = var.intValue; break;
+            case TYPE_FLOAT: var_json["value"] = var.floatValue; break;
+            case TYPE_DOUBLE: var_json["value"] = var.doubleValue; break;
+            case TYPE_BOOL: var_json["value"] = var.boolValue != 0; break;
+            case TYPE_STRING: var_json["value"] = graph.str(var.stringValue); break;
+            }
+        }
+        blueprint["variables"].push_back(var_json);
+    }
+}
+
+void BlueprintBinary::write(const Graph& graph, std::vector<uint8_t>& out) {
+    out.clear();
+    Writer w(out);
+
+    w.putBytes(BLUEPRINT_MAGIC, sizeof(BLUEPRINT_MAGIC));
+    w.put<uint16_t>(VERSION);
+    w.put<uint16_t>(0);
+    w.put<uint32_t>((uint32_t)graph.strings.size());
+    w.put<uint32_t>((uint32_t)graph.variables.size());
+    w.put<uint32_t>((uint32_t)graph.nodes.size());
+    w.put<uint32_t>((uint32_t)graph.pins.size());
+    w.put<uint32_t>((uint32_t)graph.connections.size());
+
+    for (const auto& s : graph.strings) {
+        w.put<uint32_t>((uint32_t)s.size());
+        w.putBytes(s.data(), s.size());
+    }
+
+    for (const auto& var : graph.variables) {
+        w.put(var.guid);
+        w.put(var.name);
+        w.put(var.type);
+        w.put(var.global);
+        w.put(var.hasValue);
+        w.put(var.intValue);
+        w.put(var.floatValue);
+        w.put(var.doubleValue);
+        w.put(var.boolValue);
+        w.put(var.stringValue);
+    }
+
+    for (const auto& node : graph.nodes) {
+        w.put(node.guid);
+        w.put(node.type);
+        w.put(node.name);
+        w.put(node.x);
+        w.put(node.y);
+        w.put(node.width);
+        w.put(node.height);
+        w.put<uint32_t>((uint32_t)node.data.size());
+        w.putBytes(node.data.data(), node.data.size());
+        w.put(node.inputCount);
+        w.put(node.outputCount);
+    }
+
+    for (const auto& pin : graph.pins) {
+        w.put(pin.guid);
+        w.put(pin.type);
+        w.put(pin.name);
+        w.put(pin.storedInt);
+        w.put(pin.storedFloat);
+        w.put(pin.storedDouble);
+        w.put(pin.storedBool);
+        w.put(pin.storedString);
+    }
+
+    for (const auto& conn : graph.connections) {
+        w.put(conn.fromPin);
+        w.put(conn.toPin);
+    }
+}
+
+bool BlueprintBinary::read(const uint8_t* data, size_t size, Graph& graph) {
+    graph = Graph();
+    if (!isBinary(data, size)) return false;
+
+    Reader r(data + sizeof(BLUEPRINT_MAGIC), size - sizeof(BLUEPRINT_MAGIC));
+
+    uint16_t version = 0, flags = 0;
+    uint32_t stringCount = 0, variableCount = 0, nodeCount = 0, pinCount = 0, connectionCount = 0;
+    if (!r.get(version) || !r.get(flags) || !r.get(stringCount) || !r.get(variableCount) ||
+        !r.get(nodeCount) || !r.get(pinCount) || !r.get(connectionCount)) {
+        return false;
+    }
+    if (version > VERSION) {
+        std::cout << "[BlueprintBinary] Unsupported version " << version << std::endl;
+        return false;
+    }
+
+    if (!r.fits(stringCount, STRING_MIN_SIZE)) return false;
+    graph.strings.resize(stringCount);
+    for (auto& s : graph.strings) {
+        uint32_t length = 0;
+        const uint8_t* bytes = nullptr;
+        if (!r.get(length) || !r.getBytes(length, bytes)) return false;
+        s.assign((const char*)bytes, length);
+    }
+
+    auto validString = [stringCount](uint32_t index) { return index < stringCount; };
+
+    if (!r.fits(variableCount, VARIABLE_SIZE)) return false;
+    graph.variables.resize(variableCount);
+    for (auto& var : graph.variables) {
+        if (!r.get(var.guid) || !r.get(var.name) || !r.get(var.type) || !r.get(var.global) ||
+            !r.get(var.hasValue) || !r.get(var.intValue) || !r.get(var.floatValue) ||
+            !r.get(var.doubleValue) || !r.get(var.boolValue) || !r.get(var.stringValue)) {
+            return false;
+        }
+        if (!validString(var.guid) || !validString(var.name) || !validString(var.stringValue)) return false;
+    }
+
+    if (!r.fits(nodeCount, NODE_MIN_SIZE)) return false;
+    graph.nodes.resize(nodeCount);
+    uint32_t nextPin = 0;
+    for (auto& node : graph.nodes) {
+        uint32_t dataLength = 0;
+        const uint8_t* bytes = nullptr;
+        if (!r.get(node.guid) || !r.get(node.type) || !r.get(node.name) ||
+            !r.get(node.x) || !r.get(node.y) || !r.get(node.width) || !r.get(node.height) ||
+            !r.get(dataLength) || !r.getBytes(dataLength, bytes) ||
+            !r.get(node.inputCount) || !r.get(node.outputCount)) {
+            return false;
+        }
+        if (!validString(node.guid) || !validString(node.type) || !validString(node.name)) return false;
+
+        node.data.assign(bytes, bytes + dataLength);
+        node.firstPin = nextPin;
+        nextPin += node.inputCount + node.outputCount;
+    }
+    if (nextPin != pinCount) return false;
+
+    if (!r.fits(pinCount, PIN_SIZE)) return false;
+    graph.pins.resize(pinCount);
+    for (auto& pin : graph.pins) {
+        if (!r.get(pin.guid) || !r.get(pin.type) || !r.get(pin.name) || !r.get(pin.storedInt) ||
+            !r.get(pin.storedFloat) || !r.get(pin.storedDouble) || !r.get(pin.storedBool) ||
+            !r.get(pin.storedString)) {
+            return false;
+        }
+        if (!validString(pin.guid) || !validString(pin.name) || !validString(pin.storedString)) return false;
+    }
+
+    if (!r.fits(connectionCount, CONNECTION_SIZE)) return false;
+    graph.connections.resize(connectionCount);
+    for (auto& conn : graph.connections) {
+        if (!r.get(conn.fromPin) || !r.get(conn.toPin)) return false;
+        if (conn.fromPin >= pinCount || conn.toPin >= pinCount) return false;
+    }
+
+    return true;
+}
+
+bool BlueprintBinary::jsonToBinary(const nlohmann::json& blueprint, std::vector<uint8_t>& out) {
+    Graph graph;
+    if (!fromJson(blueprint, graph)) return false;
+    write(graph, out);
+    return true;
+}
+
+bool BlueprintBinary::binaryToJson(const uint8_t* data, size_t size, nlohmann::json& blueprint) {
+    Graph graph;
+    if (!read(data, size, graph)) return false;
+    try {
+        toJson(graph, blueprint);
+    }
+    catch (const std::exception& e) {
+        std::cout << "[BlueprintBinary] Failed to decode node data: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool BlueprintBinary::readFile(const std::string& filename, std::vector<uint8_t>& out) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+
+    std::streamsize size = file.tellg();
+    if (size < 0) return false;
+    file.seekg(0, std::ios::beg);
+
+    out.resize((size_t)size);
+    return size == 0 || (bool)file.read((char*)out.data(), size);
+}
+
+bool BlueprintBinary::writeFile(const std::string& filename, const std::vector<uint8_t>& data) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write((const char*)data.data(), (std::streamsize)data.size());
+    return (bool)file;
+}
+
+bool BlueprintBinary::convertFile(const std::string& inputPath, const std::string& outputPath) {
+    std::vector<uint8_t> input;
+    if (!readFile(inputPath, input)) {
+        std::cout << "[BlueprintBinary] Failed to open file: " << inputPath << std::endl;
+        return false;
+    }
+
+    if (isBinary(input.data(), input.size())) {
+        nlohmann::json blueprint;
+        if (!binaryToJson(input.data(), input.size(), blueprint)) return false;
+
+        std::ofstream file(outputPath);
+        if (!file.is_open()) return false;
+        file << blueprint.dump(4);
+        return (bool)file;
+    }
+
+    nlohmann::json blueprint;
+    try {
+        blueprint = nlohmann::json::parse(input.begin(), input.end());
+    }
+    catch (const std::exception& e) {
+        std::cout << "[BlueprintBinary] JSON parsing error: " << e.what() << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> output;
+    if (!jsonToBinary(blueprint, output)) return false;
+    return writeFile(outputPath, output);
+}
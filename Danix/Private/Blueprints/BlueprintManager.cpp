@@ -1,5 +1,8 @@
 #include "../../Public/Blueprints/Node/Nodes/Nodes.h"
 #include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/Blueprints/Node/NodeRegistry.h"
+#include "../../Public/Blueprints/BlueprintBinary.h"
+#include "../../Public/Blueprints/StrategyTemplate.h"
 #include "../../Public/Systems/GuidGenerator.h"
 #include "../../Public/GUI/Color.h"
 #include "../../Public/Chart/CandleChartManager.h"
@@ -97,21 +100,74 @@ BasicNode* BlueprintManager::getNodeByGuid(const std::string& guid) {
     return (it != nodes.end()) ? it->second.get() : nullptr;
 }
 
+static bool ownsPin(BasicNode* node, const Pin* pin) {
+    for (auto& input : node->inputs) {
+        if (input.get() == pin) return true;
+    }
+    for (auto& output : node->outputs) {
+        if (output.get() == pin) return true;
+    }
+    return false;
+}
+
 Pin* BlueprintManager::getPinByGuid(const std::string& guid) {
+    auto found = pin_index.find(guid);
+    if (found != pin_index.end()) {
+        // The pin is only touched once its node is known to still own it.
+        BasicNode* node = getNodeByGuid(found->second.node_guid);
+        if (node && ownsPin(node, found->second.pin) && found->second.pin->pin_guid == guid) {
+            return found->second.pin;
+        }
+        pin_index.erase(found);
+    }
+
+    // Pin GUIDs are normally indexed in addNode; fall back to a scan for pins renamed afterwards.
     for (auto it = nodes.begin(); it != nodes.end(); ++it) {
         BasicNode* node = it->second.get();
         for (auto& pin : node->inputs) {
-            if (pin->pin_guid == guid) return pin.get();
+            if (pin->pin_guid == guid) {
+                pin_index[guid] = PinRef{ it->first, pin.get() };
+                return pin.get();
+            }
         }
         for (auto& pin : node->outputs) {
-            if (pin->pin_guid == guid) return pin.get();
+            if (pin->pin_guid == guid) {
+                pin_index[guid] = PinRef{ it->first, pin.get() };
+                return pin.get();
+            }
         }
     }
     return nullptr;
 }
 
+void BlueprintManager::indexNodePins(BasicNode* node) {
+    for (auto& pin : node->inputs) {
+        if (!pin->owner) pin->owner = node;
+        pin_index[pin->pin_guid] = PinRef{ node->node_guid, pin.get() };
+    }
+    for (auto& pin : node->outputs) {
+        if (!pin->owner) pin->owner = node;
+        pin_index[pin->pin_guid] = PinRef{ node->node_guid, pin.get() };
+    }
+}
+
+void BlueprintManager::unindexNodePins(BasicNode* node) {
+    for (auto& pin : node->inputs) {
+        auto it = pin_index.find(pin->pin_guid);
+        if (it != pin_index.end() && it->second.pin == pin.get()) pin_index.erase(it);
+    }
+    for (auto& pin : node->outputs) {
+        auto it = pin_index.find(pin->pin_guid);
+        if (it != pin_index.end() && it->second.pin == pin.get()) pin_index.erase(it);
+    }
+}
+
 void BlueprintManager::addNode(std::unique_ptr<BasicNode> node) {
     std::string guid = node->node_guid;
+    auto existing = nodes.find(guid);
+    if (existing != nodes.end()) unindexNodePins(existing->second.get());
+
+    indexNodePins(node.get());
     nodes[guid] = std::move(node);
 }
 
@@ -130,18 +186,7 @@ void BlueprintManager::createConnection(PinOut* from_pin, PinIn* to_pin) {
             removeConnectionsToInput(to_pin);
         }
 
-        Connection conn;
-        conn.from_pin_guid = from_pin->pin_guid;
-        conn.to_pin_guid = to_pin->pin_guid;
-        conn.from_pin = from_pin;
-        conn.to_pin = to_pin;
-
-        connections.push_back(conn);
-
-        from_pin->connected_pins.push_back(to_pin);
-        from_pin->connected_pin_guids.push_back(to_pin->pin_guid);
-        to_pin->linked_to = from_pin;
-        to_pin->linked_to_guid = from_pin->pin_guid;
+        linkPins(from_pin, to_pin);
         return;
     }
 
@@ -187,6 +232,21 @@ void BlueprintManager::createConnection(PinOut* from_pin, PinIn* to_pin) {
     }
 }
 
+void BlueprintManager::linkPins(PinOut* from_pin, PinIn* to_pin) {
+    Connection conn;
+    conn.from_pin_guid = from_pin->pin_guid;
+    conn.to_pin_guid = to_pin->pin_guid;
+    conn.from_pin = from_pin;
+    conn.to_pin = to_pin;
+
+    connections.push_back(conn);
+
+    from_pin->connected_pins.push_back(to_pin);
+    from_pin->connected_pin_guids.push_back(to_pin->pin_guid);
+    to_pin->linked_to = from_pin;
+    to_pin->linked_to_guid = from_pin->pin_guid;
+}
+
 void BlueprintManager::removeConnectionsToInput(PinIn* to_pin) {
     for (auto it = connections.begin(); it != connections.end();) {
         if (it->to_pin == to_pin) {
@@ -409,7 +469,7 @@ void BlueprintManager::drawLeftSidebar() {
                 case PinType::DOUBLE: {
                     double tempDouble = (double)constNode->doubleValue;
                     if (ImGui::InputDouble("##constval", &tempDouble)) {
-                        constNode->doubleValue = (long double)tempDouble;
+                        constNode->doubleValue = (Real)tempDouble;
                     }
                     break;
                 }
@@ -529,9 +589,9 @@ void BlueprintManager::drawLeftSidebar() {
                         break;
                     }
                     case PinType::DOUBLE: {
-                        double val = (double)pin->getDefaultValue<long double>();
+                        double val = (double)pin->getDefaultValue<Real>();
                         if (ImGui::InputDouble("##pinval", &val)) {
-                            pin->default_stored_double = (long double)val;
+                            pin->default_stored_double = (Real)val;
                         }
                         break;
                     }
@@ -700,7 +760,7 @@ void BlueprintManager::drawLeftSidebar() {
                 variable->def_floatValue = defaultFloat;
                 break;
             case PinType::DOUBLE:
-                variable->def_doubleValue = (long double)defaultDouble;
+                variable->def_doubleValue = (Real)defaultDouble;
                 break;
             case PinType::BOOL:
                 variable->def_boolValue = defaultBool;
@@ -873,7 +933,7 @@ void BlueprintManager::drawLeftSidebar() {
             case PinType::DOUBLE: {
                 double tempDouble = (double)var->def_doubleValue;
                 if (ImGui::InputDouble("##editval", &tempDouble)) {
-                    var->def_doubleValue = (long double)tempDouble;
+                    var->def_doubleValue = (Real)tempDouble;
                 }
                 break;
             }
@@ -1091,393 +1151,10 @@ void BlueprintManager::createNodeFromMenu(const std::string& node_type, ImVec2 w
     std::unique_ptr<BasicNode> node = nullptr;
 
     if (node_type == "Entry") {
-        node = std::make_unique<EntryNode>("Entry");
-    }
-
-    if (node_type == "BybiyMarginLong") {
-        node = std::make_unique<BybiyMarginLongNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BybiyMarginShort") {
-        node = std::make_unique<BybiyMarginShortNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BybiyMarginCloseLongPosition") {
-        node = std::make_unique<BybiyMarginCloseLongPositionNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BybiyMarginCloseShortPosition") {
-        node = std::make_unique<BybiyMarginCloseShortPositionNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "AddMark") {
-        node = std::make_unique<EntryNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "AddLine") {
-        node = std::make_unique<EntryNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetCurrentCandleDataIndex") {
-        node = std::make_unique<GetCurrentCandleDataNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetCandleDataAtIndex") {
-        node = std::make_unique<GetCandleDataAtIndexNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetCurrentCandleIndex") {
-        node = std::make_unique<GetCurrentCandleIndexNode>(GUIDGenerator::generate());
-    }
-    if (node_type == "EngulfingPattern") {
-        node = std::make_unique<EngulfingPatternNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "CenterOfGravity") {
-        node = std::make_unique<CenterOfGravityNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "HammerPattern") {
-        node = std::make_unique<HammerPatternNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DojiPattern") {
-        node = std::make_unique<DojiPatternNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "Lowest") {
-        node = std::make_unique<LowestNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "Highest") {
-        node = std::make_unique<HighestNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "VWAP") {
-        node = std::make_unique<VWAPNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "MFI") {
-        node = std::make_unique<MFINode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "WilliamsR") {
-        node = std::make_unique<WilliamsRNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "CCI") {
-        node = std::make_unique<CCINode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ATR") {
-        node = std::make_unique<ATRNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "Stochastic") {
-        node = std::make_unique<StochasticNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BollingerBands") {
-        node = std::make_unique<BollingerBandsNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "MACD") {
-        node = std::make_unique<MACDNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "RSI") {
-        node = std::make_unique<RSINode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "EMA") {
-        node = std::make_unique<EMANode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "SMA") {
-        node = std::make_unique<SMANode>(GUIDGenerator::generate());
-    }
-
-
-
-
-    if (node_type == "IntNotEqual") {
-        node = std::make_unique<IntNotEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntEqual") {
-        node = std::make_unique<IntEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntLessThan") {
-        node = std::make_unique<IntLessThanNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntMoreThan" || node_type == "IntMore") {
-        node = std::make_unique<IntMoreThanNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "DoubleNotEqual") {
-        node = std::make_unique<DoubleNotEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleEqual") {
-        node = std::make_unique<DoubleEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleLessThan") {
-        node = std::make_unique<DoubleLessThanNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleMoreThan" || node_type == "DoubleMore") {
-        node = std::make_unique<DoubleMoreThanNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "FloatNotEqual") {
-        node = std::make_unique<FloatNotEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatEqual") {
-        node = std::make_unique<FloatEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatLessThan") {
-        node = std::make_unique<FloatLessThanNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatMoreThan" || node_type == "FloatMore") {
-        node = std::make_unique<FloatMoreThanNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "BoolAnd") {
-        node = std::make_unique<BoolAndNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BoolOr") {
-        node = std::make_unique<BoolOrNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BoolEqual") {
-        node = std::make_unique<BoolEqualNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "BoolNotEqual") {
-        node = std::make_unique<BoolNotEqualNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "IntToFloat") {
-        node = std::make_unique<IntToFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntToDouble") {
-        node = std::make_unique<IntToDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntToText") {
-        node = std::make_unique<IntToTextNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "DoubleToFloat") {
-        node = std::make_unique<DoubleToFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleToInt") {
-        node = std::make_unique<DoubleToIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleToText") {
-        node = std::make_unique<DoubleToTextNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "FloatToDouble") {
-        node = std::make_unique<FloatToDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatToInt") {
-        node = std::make_unique<FloatToIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatToText") {
-        node = std::make_unique<FloatToTextNode>(GUIDGenerator::generate());
-    }
-
-    else if (node_type == "BoolToText") {
-        node = std::make_unique<BoolToTextNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "GetIntArrayElement") {
-        node = std::make_unique<GetIntArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "AddIntArrayElement") {
-        node = std::make_unique<AddIntArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "SizeIntArrayElement") {
-        node = std::make_unique<SizeIntArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ClearIntArrayElement") {
-        node = std::make_unique<ClearIntArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "RemoveIntArrayElement") {
-        node = std::make_unique<RemoveIntArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetFloatArrayElement") {
-        node = std::make_unique<GetFloatArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "AddFloatArrayElement") {
-        node = std::make_unique<AddFloatArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "SizeFloatArrayElement") {
-        node = std::make_unique<SizeFloatArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ClearFloatArrayElement") {
-        node = std::make_unique<ClearFloatArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "RemoveFloatArrayElement") {
-        node = std::make_unique<RemoveFloatArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetDoubleArrayElement") {
-        node = std::make_unique<GetDoubleArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "AddDoubleArrayElement") {
-        node = std::make_unique<AddDoubleArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "SizeDoubleArrayElement") {
-        node = std::make_unique<SizeDoubleArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ClearDoubleArrayElement") {
-        node = std::make_unique<ClearDoubleArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "RemoveDoubleArrayElement") {
-        node = std::make_unique<RemoveDoubleArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetBoolArrayElement") {
-        node = std::make_unique<GetBoolArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "AddBoolArrayElement") {
-        node = std::make_unique<AddBoolArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "SizeBoolArrayElement") {
-        node = std::make_unique<SizeBoolArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ClearBoolArrayElement") {
-        node = std::make_unique<ClearBoolArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "RemoveBoolArrayElement") {
-        node = std::make_unique<RemoveBoolArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "GetStringArrayElement") {
-        node = std::make_unique<GetStringArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "AddStringArrayElement") {
-        node = std::make_unique<AddStringArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "SizeStringArrayElement") {
-        node = std::make_unique<SizeStringArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ClearStringArrayElement") {
-        node = std::make_unique<ClearStringArrayElementNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "RemoveStringArrayElement") {
-        node = std::make_unique<RemoveStringArrayElementNode>(GUIDGenerator::generate());
-    }
-
-    else if (node_type == "ForLoop") {
-        node = std::make_unique<ForLoopNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "ConstInt") {
-        node = std::make_unique<ConstIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ConstFloat") {
-        node = std::make_unique<ConstFloatNode>(GUIDGenerator::generate());
+        node = std::make_unique<EntryNode>("Entry", this);
     }
-    else if (node_type == "ConstDouble") {
-        node = std::make_unique<ConstDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ConstBool") {
-        node = std::make_unique<ConstBoolNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "ConstText") {
-        node = std::make_unique<ConstTextNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "IntMinusInt") {
-        node = std::make_unique<IntMinusIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntMinusFloat") {
-        node = std::make_unique<IntMinusFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntMinusDouble") {
-        node = std::make_unique<IntMinusDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntPlusInt") {
-        node = std::make_unique<IntPlusIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntPlusFloat") {
-        node = std::make_unique<IntPlusFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntPlusDouble") {
-        node = std::make_unique<IntPlusDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntMultiplyInt") {
-        node = std::make_unique<IntMultiplyIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntMultiplyFloat") {
-        node = std::make_unique<IntMultiplyFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntMultiplyDouble") {
-        node = std::make_unique<IntMultiplyDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntDivideInt") {
-        node = std::make_unique<IntDivideIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntDivideFloat") {
-        node = std::make_unique<IntDivideFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "IntDivideDouble") {
-        node = std::make_unique<IntDivideDoubleNode>(GUIDGenerator::generate());
-    }
-    
-    if (node_type == "FloatMinusInt") {
-        node = std::make_unique<FloatMinusIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatMinusFloat") {
-        node = std::make_unique<FloatMinusFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatMinusDouble") {
-        node = std::make_unique<FloatMinusDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatPlusInt") {
-        node = std::make_unique<FloatPlusIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatPlusFloat") {
-        node = std::make_unique<FloatPlusFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatPlusDouble") {
-        node = std::make_unique<FloatPlusDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatMultiplyInt") {
-        node = std::make_unique<FloatMultiplyIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatMultiplyFloat") {
-        node = std::make_unique<FloatMultiplyFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatMultiplyDouble") {
-        node = std::make_unique<FloatMultiplyDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatDivideInt") {
-        node = std::make_unique<FloatDivideIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatDivideFloat") {
-        node = std::make_unique<FloatDivideFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "FloatDivideDouble") {
-        node = std::make_unique<FloatDivideDoubleNode>(GUIDGenerator::generate());
-    }
-    
-    if (node_type == "DoubleMinusInt") {
-        node = std::make_unique<DoubleMinusIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleMinusFloat") {
-        node = std::make_unique<DoubleMinusFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleMinusDouble") {
-        node = std::make_unique<DoubleMinusDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoublePlusInt") {
-        node = std::make_unique<DoublePlusIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoublePlusFloat") {
-        node = std::make_unique<DoublePlusFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoublePlusDouble") {
-        node = std::make_unique<DoublePlusDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleMultiplyInt") {
-        node = std::make_unique<DoubleMultiplyIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleMultiplyFloat") {
-        node = std::make_unique<DoubleMultiplyFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleMultiplyDouble") {
-        node = std::make_unique<DoubleMultiplyDoubleNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleDivideInt") {
-        node = std::make_unique<DoubleDivideIntNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleDivideFloat") {
-        node = std::make_unique<DoubleDivideFloatNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "DoubleDivideDouble") {
-        node = std::make_unique<DoubleDivideDoubleNode>(GUIDGenerator::generate());
-    }
-
-    if (node_type == "Branch") {
-        node = std::make_unique<BranchNode>(GUIDGenerator::generate());
-    }
-    else if (node_type == "Sequence") {
-        node = std::make_unique<SequenceNode>(GUIDGenerator::generate());
-        }
-    else if (node_type == "PrintString") {
-        node = std::make_unique<PrintString>(GUIDGenerator::generate());
+    else {
+        node = NodeRegistry::getInstance().create(node_type, GUIDGenerator::generate(), this);
     }
 
     if (node) {
@@ -1574,6 +1251,18 @@ void BlueprintManager::drawContextMenu() {
                     addNode(std::move(node));
                     ImGui::CloseCurrentPopup();
                 }
+                if (ImGui::MenuItem("Order Book")) {
+                    auto node = std::make_unique<OrderBookTopNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
+                if (ImGui::MenuItem("Order Book Depth")) {
+                    auto node = std::make_unique<OrderBookDepthNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
                 ImGui::EndMenu();
             }
             ImGui::EndMenu();
@@ -1604,6 +1293,12 @@ void BlueprintManager::drawContextMenu() {
                 addNode(std::move(node));
                 ImGui::CloseCurrentPopup();
             }
+            if (ImGui::MenuItem("Get Timeframe Candle")) {
+                auto node = std::make_unique<GetTimeframeCandleNode>(GUIDGenerator::generate());
+                node->position = world_pos;
+                addNode(std::move(node));
+                ImGui::CloseCurrentPopup();
+            }
             if (ImGui::MenuItem("Get Current Candle Index")) {
                 auto node = std::make_unique<GetCurrentCandleIndexNode>(GUIDGenerator::generate());
                 node->position = world_pos;
@@ -1752,6 +1447,12 @@ void BlueprintManager::drawContextMenu() {
                     addNode(std::move(node));
                     ImGui::CloseCurrentPopup();
                 }
+                if (ImGui::MenuItem("Window")) {
+                    auto node = std::make_unique<WindowIntArrayElementNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
                 ImGui::EndMenu();
             }
 
@@ -1786,6 +1487,12 @@ void BlueprintManager::drawContextMenu() {
                     addNode(std::move(node));
                     ImGui::CloseCurrentPopup();
                 }
+                if (ImGui::MenuItem("Window")) {
+                    auto node = std::make_unique<WindowFloatArrayElementNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
                 ImGui::EndMenu();
             }
 
@@ -1820,6 +1527,12 @@ void BlueprintManager::drawContextMenu() {
                     addNode(std::move(node));
                     ImGui::CloseCurrentPopup();
                 }
+                if (ImGui::MenuItem("Window")) {
+                    auto node = std::make_unique<WindowDoubleArrayElementNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
                 ImGui::EndMenu();
             }
 
@@ -1854,6 +1567,12 @@ void BlueprintManager::drawContextMenu() {
                     addNode(std::move(node));
                     ImGui::CloseCurrentPopup();
                 }
+                if (ImGui::MenuItem("Window")) {
+                    auto node = std::make_unique<WindowBoolArrayElementNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
                 ImGui::EndMenu();
             }
 
@@ -1888,6 +1607,12 @@ void BlueprintManager::drawContextMenu() {
                     addNode(std::move(node));
                     ImGui::CloseCurrentPopup();
                 }
+                if (ImGui::MenuItem("Window")) {
+                    auto node = std::make_unique<WindowStringArrayElementNode>(GUIDGenerator::generate());
+                    node->position = world_pos;
+                    addNode(std::move(node));
+                    ImGui::CloseCurrentPopup();
+                }
                 ImGui::EndMenu();
             }
 
@@ -2397,28 +2122,8 @@ void BlueprintManager::drawConnections() {
         ImDrawList* draw_list = ImGui::GetWindowDrawList();
         for (const auto& conn : connections) {
             if (conn.from_pin && conn.to_pin) {
-                BasicNode* from_node = nullptr;
-                BasicNode* to_node = nullptr;
-                for (auto& node_pair : nodes) {
-                    BasicNode* node = node_pair.second.get();
-                    for (auto& pin : node->outputs) {
-                        if (pin.get() == conn.from_pin) {
-                            from_node = node;
-                            break;
-                        }
-                    }
-                    if (from_node) break;
-                }
-                for (auto& node_pair : nodes) {
-                    BasicNode* node = node_pair.second.get();
-                    for (auto& pin : node->inputs) {
-                        if (pin.get() == conn.to_pin) {
-                            to_node = node;
-                            break;
-                        }
-                    }
-                    if (to_node) break;
-                }
+                BasicNode* from_node = conn.from_pin->owner;
+                BasicNode* to_node = conn.to_pin->owner;
                 if (from_node && to_node) {
                     ImVec2 from_screen = worldToScreen(from_node->position);
                     ImVec2 to_screen = worldToScreen(to_node->position);
@@ -2753,6 +2458,9 @@ void BlueprintManager::drawConnectionContextMenu() {
                 if (ImGui::MenuItem("Remove")) {
                     createNodeFromMenu("RemoveIntArrayElement", world_pos);
                 }
+                if (ImGui::MenuItem("Window")) {
+                    createNodeFromMenu("WindowIntArrayElement", world_pos);
+                }
             }
             else if (start_type == PinType::ARRAY_FLOAT) {
                 if (ImGui::MenuItem("Get")) {
@@ -2770,6 +2478,9 @@ void BlueprintManager::drawConnectionContextMenu() {
                 if (ImGui::MenuItem("Remove")) {
                     createNodeFromMenu("RemoveFloatArrayElement", world_pos);
                 }
+                if (ImGui::MenuItem("Window")) {
+                    createNodeFromMenu("WindowFloatArrayElement", world_pos);
+                }
             }
             else if (start_type == PinType::ARRAY_DOUBLE) {
                 if (ImGui::MenuItem("Get")) {
@@ -2787,6 +2498,9 @@ void BlueprintManager::drawConnectionContextMenu() {
                 if (ImGui::MenuItem("Remove")) {
                     createNodeFromMenu("RemoveDoubleArrayElement", world_pos);
                 }
+                if (ImGui::MenuItem("Window")) {
+                    createNodeFromMenu("WindowDoubleArrayElement", world_pos);
+                }
             }
             else if (start_type == PinType::ARRAY_BOOL) {
                 if (ImGui::MenuItem("Get")) {
@@ -2804,6 +2518,9 @@ void BlueprintManager::drawConnectionContextMenu() {
                 if (ImGui::MenuItem("Remove")) {
                     createNodeFromMenu("RemoveBoolArrayElement", world_pos);
                 }
+                if (ImGui::MenuItem("Window")) {
+                    createNodeFromMenu("WindowBoolArrayElement", world_pos);
+                }
             }
             else if (start_type == PinType::ARRAY_STRING) {
                 if (ImGui::MenuItem("Get")) {
@@ -2821,6 +2538,9 @@ void BlueprintManager::drawConnectionContextMenu() {
                 if (ImGui::MenuItem("Remove")) {
                     createNodeFromMenu("RemoveStringArrayElement", world_pos);
                 }
+                if (ImGui::MenuItem("Window")) {
+                    createNodeFromMenu("WindowStringArrayElement", world_pos);
+                }
             }
             ImGui::EndMenu();
         }
@@ -3146,6 +2866,20 @@ void BlueprintManager::handleMouseClick(ImVec2 mouse_pos) {
 
 void BlueprintManager::saveBlueprint(const std::string& filename) {
     nlohmann::json json = serializeToJson();
+
+    std::string lower = filename;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    if (lower.size() >= 5 && lower.compare(lower.size() - 5, 5, ".dxbp") == 0) {
+        std::vector<uint8_t> data;
+        if (BlueprintBinary::jsonToBinary(json, data) && BlueprintBinary::writeFile(filename, data)) {
+            std::cout << "Blueprint saved to: " << filename << std::endl;
+        }
+        else {
+            std::cout << "Failed to save blueprint to: " << filename << std::endl;
+        }
+        return;
+    }
+
     std::ofstream file(filename);
     if (file.is_open()) {
         file << json.dump(4);      
@@ -3159,16 +2893,29 @@ void BlueprintManager::saveBlueprint(const std::string& filename) {
 
 bool BlueprintManager::loadBlueprint(const std::string& filename) {
     variables.clear();
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+
+    std::vector<uint8_t> data;
+    if (!BlueprintBinary::readFile(filename, data)) {
         std::cout << "Failed to open file: " << filename << std::endl;
         return false;
     }
 
+    if (BlueprintBinary::isBinary(data.data(), data.size())) {
+        clearAllBeforeLoad();
+
+        bool success = deserializeFromBinary(data.data(), data.size());
+        if (success) {
+            std::cout << "Blueprint loaded from: " << filename << std::endl;
+        }
+        else {
+            std::cout << "Failed to deserialize blueprint from: " << filename << std::endl;
+        }
+        return success;
+    }
+
     nlohmann::json json;
     try {
-        file >> json;
-        file.close();
+        json = nlohmann::json::parse(data.begin(), data.end());
 
         clearAllBeforeLoad();
 
@@ -3184,11 +2931,25 @@ bool BlueprintManager::loadBlueprint(const std::string& filename) {
     }
     catch (const std::exception& e) {
         std::cout << "JSON parsing error: " << e.what() << std::endl;
-        file.close();
         return false;
     }
 }
 
+bool BlueprintManager::serializeToBinary(std::vector<uint8_t>& out) {
+    return BlueprintBinary::jsonToBinary(serializeToJson(), out);
+}
+
+bool BlueprintManager::deserializeFromBinary(const uint8_t* data, size_t size) {
+    BlueprintBinary::Graph graph;
+    if (!BlueprintBinary::read(data, size, graph)) {
+        std::cout << "Deserialization error: invalid binary blueprint" << std::endl;
+        return false;
+    }
+
+    std::shared_ptr<const StrategyTemplate> compiled = StrategyTemplate::compileGraph(std::move(graph));
+    return compiled && compiled->instantiateInto(*this);
+}
+
 nlohmann::json BlueprintManager::serializeToJson() {
     nlohmann::json json;
 
@@ -3292,7 +3053,7 @@ bool BlueprintManager::deserializeFromJson(const nlohmann::json& json) {
                     variable->def_floatValue = var_json["value"].get<float>();
                     break;
                 case PinType::DOUBLE:
-                    variable->def_doubleValue = var_json["value"].get<long double>();
+                    variable->def_doubleValue = var_json["value"].get<Real>();
                     break;
                 case PinType::BOOL:
                     variable->def_boolValue = var_json["value"].get<bool>();
@@ -3311,346 +3072,7 @@ bool BlueprintManager::deserializeFromJson(const nlohmann::json& json) {
                 std::string type = node_json["type"];
                 std::string guid = node_json["guid"];
 
-                std::unique_ptr<BasicNode> node = nullptr;
-
-                if (type == "EntryNode") {
-                    node = std::make_unique<EntryNode>(guid, this);
-                }
-
-                else if (type == "BybiyMarginLongNode") {
-                    node = std::make_unique<BybiyMarginLongNode>(guid, this);
-                }
-                else if (type == "BybiyMarginShortNode") {
-                    node = std::make_unique<BybiyMarginShortNode>(guid, this);
-                }
-                else if (type == "BybiyMarginCloseLongPositionNode") {
-                    node = std::make_unique<BybiyMarginCloseLongPositionNode>(guid, this);
-                }
-                else if (type == "BybiyMarginCloseShortPositionNode") {
-                    node = std::make_unique<BybiyMarginCloseShortPositionNode>(guid, this);
-                }
-                else if (type == "AddMarkNode") {
-                    node = std::make_unique<AddMarkNode>(guid, this);
-                }
-                else if (type == "AddLineNode") {
-                    node = std::make_unique<AddLineNode>(guid, this);
-                }
-                else if (type == "GetCurrentCandleDataNode") {
-                    node = std::make_unique<GetCurrentCandleDataNode>(guid, this);
-                }
-                else if (type == "GetCandleDataAtIndexNode") {
-                    node = std::make_unique<GetCandleDataAtIndexNode>(guid, this);
-                }
-                else if (type == "GetCurrentCandleIndexNode") {
-                    node = std::make_unique<GetCurrentCandleIndexNode>(guid, this);
-                }
-                else if (type == "EngulfingPatternNode") {
-                    node = std::make_unique<EngulfingPatternNode>(guid, this);
-                } 
-                else if (type == "CenterOfGravityNode") {
-                    node = std::make_unique<CenterOfGravityNode>(guid, this);
-                }
-                else if (type == "HammerPatternNode") {
-                    node = std::make_unique<HammerPatternNode>(guid, this);
-                }
-                else if (type == "DojiPatternNode") {
-                    node = std::make_unique<DojiPatternNode>(guid, this);
-                }
-                else if (type == "LowestNode") {
-                    node = std::make_unique<LowestNode>(guid, this);
-                }
-                else if (type == "HighestNode") {
-                    node = std::make_unique<HighestNode>(guid, this);
-                }
-                else if (type == "VWAPNode") {
-                    node = std::make_unique<VWAPNode>(guid, this);
-                }
-                else if (type == "MFINode") {
-                    node = std::make_unique<MFINode>(guid, this);
-                }
-                else if (type == "WilliamsRNode") {
-                    node = std::make_unique<WilliamsRNode>(guid, this);
-                }
-                else if (type == "CCINode") {
-                    node = std::make_unique<CCINode>(guid, this);
-                }
-                else if (type == "ATRNode") {
-                    node = std::make_unique<ATRNode>(guid, this);
-                }
-                else if (type == "StochasticNode") {
-                    node = std::make_unique<StochasticNode>(guid, this);
-                }
-                else if (type == "BollingerBandsNode") {
-                    node = std::make_unique<BollingerBandsNode>(guid, this);
-                }
-                else if (type == "MACDNode") {
-                    node = std::make_unique<MACDNode>(guid, this);
-                }
-                else if (type == "RSINode") {
-                    node = std::make_unique<RSINode>(guid, this);
-                }
-                else if (type == "EMANode") {
-                    node = std::make_unique<EMANode>(guid, this);
-                }
-                else if (type == "SMANode") {
-                    node = std::make_unique<SMANode>(guid, this);
-                }
-                else if (type == "IntNotEqualNode") {
-                    node = std::make_unique<IntNotEqualNode>(guid, this);
-                }
-                else if (type == "IntEqualNode") {
-                    node = std::make_unique<IntEqualNode>(guid, this);
-                }
-                else if (type == "IntLessThanNode") {
-                    node = std::make_unique<IntLessThanNode>(guid, this);
-                }
-                else if (type == "IntMoreThanNode") {
-                    node = std::make_unique<IntMoreThanNode>(guid, this);
-                }
-                else if (type == "DoubleNotEqualNode") {
-                    node = std::make_unique<DoubleNotEqualNode>(guid, this);
-                }
-                else if (type == "DoubleEqualNode") {
-                    node = std::make_unique<DoubleEqualNode>(guid, this);
-                }
-                else if (type == "DoubleLessThanNode") {
-                    node = std::make_unique<DoubleLessThanNode>(guid, this);
-                }
-                else if (type == "DoubleMoreThanNode") {
-                    node = std::make_unique<DoubleMoreThanNode>(guid, this);
-                }
-                else if (type == "FloatNotEqualNode") {
-                    node = std::make_unique<FloatNotEqualNode>(guid, this);
-                }
-                else if (type == "FloatEqualNode") {
-                    node = std::make_unique<FloatEqualNode>(guid, this);
-                }
-                else if (type == "FloatLessThanNode") {
-                    node = std::make_unique<FloatLessThanNode>(guid, this);
-                }
-                else if (type == "FloatMoreThanNode") {
-                    node = std::make_unique<FloatMoreThanNode>(guid, this);
-                }
-                else if (type == "BoolAndNode") {
-                    node = std::make_unique<BoolAndNode>(guid, this);
-                }
-                else if (type == "BoolOrNode") {
-                    node = std::make_unique<BoolOrNode>(guid, this);
-                }
-                else if (type == "BoolEqualNode") {
-                    node = std::make_unique<BoolEqualNode>(guid, this);
-                }
-                else if (type == "BoolNotEqualNode") {
-                    node = std::make_unique<BoolNotEqualNode>(guid, this);
-                }
-                else if (type == "IntToFloatNode") {
-                    node = std::make_unique<IntToFloatNode>(guid, this);
-                }
-                else if (type == "IntToDoubleNode") {
-                    node = std::make_unique<IntToDoubleNode>(guid, this);
-                }
-                else if (type == "IntToTextNode") {
-                    node = std::make_unique<IntToTextNode>(guid, this);
-                }
-                else if (type == "DoubleToFloatNode") {
-                    node = std::make_unique<DoubleToFloatNode>(guid, this);
-                }
-                else if (type == "DoubleToIntNode") {
-                    node = std::make_unique<DoubleToIntNode>(guid, this);
-                }
-                else if (type == "DoubleToTextNode") {
-                    node = std::make_unique<DoubleToTextNode>(guid, this);
-                }
-                else if (type == "FloatToDoubleNode") {
-                    node = std::make_unique<FloatToDoubleNode>(guid, this);
-                }
-                else if (type == "FloatToIntNode") {
-                    node = std::make_unique<FloatToIntNode>(guid, this);
-                }
-                else if (type == "FloatToTextNode") {
-                    node = std::make_unique<FloatToTextNode>(guid, this);
-                }
-                else if (type == "BoolToTextNode") {
-                    node = std::make_unique<BoolToTextNode>(guid, this);
-                }
-
-                else if (type == "GetIntArrayElementNode") {
-                    node = std::make_unique<GetIntArrayElementNode>(guid, this);
-                }
-                else if (type == "AddIntArrayElementNode") {
-                    node = std::make_unique<AddIntArrayElementNode>(guid, this);
-                }
-                else if (type == "GetFloatArrayElementNode") {
-                    node = std::make_unique<GetFloatArrayElementNode>(guid, this);
-                }
-                else if (type == "AddFloatArrayElementNode") {
-                    node = std::make_unique<AddFloatArrayElementNode>(guid, this);
-                }
-                else if (type == "GetDoubleArrayElementNode") {
-                    node = std::make_unique<GetDoubleArrayElementNode>(guid, this);
-                }
-                else if (type == "AddDoubleArrayElementNode") {
-                    node = std::make_unique<AddDoubleArrayElementNode>(guid, this);
-                }
-                else if (type == "GetBoolArrayElementNode") {
-                    node = std::make_unique<GetBoolArrayElementNode>(guid, this);
-                }
-                else if (type == "AddBoolArrayElementNode") {
-                    node = std::make_unique<AddBoolArrayElementNode>(guid, this);
-                }
-                else if (type == "GetStringArrayElementNode") {
-                    node = std::make_unique<GetStringArrayElementNode>(guid, this);
-                }
-                else if (type == "AddStringArrayElementNode") {
-                    node = std::make_unique<AddStringArrayElementNode>(guid, this);
-                }
-
-                else if (type == "ForLoopNode") {
-                    node = std::make_unique<ForLoopNode>(guid, this);
-                }
-
-
-                else if (type == "ConstIntNode") {
-                    node = std::make_unique<ConstIntNode>(guid, this);
-                }
-                else if (type == "ConstFloatNode") {
-                    node = std::make_unique<ConstFloatNode>(guid, this);
-                }
-                else if (type == "ConstDoubleNode") {
-                    node = std::make_unique<ConstDoubleNode>(guid, this);
-                }
-                else if (type == "ConstBoolNode") {
-                    node = std::make_unique<ConstBoolNode>(guid, this);
-                }
-                else if (type == "ConstTextNode") {
-                    node = std::make_unique<ConstTextNode>(guid, this);
-                }
-                else if (type == "IntMinusIntNode") {
-                    node = std::make_unique<IntMinusIntNode>(guid, this);
-                }
-                else if (type == "IntMinusFloatNode") {
-                    node = std::make_unique<IntMinusFloatNode>(guid, this);
-                }
-                else if (type == "IntMinusDoubleNode") {
-                    node = std::make_unique<IntMinusDoubleNode>(guid, this);
-                }
-                else if (type == "IntPlusIntNode") {
-                    node = std::make_unique<IntPlusIntNode>(guid, this);
-                }
-                else if (type == "IntPlusFloatNode") {
-                    node = std::make_unique<IntPlusFloatNode>(guid, this);
-                }
-                else if (type == "IntPlusDoubleNode") {
-                    node = std::make_unique<IntPlusDoubleNode>(guid, this);
-                }
-                else if (type == "IntMultiplyIntNode") {
-                    node = std::make_unique<IntMultiplyIntNode>(guid, this);
-                }
-                else if (type == "IntMultiplyFloatNode") {
-                    node = std::make_unique<IntMultiplyFloatNode>(guid, this);
-                }
-                else if (type == "IntMultiplyDoubleNode") {
-                    node = std::make_unique<IntMultiplyDoubleNode>(guid, this);
-                }
-                else if (type == "IntDivideIntNode") {
-                    node = std::make_unique<IntDivideIntNode>(guid, this);
-                }
-                else if (type == "IntDivideFloatNode") {
-                    node = std::make_unique<IntDivideFloatNode>(guid, this);
-                }
-                else if (type == "IntDivideDoubleNode") {
-                    node = std::make_unique<IntDivideDoubleNode>(guid, this);
-                }
-
-                else if (type == "FloatMinusIntNode") {
-                    node = std::make_unique<FloatMinusIntNode>(guid, this);
-                }
-                else if (type == "FloatMinusFloatNode") {
-                    node = std::make_unique<FloatMinusFloatNode>(guid, this);
-                }
-                else if (type == "FloatMinusDoubleNode") {
-                    node = std::make_unique<FloatMinusDoubleNode>(guid, this);
-                }
-                else if (type == "FloatPlusIntNode") {
-                    node = std::make_unique<FloatPlusIntNode>(guid, this);
-                }
-                else if (type == "FloatPlusFloatNode") {
-                    node = std::make_unique<FloatPlusFloatNode>(guid, this);
-                }
-                else if (type == "FloatPlusDoubleNode") {
-                    node = std::make_unique<FloatPlusDoubleNode>(guid, this);
-                }
-                else if (type == "FloatMultiplyIntNode") {
-                    node = std::make_unique<FloatMultiplyIntNode>(guid, this);
-                }
-                else if (type == "FloatMultiplyFloatNode") {
-                    node = std::make_unique<FloatMultiplyFloatNode>(guid, this);
-                }
-                else if (type == "FloatMultiplyDoubleNode") {
-                    node = std::make_unique<FloatMultiplyDoubleNode>(guid, this);
-                }
-                else if (type == "FloatDivideIntNode") {
-                    node = std::make_unique<FloatDivideIntNode>(guid, this);
-                }
-                else if (type == "FloatDivideFloatNode") {
-                    node = std::make_unique<FloatDivideFloatNode>(guid, this);
-                }
-                else if (type == "FloatDivideDoubleNode") {
-                    node = std::make_unique<FloatDivideDoubleNode>(guid, this);
-                }
-
-                else if (type == "DoubleMinusIntNode") {
-                    node = std::make_unique<DoubleMinusIntNode>(guid, this);
-                }
-                else if (type == "DoubleMinusFloatNode") {
-                    node = std::make_unique<DoubleMinusFloatNode>(guid, this);
-                }
-                else if (type == "DoubleMinusDoubleNode") {
-                    node = std::make_unique<DoubleMinusDoubleNode>(guid, this);
-                }
-                else if (type == "DoublePlusIntNode") {
-                    node = std::make_unique<DoublePlusIntNode>(guid, this);
-                }
-                else if (type == "DoublePlusFloatNode") {
-                    node = std::make_unique<DoublePlusFloatNode>(guid, this);
-                }
-                else if (type == "DoublePlusDoubleNode") {
-                    node = std::make_unique<DoublePlusDoubleNode>(guid, this);
-                }
-                else if (type == "DoubleMultiplyIntNode") {
-                    node = std::make_unique<DoubleMultiplyIntNode>(guid, this);
-                }
-                else if (type == "DoubleMultiplyFloatNode") {
-                    node = std::make_unique<DoubleMultiplyFloatNode>(guid, this);
-                }
-                else if (type == "DoubleMultiplyDoubleNode") {
-                    node = std::make_unique<DoubleMultiplyDoubleNode>(guid, this);
-                }
-                else if (type == "DoubleDivideIntNode") {
-                    node = std::make_unique<DoubleDivideIntNode>(guid, this);
-                }
-                else if (type == "DoubleDivideFloatNode") {
-                    node = std::make_unique<DoubleDivideFloatNode>(guid, this);
-                }
-                else if (type == "DoubleDivideDoubleNode") {
-                    node = std::make_unique<DoubleDivideDoubleNode>(guid, this);
-                }
-
-                else if (type == "BranchNode") {
-                    node = std::make_unique<BranchNode>(guid, this);
-                }
-                else if (type == "SequenceNode") {
-                    node = std::make_unique<SequenceNode>(guid, this);
-                    }
-                else if (type == "PrintString") {
-                    node = std::make_unique<PrintString>(guid, this);
-                }   
-                else if (type == "GetVariableNode") {
-                    node = std::make_unique<GetVariableNode>(guid, this);
-                }
-                else if (type == "SetVariableNode") {
-                        node = std::make_unique<SetVariableNode>(guid, this);
-                }
+                std::unique_ptr<BasicNode> node = NodeRegistry::getInstance().create(type, guid, this);
 
                 if (!node) {
                     std::cout << "Unknown node type: " << type << std::endl;
@@ -4330,317 +3752,10 @@ void BlueprintManager::pasteNodes(ImVec2 paste_position) {
         std::string new_guid = GUIDGenerator::generate();
         std::string type = node_json["type"];
 
+        // The blueprint has a single Entry node; it is never duplicated by paste.
         std::unique_ptr<BasicNode> node = nullptr;
-
-        
-        if (type == "BybiyMarginLongNode") {
-            node = std::make_unique<BybiyMarginLongNode>(new_guid, this);
-        }
-        else if (type == "BybiyMarginShortNode") {
-            node = std::make_unique<BybiyMarginShortNode>(new_guid, this);
-        }
-        else if (type == "BybiyMarginCloseLongPositionNode") {
-            node = std::make_unique<BybiyMarginCloseLongPositionNode>(new_guid, this);
-        }
-        else if (type == "BybiyMarginCloseShortPositionNode") {
-            node = std::make_unique<BybiyMarginCloseShortPositionNode>(new_guid, this);
-        }
-
-        else if (type == "AddMarkNode") {
-            node = std::make_unique<AddMarkNode>(new_guid, this);
-        }
-        else if (type == "AddLineNode") {
-            node = std::make_unique<AddLineNode>(new_guid, this);
-        }
-        else if (type == "GetCurrentCandleDataNode") {
-        node = std::make_unique<GetCurrentCandleDataNode>(new_guid, this);
-        }
-        else if (type == "GetCandleDataAtIndexNode") {
-        node = std::make_unique<GetCandleDataAtIndexNode>(new_guid, this);
-        }
-        else if (type == "GetCurrentCandleIndexNode") {
-        node = std::make_unique<GetCurrentCandleIndexNode>(new_guid, this);
-        }
-
-        else if (type == "EngulfingPatternNode") {
-            node = std::make_unique<EngulfingPatternNode>(new_guid, this);
-        }
-        else if (type == "CenterOfGravityNode") {
-            node = std::make_unique<CenterOfGravityNode>(new_guid, this);
-        }
-        else if (type == "HammerPatternNode") {
-            node = std::make_unique<HammerPatternNode>(new_guid, this);
-        }
-        else if (type == "DojiPatternNode") {
-            node = std::make_unique<DojiPatternNode>(new_guid, this);
-        }
-        else if (type == "LowestNode") {
-            node = std::make_unique<LowestNode>(new_guid, this);
-        }
-        else if (type == "HighestNode") {
-            node = std::make_unique<HighestNode>(new_guid, this);
-        }
-        else if (type == "VWAPNode") {
-            node = std::make_unique<VWAPNode>(new_guid, this);
-        }
-        else if (type == "MFINode") {
-            node = std::make_unique<MFINode>(new_guid, this);
-        }
-        else if (type == "WilliamsRNode") {
-            node = std::make_unique<WilliamsRNode>(new_guid, this);
-        }
-        else if (type == "CCINode") {
-            node = std::make_unique<CCINode>(new_guid, this);
-        }
-        else if (type == "ATRNode") {
-            node = std::make_unique<ATRNode>(new_guid, this);
-        }
-        else if (type == "StochasticNode") {
-            node = std::make_unique<StochasticNode>(new_guid, this);
-        }
-        else if (type == "BollingerBandsNode") {
-            node = std::make_unique<BollingerBandsNode>(new_guid, this);
-        }
-        else if (type == "MACDNode") {
-            node = std::make_unique<MACDNode>(new_guid, this);
-        }
-        else if (type == "RSINode") {
-            node = std::make_unique<RSINode>(new_guid, this);
-        }
-        else if (type == "EMANode") {
-            node = std::make_unique<EMANode>(new_guid, this);
-        }
-        else if (type == "SMANode") {
-            node = std::make_unique<SMANode>(new_guid, this);
-        }
-
-
-        else if (type == "IntNotEqualNode") {
-            node = std::make_unique<IntNotEqualNode>(new_guid, this);
-        }
-        else if (type == "IntEqualNode") {
-            node = std::make_unique<IntEqualNode>(new_guid, this);
-        }
-        else if (type == "IntLessThanNode") {
-            node = std::make_unique<IntLessThanNode>(new_guid, this);
-        }
-        else if (type == "IntMoreThanNode") {
-            node = std::make_unique<IntMoreThanNode>(new_guid, this);
-        }
-        else if (type == "DoubleNotEqualNode") {
-            node = std::make_unique<DoubleNotEqualNode>(new_guid, this);
-        }
-        else if (type == "DoubleEqualNode") {
-            node = std::make_unique<DoubleEqualNode>(new_guid, this);
-        }
-        else if (type == "DoubleLessThanNode") {
-            node = std::make_unique<DoubleLessThanNode>(new_guid, this);
-        }
-        else if (type == "DoubleMoreThanNode") {
-            node = std::make_unique<DoubleMoreThanNode>(new_guid, this);
-        }
-        else if (type == "FloatNotEqualNode") {
-            node = std::make_unique<FloatNotEqualNode>(new_guid, this);
-        }
-        else if (type == "FloatEqualNode") {
-            node = std::make_unique<FloatEqualNode>(new_guid, this);
-        }
-        else if (type == "FloatLessThanNode") {
-            node = std::make_unique<FloatLessThanNode>(new_guid, this);
-        }
-        else if (type == "FloatMoreThanNode") {
-            node = std::make_unique<FloatMoreThanNode>(new_guid, this);
-        }
-        else if (type == "BoolAndNode") {
-            node = std::make_unique<BoolAndNode>(new_guid, this);
-        }
-        else if (type == "BoolOrNode") {
-            node = std::make_unique<BoolOrNode>(new_guid, this);
-        }
-        else if (type == "BoolEqualNode") {
-            node = std::make_unique<BoolEqualNode>(new_guid, this);
-        }
-        else if (type == "BoolNotEqualNode") {
-            node = std::make_unique<BoolNotEqualNode>(new_guid, this);
-        }
-
-        else if (type == "IntToFloatNode") {
-            node = std::make_unique<IntToFloatNode>(new_guid, this);
-        }
-        else if (type == "IntToDoubleNode") {
-            node = std::make_unique<IntToDoubleNode>(new_guid, this);
-        }
-        else if (type == "IntToTextNode") {
-            node = std::make_unique<IntToTextNode>(new_guid, this);
-        }
-        else if (type == "DoubleToFloatNode") {
-            node = std::make_unique<DoubleToFloatNode>(new_guid, this);
-        }
-        else if (type == "DoubleToIntNode") {
-            node = std::make_unique<DoubleToIntNode>(new_guid, this);
-        }
-        else if (type == "DoubleToTextNode") {
-            node = std::make_unique<DoubleToTextNode>(new_guid, this);
-        }
-        else if (type == "FloatToDoubleNode") {
-            node = std::make_unique<FloatToDoubleNode>(new_guid, this);
-        }
-        else if (type == "FloatToIntNode") {
-            node = std::make_unique<FloatToIntNode>(new_guid, this);
-        }
-        else if (type == "FloatToTextNode") {
-            node = std::make_unique<FloatToTextNode>(new_guid, this);
-        }
-        else if (type == "BoolToTextNode") {
-            node = std::make_unique<BoolToTextNode>(new_guid, this);
-        }
-
-        else if (type == "ForLoopNode") {
-            node = std::make_unique<ForLoopNode>(new_guid, this);
-        }
-
-        else if (type == "ConstIntNode") {
-            node = std::make_unique<ConstIntNode>(new_guid, this);
-        }
-        else if (type == "ConstFloatNode") {
-            node = std::make_unique<ConstFloatNode>(new_guid, this);
-        }
-        else if (type == "ConstDoubleNode") {
-            node = std::make_unique<ConstDoubleNode>(new_guid, this);
-        }
-        else if (type == "ConstBoolNode") {
-            node = std::make_unique<ConstBoolNode>(new_guid, this);
-        }
-        else if (type == "ConstTextNode") {
-            node = std::make_unique<ConstTextNode>(new_guid, this);
-        }
-
-        else if (type == "IntMinusIntNode") {
-            node = std::make_unique<IntMinusIntNode>(new_guid, this);
-        }
-        else if (type == "IntMinusFloatNode") {
-            node = std::make_unique<IntMinusFloatNode>(new_guid, this);
-        }
-        else if (type == "IntMinusDoubleNode") {
-            node = std::make_unique<IntMinusDoubleNode>(new_guid, this);
-        }
-        else if (type == "IntPlusIntNode") {
-            node = std::make_unique<IntPlusIntNode>(new_guid, this);
-        }
-        else if (type == "IntPlusFloatNode") {
-            node = std::make_unique<IntPlusFloatNode>(new_guid, this);
-        }
-        else if (type == "IntPlusDoubleNode") {
-            node = std::make_unique<IntPlusDoubleNode>(new_guid, this);
-        }
-        else if (type == "IntMultiplyIntNode") {
-            node = std::make_unique<IntMultiplyIntNode>(new_guid, this);
-        }
-        else if (type == "IntMultiplyFloatNode") {
-            node = std::make_unique<IntMultiplyFloatNode>(new_guid, this);
-        }
-        else if (type == "IntMultiplyDoubleNode") {
-            node = std::make_unique<IntMultiplyDoubleNode>(new_guid, this);
-        }
-        else if (type == "IntDivideIntNode") {
-            node = std::make_unique<IntDivideIntNode>(new_guid, this);
-        }
-        else if (type == "IntDivideFloatNode") {
-            node = std::make_unique<IntDivideFloatNode>(new_guid, this);
-        }
-        else if (type == "IntDivideDoubleNode") {
-            node = std::make_unique<IntDivideDoubleNode>(new_guid, this);
-        }
-
-        else if (type == "FloatMinusIntNode") {
-            node = std::make_unique<FloatMinusIntNode>(new_guid, this);
-        }
-        else if (type == "FloatMinusFloatNode") {
-            node = std::make_unique<FloatMinusFloatNode>(new_guid, this);
-        }
-        else if (type == "FloatMinusDoubleNode") {
-            node = std::make_unique<FloatMinusDoubleNode>(new_guid, this);
-        }
-        else if (type == "FloatPlusIntNode") {
-            node = std::make_unique<FloatPlusIntNode>(new_guid, this);
-        }
-        else if (type == "FloatPlusFloatNode") {
-            node = std::make_unique<FloatPlusFloatNode>(new_guid, this);
-        }
-        else if (type == "FloatPlusDoubleNode") {
-            node = std::make_unique<FloatPlusDoubleNode>(new_guid, this);
-        }
-        else if (type == "FloatMultiplyIntNode") {
-            node = std::make_unique<FloatMultiplyIntNode>(new_guid, this);
-        }
-        else if (type == "FloatMultiplyFloatNode") {
-            node = std::make_unique<FloatMultiplyFloatNode>(new_guid, this);
-        }
-        else if (type == "FloatMultiplyDoubleNode") {
-            node = std::make_unique<FloatMultiplyDoubleNode>(new_guid, this);
-        }
-        else if (type == "FloatDivideIntNode") {
-            node = std::make_unique<FloatDivideIntNode>(new_guid, this);
-        }
-        else if (type == "FloatDivideFloatNode") {
-            node = std::make_unique<FloatDivideFloatNode>(new_guid, this);
-        }
-        else if (type == "FloatDivideDoubleNode") {
-            node = std::make_unique<FloatDivideDoubleNode>(new_guid, this);
-        }
-
-        else if (type == "DoubleMinusIntNode") {
-            node = std::make_unique<DoubleMinusIntNode>(new_guid, this);
-        }
-        else if (type == "DoubleMinusFloatNode") {
-            node = std::make_unique<DoubleMinusFloatNode>(new_guid, this);
-        }
-        else if (type == "DoubleMinusDoubleNode") {
-            node = std::make_unique<DoubleMinusDoubleNode>(new_guid, this);
-        }
-        else if (type == "DoublePlusIntNode") {
-            node = std::make_unique<DoublePlusIntNode>(new_guid, this);
-        }
-        else if (type == "DoublePlusFloatNode") {
-            node = std::make_unique<DoublePlusFloatNode>(new_guid, this);
-        }
-        else if (type == "DoublePlusDoubleNode") {
-            node = std::make_unique<DoublePlusDoubleNode>(new_guid, this);
-        }
-        else if (type == "DoubleMultiplyIntNode") {
-            node = std::make_unique<DoubleMultiplyIntNode>(new_guid, this);
-        }
-        else if (type == "DoubleMultiplyFloatNode") {
-            node = std::make_unique<DoubleMultiplyFloatNode>(new_guid, this);
-        }
-        else if (type == "DoubleMultiplyDoubleNode") {
-            node = std::make_unique<DoubleMultiplyDoubleNode>(new_guid, this);
-        }
-        else if (type == "DoubleDivideIntNode") {
-            node = std::make_unique<DoubleDivideIntNode>(new_guid, this);
-        }
-        else if (type == "DoubleDivideFloatNode") {
-            node = std::make_unique<DoubleDivideFloatNode>(new_guid, this);
-        }
-        else if (type == "DoubleDivideDoubleNode") {
-            node = std::make_unique<DoubleDivideDoubleNode>(new_guid, this);
-        }
-
-        else if (type == "BranchNode") {
-            node = std::make_unique<BranchNode>(new_guid, this);
-        }
-        else if (type == "SequenceNode") {
-            node = std::make_unique<SequenceNode>(new_guid, this);
-        }
-        else if (type == "PrintString") {
-            node = std::make_unique<PrintString>(new_guid, this);
-        }
-
-        else if (type == "GetVariableNode") {
-            node = std::make_unique<GetVariableNode>(new_guid, this);
-        }
-        else if (type == "SetVariableNode") {
-            node = std::make_unique<SetVariableNode>(new_guid, this);
+        if (type != "EntryNode") {
+            node = NodeRegistry::getInstance().create(type, new_guid, this);
         }
 
         if (!node) continue;
@@ -4711,25 +3826,11 @@ void BlueprintManager::deleteSelectedNodes() {
     for (auto it = connections.begin(); it != connections.end();) {
         bool should_remove = false;
 
-        for (const std::string& guid : selected_nodes) {
-            BasicNode* node = getNodeByGuid(guid);
-            if (!node) continue;
-
-            for (auto& pin : node->inputs) {
-                if (pin.get() == it->to_pin) {
-                    should_remove = true;
-                    break;
-                }
-            }
-
-            for (auto& pin : node->outputs) {
-                if (pin.get() == it->from_pin) {
-                    should_remove = true;
-                    break;
-                }
-            }
-
-            if (should_remove) break;
+        if (it->to_pin && it->to_pin->owner && selected_nodes.count(it->to_pin->owner->node_guid)) {
+            should_remove = true;
+        }
+        if (it->from_pin && it->from_pin->owner && selected_nodes.count(it->from_pin->owner->node_guid)) {
+            should_remove = true;
         }
 
         if (should_remove) {
@@ -4752,7 +3853,10 @@ void BlueprintManager::deleteSelectedNodes() {
     }
 
     for (const std::string& guid : selected_nodes) {
-        nodes.erase(guid);
+        auto node_it = nodes.find(guid);
+        if (node_it == nodes.end()) continue;
+        unindexNodePins(node_it->second.get());
+        nodes.erase(node_it);
     }
 
     std::cout << "Deleted " << selected_nodes.size() << " nodes" << std::endl;
@@ -4784,6 +3888,7 @@ void BlueprintManager::restoreConnections(const nlohmann::json& connections_json
 
 void BlueprintManager::clearAllBeforeLoad() {
     nodes.clear();
+    pin_index.clear();
     connections.clear();
     creating_connection = false;
     connection_start_pin = nullptr;
@@ -4799,6 +3904,7 @@ void BlueprintManager::clearAll() {
     {
         if (dynamic_cast<EntryNode*>(it->second.get()) == nullptr)
         {
+            unindexNodePins(it->second.get());
             it = nodes.erase(it);     
         }
         else
@@ -63,7 +63,7 @@ void ConstValueNode::drawNodeToDrawList(ImDrawList* draw_list) {
 
     case PinType::DOUBLE: {
         char buffer[32];
-        snprintf(buffer, sizeof(buffer), "%.6Lf", doubleValue);
+        snprintf(buffer, sizeof(buffer), "%.6f", static_cast<double>(doubleValue));
         valueText = std::string(buffer);
         valueText = valueText.substr(0, valueText.find_last_not_of('0') + 1);
         if (valueText.back() == '.') valueText.pop_back();
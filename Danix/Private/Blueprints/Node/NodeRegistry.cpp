@@ -0,0 +1,49 @@
+#include "../../../Public/Blueprints/Node/NodeRegistry.h"
+#include "../../../Public/Blueprints/Node/Node.h"
+#include <iostream>
+#include <algorithm>
+
+NodeRegistry& NodeRegistry::getInstance() {
+    static NodeRegistry instance;
+    return instance;
+}
+
+bool NodeRegistry::registerType(const char* typeName, NodeFactory factory) {
+    if (!factory) return false;
+
+    if (!m_factories.emplace(typeName, factory).second) {
+        std::cerr << "[NodeRegistry] Duplicate node type: " << typeName << std::endl;
+        return false;
+    }
+    return true;
+}
+
+NodeFactory NodeRegistry::getFactory(const std::string& typeName) const {
+    auto it = m_factories.find(typeName);
+    if (it != m_factories.end()) return it->second;
+
+    it = m_factories.find(typeName + "Node");
+    if (it != m_factories.end()) return it->second;
+
+    return nullptr;
+}
+
+std::unique_ptr<BasicNode> NodeRegistry::create(const std::string& typeName, const std::string& guid, BlueprintManager* manager) const {
+    NodeFactory factory = getFactory(typeName);
+    if (!factory) return nullptr;
+    return factory(guid, manager);
+}
+
+bool NodeRegistry::contains(const std::string& typeName) const {
+    return getFactory(typeName) != nullptr;
+}
+
+std::vector<std::string> NodeRegistry::getTypeNames() const {
+    std::vector<std::string> names;
+    names.reserve(m_factories.size());
+    for (const auto& item : m_factories) {
+        names.push_back(item.first);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
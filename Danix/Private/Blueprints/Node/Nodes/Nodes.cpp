@@ -1,12 +1,17 @@
 ﻿#include "../../../../Public/Blueprints/Node/Nodes/Nodes.h"
+#include "../../../../Public/Blueprints/Node/NodeRegistry.h"
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include "../../../../Public/Blueprints/BlueprintManager.h"
 #include "../../../../Public/Chart/CandleChart.h"
 #include "../../../../Public/StatsManager/TradingStatsManager.h"
+#include "../../../../Public/Chart/IndicatorBatch.h"
+#include "../../../../Public/Chart/IndicatorCache.h"
 
 #include "../../../../Public/Exchanges/Bybit/BybitMargin.h"
 #include "../../../../Public/Exchanges/Bybit/LiquidationCalculator.h"
+#include "../../../../Public/Exchanges/Bybit/BybitOrderGateway.h"
+#include "../../../../Public/Exchanges/Bybit/OrderBook.h"
 #include "../../../../Public/Systems/Config/PlatformConfig.h"
 using namespace Bybit;
 EntryNode::EntryNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Entry", dManager) {
@@ -29,6 +34,7 @@ void EntryNode::execute() {
 std::string EntryNode::getNodeType() const {
     return "EntryNode";
 }
+REGISTER_NODE_TYPE(EntryNode);
 GetVariableNode::GetVariableNode(const std::string& guid, BlueprintManager* dManager, const std::string& varGuid)
     : PureNode(guid, "Get Variable", dManager), variableGuid(varGuid) {
 
@@ -79,6 +85,7 @@ void GetVariableNode::execute() {
 }
 
 std::string GetVariableNode::getNodeType() const { return "GetVariableNode"; }
+REGISTER_NODE_TYPE(GetVariableNode);
 
 void GetVariableNode::bindToVariable(const std::string& varGuid) {
     variableGuid = varGuid;
@@ -131,7 +138,7 @@ void SetVariableNode::execute() {
                 var->floatValue = inputs[1]->getValue<float>();
                 break;
             case PinType::DOUBLE:
-                var->doubleValue = inputs[1]->getValue<long double>();
+                var->doubleValue = inputs[1]->getValue<Real>();
                 break;
             case PinType::BOOL:
                 var->boolValue = inputs[1]->getValue<bool>();
@@ -140,19 +147,19 @@ void SetVariableNode::execute() {
                 var->stringValue = inputs[1]->getValue<std::string>();
                 break;
             case PinType::ARRAY_INT:
-                var->arrayIntValue = inputs[1]->getValue<std::vector<int>>();
+                if (auto* value = inputs[1]->getValue<ArrayValue<int>*>()) var->arrayIntValue = *value;
                 break;
             case PinType::ARRAY_FLOAT:
-                var->arrayFloatValue = inputs[1]->getValue<std::vector<float>>();
+                if (auto* value = inputs[1]->getValue<ArrayValue<float>*>()) var->arrayFloatValue = *value;
                 break;
             case PinType::ARRAY_DOUBLE:
-                var->arrayDoubleValue = inputs[1]->getValue<std::vector<long double>>();
+                if (auto* value = inputs[1]->getValue<ArrayValue<Real>*>()) var->arrayDoubleValue = *value;
                 break;
             case PinType::ARRAY_BOOL:
-                var->arrayBoolValue = inputs[1]->getValue<std::vector<bool>>();
+                if (auto* value = inputs[1]->getValue<ArrayValue<bool>*>()) var->arrayBoolValue = *value;
                 break;
             case PinType::ARRAY_STRING:
-                var->arrayStringValue = inputs[1]->getValue<std::vector<std::string>>();
+                if (auto* value = inputs[1]->getValue<ArrayValue<std::string>*>()) var->arrayStringValue = *value;
                 break;
             }
         }
@@ -168,6 +175,7 @@ void SetVariableNode::execute() {
 }
 
 std::string SetVariableNode::getNodeType() const { return "SetVariableNode"; }
+REGISTER_NODE_TYPE(SetVariableNode);
 
 void SetVariableNode::bindToVariable(const std::string& varGuid) {
     variableGuid = varGuid;
@@ -216,6 +224,7 @@ void IntNotEqualNode::execute() {
 std::string IntNotEqualNode::getNodeType() const {
     return "IntNotEqualNode";
 }
+REGISTER_NODE_TYPE(IntNotEqualNode);
 
 IntEqualNode::IntEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Equal to", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -237,6 +246,7 @@ void IntEqualNode::execute() {
 std::string IntEqualNode::getNodeType() const {
     return "IntEqualNode";
 }
+REGISTER_NODE_TYPE(IntEqualNode);
 
 IntLessThanNode::IntLessThanNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "<", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -258,6 +268,7 @@ void IntLessThanNode::execute() {
 std::string IntLessThanNode::getNodeType() const {
     return "IntLessThanNode";
 }
+REGISTER_NODE_TYPE(IntLessThanNode);
 
 IntMoreThanNode::IntMoreThanNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, ">", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -279,6 +290,7 @@ void IntMoreThanNode::execute() {
 std::string IntMoreThanNode::getNodeType() const {
     return "IntMoreThanNode";
 }
+REGISTER_NODE_TYPE(IntMoreThanNode);
 
 DoubleNotEqualNode::DoubleNotEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Not Equal", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -292,14 +304,15 @@ DoubleNotEqualNode::DoubleNotEqualNode(const std::string& guid, BlueprintManager
 }
 
 void DoubleNotEqualNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a != b);
 }
 
 std::string DoubleNotEqualNode::getNodeType() const {
     return "DoubleNotEqualNode";
 }
+REGISTER_NODE_TYPE(DoubleNotEqualNode);
 
 DoubleEqualNode::DoubleEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Equal", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -313,14 +326,15 @@ DoubleEqualNode::DoubleEqualNode(const std::string& guid, BlueprintManager* dMan
 }
 
 void DoubleEqualNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a == b);
 }
 
 std::string DoubleEqualNode::getNodeType() const {
     return "DoubleEqualNode";
 }
+REGISTER_NODE_TYPE(DoubleEqualNode);
 
 DoubleLessThanNode::DoubleLessThanNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "<", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -334,14 +348,15 @@ DoubleLessThanNode::DoubleLessThanNode(const std::string& guid, BlueprintManager
 }
 
 void DoubleLessThanNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a < b);
 }
 
 std::string DoubleLessThanNode::getNodeType() const {
     return "DoubleLessThanNode";
 }
+REGISTER_NODE_TYPE(DoubleLessThanNode);
 
 DoubleMoreThanNode::DoubleMoreThanNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, ">", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -355,14 +370,15 @@ DoubleMoreThanNode::DoubleMoreThanNode(const std::string& guid, BlueprintManager
 }
 
 void DoubleMoreThanNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a > b);
 }
 
 std::string DoubleMoreThanNode::getNodeType() const {
     return "DoubleMoreThanNode";
 }
+REGISTER_NODE_TYPE(DoubleMoreThanNode);
 
 FloatNotEqualNode::FloatNotEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Not Equal", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -384,6 +400,7 @@ void FloatNotEqualNode::execute() {
 std::string FloatNotEqualNode::getNodeType() const {
     return "FloatNotEqualNode";
 }
+REGISTER_NODE_TYPE(FloatNotEqualNode);
 
 FloatEqualNode::FloatEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Equal", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -405,6 +422,7 @@ void FloatEqualNode::execute() {
 std::string FloatEqualNode::getNodeType() const {
     return "FloatEqualNode";
 }
+REGISTER_NODE_TYPE(FloatEqualNode);
 
 FloatLessThanNode::FloatLessThanNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "<", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -426,6 +444,7 @@ void FloatLessThanNode::execute() {
 std::string FloatLessThanNode::getNodeType() const {
     return "FloatLessThanNode";
 }
+REGISTER_NODE_TYPE(FloatLessThanNode);
 
 FloatMoreThanNode::FloatMoreThanNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, ">", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -447,6 +466,7 @@ void FloatMoreThanNode::execute() {
 std::string FloatMoreThanNode::getNodeType() const {
     return "FloatMoreThanNode";
 }
+REGISTER_NODE_TYPE(FloatMoreThanNode);
 
 BoolAndNode::BoolAndNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Pure AND", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::BOOL, "A"));
@@ -468,6 +488,7 @@ void BoolAndNode::execute() {
 std::string BoolAndNode::getNodeType() const {
     return "BoolAndNode";
 }
+REGISTER_NODE_TYPE(BoolAndNode);
 
 BoolOrNode::BoolOrNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Or", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::BOOL, "A"));
@@ -489,6 +510,7 @@ void BoolOrNode::execute() {
 std::string BoolOrNode::getNodeType() const {
     return "BoolOrNode";
 }
+REGISTER_NODE_TYPE(BoolOrNode);
 
 BoolEqualNode::BoolEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Equal", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::BOOL, "A"));
@@ -510,6 +532,7 @@ void BoolEqualNode::execute() {
 std::string BoolEqualNode::getNodeType() const {
     return "BoolEqualNode";
 }
+REGISTER_NODE_TYPE(BoolEqualNode);
 
 BoolNotEqualNode::BoolNotEqualNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Not Equal", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::BOOL, "A"));
@@ -531,6 +554,7 @@ void BoolNotEqualNode::execute() {
 std::string BoolNotEqualNode::getNodeType() const {
     return "BoolNotEqualNode";
 }
+REGISTER_NODE_TYPE(BoolNotEqualNode);
 
 IntToFloatNode::IntToFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, ""));
@@ -550,6 +574,7 @@ void IntToFloatNode::execute() {
 std::string IntToFloatNode::getNodeType() const {
     return "IntToFloatNode";
 }
+REGISTER_NODE_TYPE(IntToFloatNode);
 
 IntToDoubleNode::IntToDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, ""));
@@ -563,13 +588,14 @@ IntToDoubleNode::IntToDoubleNode(const std::string& guid, BlueprintManager* dMan
 
 void IntToDoubleNode::execute() {
     int a = inputs[0]->getValue<int>();
-    outputs[0]->setValue(static_cast<long double>(a));
+    outputs[0]->setValue(static_cast<Real>(a));
 }
 
 
 std::string IntToDoubleNode::getNodeType() const {
     return "IntToDoubleNode";
 }
+REGISTER_NODE_TYPE(IntToDoubleNode);
 
 IntToTextNode::IntToTextNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, ""));
@@ -590,6 +616,7 @@ void IntToTextNode::execute() {
 std::string IntToTextNode::getNodeType() const {
     return "IntToTextNode";
 }
+REGISTER_NODE_TYPE(IntToTextNode);
 
 DoubleToFloatNode::DoubleToFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, ""));
@@ -602,13 +629,14 @@ DoubleToFloatNode::DoubleToFloatNode(const std::string& guid, BlueprintManager*
 }
 
 void DoubleToFloatNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     outputs[0]->setValue(static_cast<float>(a));
 }
 
 std::string DoubleToFloatNode::getNodeType() const {
-    return "IntToFloatNode";
+    return "DoubleToFloatNode";
 }
+REGISTER_NODE_TYPE(DoubleToFloatNode);
 
 DoubleToIntNode::DoubleToIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, ""));
@@ -621,13 +649,14 @@ DoubleToIntNode::DoubleToIntNode(const std::string& guid, BlueprintManager* dMan
 }
 
 void DoubleToIntNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     outputs[0]->setValue(static_cast<int>(a));
 }
 
 std::string DoubleToIntNode::getNodeType() const {
     return "DoubleToIntNode";
 }
+REGISTER_NODE_TYPE(DoubleToIntNode);
 
 DoubleToTextNode::DoubleToTextNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, ""));
@@ -640,7 +669,7 @@ DoubleToTextNode::DoubleToTextNode(const std::string& guid, BlueprintManager* dM
 }
 
 void DoubleToTextNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
 
     std::ostringstream oss;
     oss << a;
@@ -650,6 +679,7 @@ void DoubleToTextNode::execute() {
 std::string DoubleToTextNode::getNodeType() const {
     return "DoubleToTextNode";
 }
+REGISTER_NODE_TYPE(DoubleToTextNode);
 
 FloatToDoubleNode::FloatToDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, ""));
@@ -664,7 +694,7 @@ FloatToDoubleNode::FloatToDoubleNode(const std::string& guid, BlueprintManager*
 void FloatToDoubleNode::execute() {
     float a = inputs[0]->getValue<float>();
 
-    long double result = static_cast<long double>(a);
+    Real result = static_cast<Real>(a);
 
     outputs[0]->setValue(result);
 }
@@ -672,6 +702,7 @@ void FloatToDoubleNode::execute() {
 std::string FloatToDoubleNode::getNodeType() const {
     return "FloatToDoubleNode";
 }
+REGISTER_NODE_TYPE(FloatToDoubleNode);
 
 FloatToIntNode::FloatToIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, ""));
@@ -691,6 +722,7 @@ void FloatToIntNode::execute() {
 std::string FloatToIntNode::getNodeType() const {
     return "FloatToIntNode";
 }
+REGISTER_NODE_TYPE(FloatToIntNode);
 
 FloatToTextNode::FloatToTextNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, ""));
@@ -710,6 +742,7 @@ void FloatToTextNode::execute() {
 std::string FloatToTextNode::getNodeType() const {
     return "FloatToTextNode";
 }
+REGISTER_NODE_TYPE(FloatToTextNode);
 
 BoolToTextNode::BoolToTextNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::BOOL, ""));
@@ -730,6 +763,7 @@ void BoolToTextNode::execute() {
 std::string BoolToTextNode::getNodeType() const {
     return "BoolToTextNode";
 }
+REGISTER_NODE_TYPE(BoolToTextNode);
 
 ConstIntNode::ConstIntNode(const std::string& guid, BlueprintManager* dManager) : ConstValueNode(guid, "Const Int", dManager) {
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::INT, ""));
@@ -746,6 +780,7 @@ void ConstIntNode::execute() {
 std::string ConstIntNode::getNodeType() const {
     return "ConstIntNode";
 }
+REGISTER_NODE_TYPE(ConstIntNode);
 
 nlohmann::json ConstIntNode::serializeData() const
 {
@@ -775,6 +810,7 @@ void ConstFloatNode::execute() {
 std::string ConstFloatNode::getNodeType() const {
     return "ConstFloatNode";
 }
+REGISTER_NODE_TYPE(ConstFloatNode);
 
 nlohmann::json ConstFloatNode::serializeData() const
 {
@@ -804,6 +840,7 @@ void ConstDoubleNode::execute() {
 std::string ConstDoubleNode::getNodeType() const {
     return "ConstDoubleNode";
 }
+REGISTER_NODE_TYPE(ConstDoubleNode);
 
 nlohmann::json ConstDoubleNode::serializeData() const
 {
@@ -833,6 +870,7 @@ void ConstBoolNode::execute() {
 std::string ConstBoolNode::getNodeType() const {
     return "ConstBoolNode";
 }
+REGISTER_NODE_TYPE(ConstBoolNode);
 
 nlohmann::json ConstBoolNode::serializeData() const
 {
@@ -862,6 +900,7 @@ void ConstTextNode::execute() {
 std::string ConstTextNode::getNodeType() const {
     return "ConstTextNode";
 }
+REGISTER_NODE_TYPE(ConstTextNode);
 
 nlohmann::json ConstTextNode::serializeData() const
 {
@@ -894,6 +933,7 @@ void IntMinusIntNode::execute() {
 std::string IntMinusIntNode::getNodeType() const {
     return "IntMinusIntNode";
 }
+REGISTER_NODE_TYPE(IntMinusIntNode);
 
 IntMinusDoubleNode::IntMinusDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -906,13 +946,14 @@ IntMinusDoubleNode::IntMinusDoubleNode(const std::string& guid, BlueprintManager
 
 void IntMinusDoubleNode::execute() {
     int a = inputs[0]->getValue<int>();
-    long double b = inputs[1]->getValue<long double>();
-    outputs[0]->setValue(static_cast<long double>(a) - b);
+    Real b = inputs[1]->getValue<Real>();
+    outputs[0]->setValue(static_cast<Real>(a) - b);
 }
 
 std::string IntMinusDoubleNode::getNodeType() const {
     return "IntMinusDoubleNode";
 }
+REGISTER_NODE_TYPE(IntMinusDoubleNode);
 
 IntMinusFloatNode::IntMinusFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -932,6 +973,7 @@ void IntMinusFloatNode::execute() {
 std::string IntMinusFloatNode::getNodeType() const {
     return "IntMinusFloatNode";
 }
+REGISTER_NODE_TYPE(IntMinusFloatNode);
 
 IntPlusIntNode::IntPlusIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -951,6 +993,7 @@ void IntPlusIntNode::execute() {
 std::string IntPlusIntNode::getNodeType() const {
     return "IntPlusIntNode";
 }
+REGISTER_NODE_TYPE(IntPlusIntNode);
 
 IntPlusDoubleNode::IntPlusDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -963,13 +1006,14 @@ IntPlusDoubleNode::IntPlusDoubleNode(const std::string& guid, BlueprintManager*
 
 void IntPlusDoubleNode::execute() {
     int a = inputs[0]->getValue<int>();
-    long double b = inputs[1]->getValue<long double>();
-    outputs[0]->setValue(static_cast<long double>(a) + b);
+    Real b = inputs[1]->getValue<Real>();
+    outputs[0]->setValue(static_cast<Real>(a) + b);
 }
 
 std::string IntPlusDoubleNode::getNodeType() const {
     return "IntPlusDoubleNode";
 }
+REGISTER_NODE_TYPE(IntPlusDoubleNode);
 
 IntPlusFloatNode::IntPlusFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -988,6 +1032,7 @@ void IntPlusFloatNode::execute() {
 std::string IntPlusFloatNode::getNodeType() const {
     return "IntPlusFloatNode";
 }
+REGISTER_NODE_TYPE(IntPlusFloatNode);
 
 IntDivideIntNode::IntDivideIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -1012,6 +1057,7 @@ void IntDivideIntNode::execute() {
 std::string IntDivideIntNode::getNodeType() const {
     return "IntDivideIntNode";
 }
+REGISTER_NODE_TYPE(IntDivideIntNode);
 
 IntDivideDoubleNode::IntDivideDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -1024,9 +1070,9 @@ IntDivideDoubleNode::IntDivideDoubleNode(const std::string& guid, BlueprintManag
 
 void IntDivideDoubleNode::execute() {
     int a = inputs[0]->getValue<int>();
-    long double b = inputs[1]->getValue<long double>();
+    Real b = inputs[1]->getValue<Real>();
     if (b != 0.0) {
-        outputs[0]->setValue(static_cast<long double>(a) / b);
+        outputs[0]->setValue(static_cast<Real>(a) / b);
     }
     else {
         outputs[0]->setValue(0.0);
@@ -1036,6 +1082,7 @@ void IntDivideDoubleNode::execute() {
 std::string IntDivideDoubleNode::getNodeType() const {
     return "IntDivideDoubleNode";
 }
+REGISTER_NODE_TYPE(IntDivideDoubleNode);
 
 IntDivideFloatNode::IntDivideFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -1060,6 +1107,7 @@ void IntDivideFloatNode::execute() {
 std::string IntDivideFloatNode::getNodeType() const {
     return "IntDivideFloatNode";
 }
+REGISTER_NODE_TYPE(IntDivideFloatNode);
 
 IntMultiplyIntNode::IntMultiplyIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -1078,6 +1126,7 @@ void IntMultiplyIntNode::execute() {
 std::string IntMultiplyIntNode::getNodeType() const {
     return "IntMultiplyIntNode";
 }
+REGISTER_NODE_TYPE(IntMultiplyIntNode);
 
 IntMultiplyDoubleNode::IntMultiplyDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -1089,13 +1138,14 @@ IntMultiplyDoubleNode::IntMultiplyDoubleNode(const std::string& guid, BlueprintM
 }
 void IntMultiplyDoubleNode::execute() {
     int a = inputs[0]->getValue<int>();
-    long double b = inputs[1]->getValue<long double>();
-    outputs[0]->setValue(static_cast<long double>(a) * b);
+    Real b = inputs[1]->getValue<Real>();
+    outputs[0]->setValue(static_cast<Real>(a) * b);
 }
 
 std::string IntMultiplyDoubleNode::getNodeType() const {
     return "IntMultiplyDoubleNode";
 }
+REGISTER_NODE_TYPE(IntMultiplyDoubleNode);
 
 IntMultiplyFloatNode::IntMultiplyFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "A"));
@@ -1114,6 +1164,7 @@ void IntMultiplyFloatNode::execute() {
 std::string IntMultiplyFloatNode::getNodeType() const {
     return "IntMultiplyFloatNode";
 }
+REGISTER_NODE_TYPE(IntMultiplyFloatNode);
 
 FloatMinusIntNode::FloatMinusIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1132,6 +1183,7 @@ void FloatMinusIntNode::execute() {
 std::string FloatMinusIntNode::getNodeType() const {
     return "FloatMinusIntNode";
 }
+REGISTER_NODE_TYPE(FloatMinusIntNode);
 
 FloatMinusDoubleNode::FloatMinusDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1143,13 +1195,14 @@ FloatMinusDoubleNode::FloatMinusDoubleNode(const std::string& guid, BlueprintMan
 }
 void FloatMinusDoubleNode::execute() {
     float a = inputs[0]->getValue<float>();
-    long double b = inputs[1]->getValue<long double>();
-    outputs[0]->setValue(static_cast<long double>(a) - b);
+    Real b = inputs[1]->getValue<Real>();
+    outputs[0]->setValue(static_cast<Real>(a) - b);
 }
 
 std::string FloatMinusDoubleNode::getNodeType() const {
     return "FloatMinusDoubleNode";
 }
+REGISTER_NODE_TYPE(FloatMinusDoubleNode);
 
 FloatMinusFloatNode::FloatMinusFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1168,6 +1221,7 @@ void FloatMinusFloatNode::execute() {
 std::string FloatMinusFloatNode::getNodeType() const {
     return "FloatMinusFloatNode";
 }
+REGISTER_NODE_TYPE(FloatMinusFloatNode);
 
 FloatPlusIntNode::FloatPlusIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1186,6 +1240,7 @@ void FloatPlusIntNode::execute() {
 std::string FloatPlusIntNode::getNodeType() const {
     return "FloatPlusIntNode";
 }
+REGISTER_NODE_TYPE(FloatPlusIntNode);
 
 FloatPlusDoubleNode::FloatPlusDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1197,13 +1252,14 @@ FloatPlusDoubleNode::FloatPlusDoubleNode(const std::string& guid, BlueprintManag
 }
 void FloatPlusDoubleNode::execute() {
     float a = inputs[0]->getValue<float>();
-    long double b = inputs[1]->getValue<long double>();
-    outputs[0]->setValue(static_cast<long double>(a) + b);
+    Real b = inputs[1]->getValue<Real>();
+    outputs[0]->setValue(static_cast<Real>(a) + b);
 }
 
 std::string FloatPlusDoubleNode::getNodeType() const {
     return "FloatPlusDoubleNode";
 }
+REGISTER_NODE_TYPE(FloatPlusDoubleNode);
 
 FloatPlusFloatNode::FloatPlusFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1222,6 +1278,7 @@ void FloatPlusFloatNode::execute() {
 std::string FloatPlusFloatNode::getNodeType() const {
     return "FloatPlusFloatNode";
 }
+REGISTER_NODE_TYPE(FloatPlusFloatNode);
 
 FloatDivideIntNode::FloatDivideIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1245,6 +1302,7 @@ void FloatDivideIntNode::execute() {
 std::string FloatDivideIntNode::getNodeType() const {
     return "FloatDivideIntNode";
 }
+REGISTER_NODE_TYPE(FloatDivideIntNode);
 
 FloatDivideDoubleNode::FloatDivideDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1256,9 +1314,9 @@ FloatDivideDoubleNode::FloatDivideDoubleNode(const std::string& guid, BlueprintM
 }
 void FloatDivideDoubleNode::execute() {
     float a = inputs[0]->getValue<float>();
-    long double b = inputs[1]->getValue<long double>();
+    Real b = inputs[1]->getValue<Real>();
     if (b != 0.0) {
-        outputs[0]->setValue(static_cast<long double>(a) / b);
+        outputs[0]->setValue(static_cast<Real>(a) / b);
     }
     else {
         outputs[0]->setValue(0.0);
@@ -1268,6 +1326,7 @@ void FloatDivideDoubleNode::execute() {
 std::string FloatDivideDoubleNode::getNodeType() const {
     return "FloatDivideDoubleNode";
 }
+REGISTER_NODE_TYPE(FloatDivideDoubleNode);
 
 FloatDivideFloatNode::FloatDivideFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1291,6 +1350,7 @@ void FloatDivideFloatNode::execute() {
 std::string FloatDivideFloatNode::getNodeType() const {
     return "FloatDivideFloatNode";
 }
+REGISTER_NODE_TYPE(FloatDivideFloatNode);
 
 FloatMultiplyIntNode::FloatMultiplyIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1310,6 +1370,7 @@ void FloatMultiplyIntNode::execute() {
 std::string FloatMultiplyIntNode::getNodeType() const {
     return "FloatMultiplyIntNode";
 }
+REGISTER_NODE_TYPE(FloatMultiplyIntNode);
 
 FloatMultiplyDoubleNode::FloatMultiplyDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1322,13 +1383,14 @@ FloatMultiplyDoubleNode::FloatMultiplyDoubleNode(const std::string& guid, Bluepr
 
 void FloatMultiplyDoubleNode::execute() {
     float a = inputs[0]->getValue<float>();
-    long double b = inputs[1]->getValue<long double>();
-    outputs[0]->setValue(static_cast<long double>(a) * b);
+    Real b = inputs[1]->getValue<Real>();
+    outputs[0]->setValue(static_cast<Real>(a) * b);
 }
 
 std::string FloatMultiplyDoubleNode::getNodeType() const {
     return "FloatMultiplyDoubleNode";
 }
+REGISTER_NODE_TYPE(FloatMultiplyDoubleNode);
 
 FloatMultiplyFloatNode::FloatMultiplyFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::FLOAT, "A"));
@@ -1348,6 +1410,7 @@ void FloatMultiplyFloatNode::execute() {
 std::string FloatMultiplyFloatNode::getNodeType() const {
     return "FloatMultiplyFloatNode";
 }
+REGISTER_NODE_TYPE(FloatMultiplyFloatNode);
 
 DoubleMinusIntNode::DoubleMinusIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1359,14 +1422,15 @@ DoubleMinusIntNode::DoubleMinusIntNode(const std::string& guid, BlueprintManager
 }
 
 void DoubleMinusIntNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     int b = inputs[1]->getValue<int>();
-    outputs[0]->setValue(a - static_cast<long double>(b));
+    outputs[0]->setValue(a - static_cast<Real>(b));
 }
 
 std::string DoubleMinusIntNode::getNodeType() const {
     return "DoubleMinusIntNode";
 }
+REGISTER_NODE_TYPE(DoubleMinusIntNode);
 
 DoubleMinusDoubleNode::DoubleMinusDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1378,14 +1442,15 @@ DoubleMinusDoubleNode::DoubleMinusDoubleNode(const std::string& guid, BlueprintM
 }
 
 void DoubleMinusDoubleNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a - b);
 }
 
 std::string DoubleMinusDoubleNode::getNodeType() const {
     return "DoubleMinusDoubleNode";
 }
+REGISTER_NODE_TYPE(DoubleMinusDoubleNode);
 
 DoubleMinusFloatNode::DoubleMinusFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "-", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1397,14 +1462,15 @@ DoubleMinusFloatNode::DoubleMinusFloatNode(const std::string& guid, BlueprintMan
 }
 
 void DoubleMinusFloatNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     float b = inputs[1]->getValue<float>();
-    outputs[0]->setValue(a - static_cast<long double>(b));
+    outputs[0]->setValue(a - static_cast<Real>(b));
 }
 
 std::string DoubleMinusFloatNode::getNodeType() const {
     return "DoubleMinusFloatNode";
 }
+REGISTER_NODE_TYPE(DoubleMinusFloatNode);
 
 DoublePlusIntNode::DoublePlusIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1416,14 +1482,15 @@ DoublePlusIntNode::DoublePlusIntNode(const std::string& guid, BlueprintManager*
 }
 
 void DoublePlusIntNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     int b = inputs[1]->getValue<int>();
-    outputs[0]->setValue(a + static_cast<long double>(b));
+    outputs[0]->setValue(a + static_cast<Real>(b));
 }
 
 std::string DoublePlusIntNode::getNodeType() const {
     return "DoublePlusIntNode";
 }
+REGISTER_NODE_TYPE(DoublePlusIntNode);
 
 DoublePlusDoubleNode::DoublePlusDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1435,14 +1502,15 @@ DoublePlusDoubleNode::DoublePlusDoubleNode(const std::string& guid, BlueprintMan
 }
 
 void DoublePlusDoubleNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a + b);
 }
 
 std::string DoublePlusDoubleNode::getNodeType() const {
     return "DoublePlusDoubleNode";
 }
+REGISTER_NODE_TYPE(DoublePlusDoubleNode);
 
 DoublePlusFloatNode::DoublePlusFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "+", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1454,14 +1522,15 @@ DoublePlusFloatNode::DoublePlusFloatNode(const std::string& guid, BlueprintManag
 }
 
 void DoublePlusFloatNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     float b = inputs[1]->getValue<float>();
-    outputs[0]->setValue(a + static_cast<long double>(b));
+    outputs[0]->setValue(a + static_cast<Real>(b));
 }
 
 std::string DoublePlusFloatNode::getNodeType() const {
     return "DoublePlusFloatNode";
 }
+REGISTER_NODE_TYPE(DoublePlusFloatNode);
 
 DoubleDivideIntNode::DoubleDivideIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1473,10 +1542,10 @@ DoubleDivideIntNode::DoubleDivideIntNode(const std::string& guid, BlueprintManag
 }
 
 void DoubleDivideIntNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     int b = inputs[1]->getValue<int>();
     if (b != 0) {
-        outputs[0]->setValue(a / static_cast<long double>(b));
+        outputs[0]->setValue(a / static_cast<Real>(b));
     }
     else {
         outputs[0]->setValue(0.0);
@@ -1486,6 +1555,7 @@ void DoubleDivideIntNode::execute() {
 std::string DoubleDivideIntNode::getNodeType() const {
     return "DoubleDivideIntNode";
 }
+REGISTER_NODE_TYPE(DoubleDivideIntNode);
 
 DoubleDivideDoubleNode::DoubleDivideDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1496,8 +1566,8 @@ DoubleDivideDoubleNode::DoubleDivideDoubleNode(const std::string& guid, Blueprin
     size = ImVec2(90, 80);
 }
 void DoubleDivideDoubleNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     if (b != 0.0) {
         outputs[0]->setValue(a / b);
     }
@@ -1509,6 +1579,7 @@ void DoubleDivideDoubleNode::execute() {
 std::string DoubleDivideDoubleNode::getNodeType() const {
     return "DoubleDivideDoubleNode";
 }
+REGISTER_NODE_TYPE(DoubleDivideDoubleNode);
 
 DoubleDivideFloatNode::DoubleDivideFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "/", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1519,10 +1590,10 @@ DoubleDivideFloatNode::DoubleDivideFloatNode(const std::string& guid, BlueprintM
     size = ImVec2(90, 80);
 }
 void DoubleDivideFloatNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     float b = inputs[1]->getValue<float>();
     if (b != 0.0f) {
-        outputs[0]->setValue(a / static_cast<long double>(b));
+        outputs[0]->setValue(a / static_cast<Real>(b));
     }
     else {
         outputs[0]->setValue(0.0);
@@ -1532,6 +1603,7 @@ void DoubleDivideFloatNode::execute() {
 std::string DoubleDivideFloatNode::getNodeType() const {
     return "DoubleDivideFloatNode";
 }
+REGISTER_NODE_TYPE(DoubleDivideFloatNode);
 
 DoubleMultiplyIntNode::DoubleMultiplyIntNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1543,14 +1615,15 @@ DoubleMultiplyIntNode::DoubleMultiplyIntNode(const std::string& guid, BlueprintM
 }
 
 void DoubleMultiplyIntNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     int b = inputs[1]->getValue<int>();
-    outputs[0]->setValue(a * static_cast<long double>(b));
+    outputs[0]->setValue(a * static_cast<Real>(b));
 }
 
 std::string DoubleMultiplyIntNode::getNodeType() const {
     return "DoubleMultiplyIntNode";
 }
+REGISTER_NODE_TYPE(DoubleMultiplyIntNode);
 
 DoubleMultiplyDoubleNode::DoubleMultiplyDoubleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1562,14 +1635,15 @@ DoubleMultiplyDoubleNode::DoubleMultiplyDoubleNode(const std::string& guid, Blue
 }
 
 void DoubleMultiplyDoubleNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
-    long double b = inputs[1]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
+    Real b = inputs[1]->getValue<Real>();
     outputs[0]->setValue(a * b);
 }
 
 std::string DoubleMultiplyDoubleNode::getNodeType() const {
     return "DoubleMultiplyDoubleNode";
 }
+REGISTER_NODE_TYPE(DoubleMultiplyDoubleNode);
 
 DoubleMultiplyFloatNode::DoubleMultiplyFloatNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "A"));
@@ -1581,14 +1655,15 @@ DoubleMultiplyFloatNode::DoubleMultiplyFloatNode(const std::string& guid, Bluepr
 }
 
 void DoubleMultiplyFloatNode::execute() {
-    long double a = inputs[0]->getValue<long double>();
+    Real a = inputs[0]->getValue<Real>();
     float b = inputs[1]->getValue<float>();
-    outputs[0]->setValue(a * static_cast<long double>(b));
+    outputs[0]->setValue(a * static_cast<Real>(b));
 }
 
 std::string DoubleMultiplyFloatNode::getNodeType() const {
     return "DoubleMultiplyFloatNode";
 }
+REGISTER_NODE_TYPE(DoubleMultiplyFloatNode);
 
 TextAppendNode::TextAppendNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "*", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::STRING, "A"));
@@ -1609,6 +1684,7 @@ void TextAppendNode::execute() {
 std::string TextAppendNode::getNodeType() const {
     return "TextAppendNode";
 }
+REGISTER_NODE_TYPE(TextAppendNode);
 
 nlohmann::json TextAppendNode::serializeData() const
 {
@@ -1637,7 +1713,7 @@ GetIntArrayElementNode::GetIntArrayElementNode(const std::string& guid, Blueprin
 }
 
 void GetIntArrayElementNode::execute() {
-    std::vector<int>* Array = inputs[0]->getValue<std::vector<int>*>();
+    ArrayValue<int>* Array = inputs[0]->getValue<ArrayValue<int>*>();
     int Index = inputs[1]->getValue<int>();
     if (Array && Index >= 0 && Index < Array->size())
     {
@@ -1650,6 +1726,7 @@ void GetIntArrayElementNode::execute() {
 std::string GetIntArrayElementNode::getNodeType() const {
     return "GetIntArrayElementNode";
 }
+REGISTER_NODE_TYPE(GetIntArrayElementNode);
 
 AddIntArrayElementNode::AddIntArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add Int Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1666,7 +1743,7 @@ AddIntArrayElementNode::AddIntArrayElementNode(const std::string& guid, Blueprin
 }
 
 void AddIntArrayElementNode::execute() {
-    std::vector<int>* Array = inputs[1]->getValue<std::vector<int>*>();
+    ArrayValue<int>* Array = inputs[1]->getValue<ArrayValue<int>*>();
     if (Array)
     {
         Array->push_back(inputs[2]->getValue<int>());
@@ -1686,6 +1763,7 @@ void AddIntArrayElementNode::execute() {
 std::string AddIntArrayElementNode::getNodeType() const {
     return "AddIntArrayElementNode";
 }
+REGISTER_NODE_TYPE(AddIntArrayElementNode);
 
 SizeIntArrayElementNode::SizeIntArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Size", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_INT, "Array"));
@@ -1699,7 +1777,7 @@ SizeIntArrayElementNode::SizeIntArrayElementNode(const std::string& guid, Bluepr
 }
 
 void SizeIntArrayElementNode::execute() {
-    std::vector<int>* Array = inputs[0]->getValue<std::vector<int>*>();
+    ArrayValue<int>* Array = inputs[0]->getValue<ArrayValue<int>*>();
     if (Array) {
         outputs[0]->setValue((int)Array->size());
     }
@@ -1708,6 +1786,7 @@ void SizeIntArrayElementNode::execute() {
 std::string SizeIntArrayElementNode::getNodeType() const {
     return "SizeIntArrayElementNode";
 }
+REGISTER_NODE_TYPE(SizeIntArrayElementNode);
 
 ClearIntArrayElementNode::ClearIntArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Clear Array", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1722,7 +1801,7 @@ ClearIntArrayElementNode::ClearIntArrayElementNode(const std::string& guid, Blue
 }
 
 void ClearIntArrayElementNode::execute() {
-    std::vector<int>* Array = inputs[1]->getValue<std::vector<int>*>();
+    ArrayValue<int>* Array = inputs[1]->getValue<ArrayValue<int>*>();
     if (Array) {
         Array->clear();
     }
@@ -1739,6 +1818,7 @@ void ClearIntArrayElementNode::execute() {
 std::string ClearIntArrayElementNode::getNodeType() const {
     return "ClearIntArrayElementNode";
 }
+REGISTER_NODE_TYPE(ClearIntArrayElementNode);
 
 RemoveIntArrayElementNode::RemoveIntArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Remove Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1754,11 +1834,11 @@ RemoveIntArrayElementNode::RemoveIntArrayElementNode(const std::string& guid, Bl
 }
 
 void RemoveIntArrayElementNode::execute() {
-    std::vector<int>* Array = inputs[1]->getValue<std::vector<int>*>();
+    ArrayValue<int>* Array = inputs[1]->getValue<ArrayValue<int>*>();
     int Index = inputs[2]->getValue<int>();
 
     if (Array && Index >= 0 && Index < Array->size()) {
-        Array->erase(Array->begin() + Index);
+        Array->erase(Index);
     }
 
     if (!outputs[0]->connected_pins.empty()) {
@@ -1773,6 +1853,46 @@ void RemoveIntArrayElementNode::execute() {
 std::string RemoveIntArrayElementNode::getNodeType() const {
     return "RemoveIntArrayElementNode";
 }
+REGISTER_NODE_TYPE(RemoveIntArrayElementNode);
+
+WindowIntArrayElementNode::WindowIntArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Set Window", dManager) {
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_INT, "Array"));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Size"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+
+    inputs[2]->setDefaultValue<int>(100);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(150, 110);
+    description = "Turns the array into a rolling window of the last Size elements.\n"
+        "Adding to a full window overwrites the oldest element without allocating.\n"
+        "Index 0 is the oldest element. Size 0 removes the limit.";
+}
+
+void WindowIntArrayElementNode::execute() {
+    ArrayValue<int>* Array = inputs[1]->getValue<ArrayValue<int>*>();
+    int Size = inputs[2]->getValue<int>();
+
+    if (Array && Size >= 0 && Array->window() != (size_t)Size) {
+        Array->setWindow(Size);
+    }
+
+    if (!outputs[0]->connected_pins.empty()) {
+        for (auto* connected_pin : outputs[0]->connected_pins) {
+            if (connected_pin->owner && !connected_pin->owner->isPure()) {
+                static_cast<ExecNode*>(connected_pin->owner)->execute();
+            }
+        }
+    }
+}
+
+std::string WindowIntArrayElementNode::getNodeType() const {
+    return "WindowIntArrayElementNode";
+}
+REGISTER_NODE_TYPE(WindowIntArrayElementNode);
 
 GetFloatArrayElementNode::GetFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Float Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_FLOAT, "Array"));
@@ -1787,7 +1907,7 @@ GetFloatArrayElementNode::GetFloatArrayElementNode(const std::string& guid, Blue
 }
 
 void GetFloatArrayElementNode::execute() {
-    std::vector<float>* Array = inputs[0]->getValue<std::vector<float>*>();
+    ArrayValue<float>* Array = inputs[0]->getValue<ArrayValue<float>*>();
     int Index = inputs[1]->getValue<int>();
     if (Array && Index >= 0 && Index < Array->size())
     {
@@ -1800,6 +1920,7 @@ void GetFloatArrayElementNode::execute() {
 std::string GetFloatArrayElementNode::getNodeType() const {
     return "GetFloatArrayElementNode";
 }
+REGISTER_NODE_TYPE(GetFloatArrayElementNode);
 
 AddFloatArrayElementNode::AddFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add Float Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1816,7 +1937,7 @@ AddFloatArrayElementNode::AddFloatArrayElementNode(const std::string& guid, Blue
 }
 
 void AddFloatArrayElementNode::execute() {
-    std::vector<float>* Array = inputs[1]->getValue<std::vector<float>*>();
+    ArrayValue<float>* Array = inputs[1]->getValue<ArrayValue<float>*>();
     if (Array)
     {
         Array->push_back(inputs[2]->getValue<float>());
@@ -1836,6 +1957,7 @@ void AddFloatArrayElementNode::execute() {
 std::string AddFloatArrayElementNode::getNodeType() const {
     return "AddFloatArrayElementNode";
 }
+REGISTER_NODE_TYPE(AddFloatArrayElementNode);
 
 SizeFloatArrayElementNode::SizeFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Size", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_FLOAT, "Array"));
@@ -1849,7 +1971,7 @@ SizeFloatArrayElementNode::SizeFloatArrayElementNode(const std::string& guid, Bl
 }
 
 void SizeFloatArrayElementNode::execute() {
-    std::vector<float>* Array = inputs[0]->getValue<std::vector<float>*>();
+    ArrayValue<float>* Array = inputs[0]->getValue<ArrayValue<float>*>();
     if (Array) {
         outputs[0]->setValue((int)Array->size());
     }
@@ -1858,6 +1980,7 @@ void SizeFloatArrayElementNode::execute() {
 std::string SizeFloatArrayElementNode::getNodeType() const {
     return "SizeFloatArrayElementNode";
 }
+REGISTER_NODE_TYPE(SizeFloatArrayElementNode);
 
 ClearFloatArrayElementNode::ClearFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Clear Array", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1872,7 +1995,7 @@ ClearFloatArrayElementNode::ClearFloatArrayElementNode(const std::string& guid,
 }
 
 void ClearFloatArrayElementNode::execute() {
-    std::vector<float>* Array = inputs[1]->getValue<std::vector<float>*>();
+    ArrayValue<float>* Array = inputs[1]->getValue<ArrayValue<float>*>();
     if (Array) {
         Array->clear();
     }
@@ -1889,6 +2012,7 @@ void ClearFloatArrayElementNode::execute() {
 std::string ClearFloatArrayElementNode::getNodeType() const {
     return "ClearFloatArrayElementNode";
 }
+REGISTER_NODE_TYPE(ClearFloatArrayElementNode);
 
 RemoveFloatArrayElementNode::RemoveFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Remove Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1904,11 +2028,11 @@ RemoveFloatArrayElementNode::RemoveFloatArrayElementNode(const std::string& guid
 }
 
 void RemoveFloatArrayElementNode::execute() {
-    std::vector<float>* Array = inputs[1]->getValue<std::vector<float>*>();
+    ArrayValue<float>* Array = inputs[1]->getValue<ArrayValue<float>*>();
     int Index = inputs[2]->getValue<int>();
 
     if (Array && Index >= 0 && Index < Array->size()) {
-        Array->erase(Array->begin() + Index);
+        Array->erase(Index);
     }
 
     if (!outputs[0]->connected_pins.empty()) {
@@ -1923,6 +2047,46 @@ void RemoveFloatArrayElementNode::execute() {
 std::string RemoveFloatArrayElementNode::getNodeType() const {
     return "RemoveFloatArrayElementNode";
 }
+REGISTER_NODE_TYPE(RemoveFloatArrayElementNode);
+
+WindowFloatArrayElementNode::WindowFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Set Window", dManager) {
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_FLOAT, "Array"));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Size"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+
+    inputs[2]->setDefaultValue<int>(100);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(150, 110);
+    description = "Turns the array into a rolling window of the last Size elements.\n"
+        "Adding to a full window overwrites the oldest element without allocating.\n"
+        "Index 0 is the oldest element. Size 0 removes the limit.";
+}
+
+void WindowFloatArrayElementNode::execute() {
+    ArrayValue<float>* Array = inputs[1]->getValue<ArrayValue<float>*>();
+    int Size = inputs[2]->getValue<int>();
+
+    if (Array && Size >= 0 && Array->window() != (size_t)Size) {
+        Array->setWindow(Size);
+    }
+
+    if (!outputs[0]->connected_pins.empty()) {
+        for (auto* connected_pin : outputs[0]->connected_pins) {
+            if (connected_pin->owner && !connected_pin->owner->isPure()) {
+                static_cast<ExecNode*>(connected_pin->owner)->execute();
+            }
+        }
+    }
+}
+
+std::string WindowFloatArrayElementNode::getNodeType() const {
+    return "WindowFloatArrayElementNode";
+}
+REGISTER_NODE_TYPE(WindowFloatArrayElementNode);
 
 GetDoubleArrayElementNode::GetDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Double Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_DOUBLE, "Array"));
@@ -1937,19 +2101,20 @@ GetDoubleArrayElementNode::GetDoubleArrayElementNode(const std::string& guid, Bl
 }
 
 void GetDoubleArrayElementNode::execute() {
-    std::vector<long double>* Array = inputs[0]->getValue<std::vector<long double>*>();
+    ArrayValue<Real>* Array = inputs[0]->getValue<ArrayValue<Real>*>();
     int Index = inputs[1]->getValue<int>();
     if (Array && Index >= 0 && Index < Array->size())
     {
         auto value = Array->at(Index);
         outputs[0]->setValue(value);
     }
-    else outputs[0]->setValue(0.0L);
+    else outputs[0]->setValue(0.0);
 }
 
 std::string GetDoubleArrayElementNode::getNodeType() const {
     return "GetDoubleArrayElementNode";
 }
+REGISTER_NODE_TYPE(GetDoubleArrayElementNode);
 
 AddDoubleArrayElementNode::AddDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add Double Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -1966,10 +2131,10 @@ AddDoubleArrayElementNode::AddDoubleArrayElementNode(const std::string& guid, Bl
 }
 
 void AddDoubleArrayElementNode::execute() {
-    std::vector<long double>* Array = inputs[1]->getValue<std::vector<long double>*>();
+    ArrayValue<Real>* Array = inputs[1]->getValue<ArrayValue<Real>*>();
     if (Array)
     {
-        Array->push_back(inputs[2]->getValue<long double>());
+        Array->push_back(inputs[2]->getValue<Real>());
         int lastIndex = Array->size() - 1;
         outputs[1]->setValue(lastIndex);
     }
@@ -1986,6 +2151,7 @@ void AddDoubleArrayElementNode::execute() {
 std::string AddDoubleArrayElementNode::getNodeType() const {
     return "AddDoubleArrayElementNode";
 }
+REGISTER_NODE_TYPE(AddDoubleArrayElementNode);
 
 SizeDoubleArrayElementNode::SizeDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Size", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_DOUBLE, "Array"));
@@ -1999,7 +2165,7 @@ SizeDoubleArrayElementNode::SizeDoubleArrayElementNode(const std::string& guid,
 }
 
 void SizeDoubleArrayElementNode::execute() {
-    std::vector<long double>* Array = inputs[0]->getValue<std::vector<long double>*>();
+    ArrayValue<Real>* Array = inputs[0]->getValue<ArrayValue<Real>*>();
     if (Array) {
         outputs[0]->setValue((int)Array->size());
     }
@@ -2008,6 +2174,7 @@ void SizeDoubleArrayElementNode::execute() {
 std::string SizeDoubleArrayElementNode::getNodeType() const {
     return "SizeDoubleArrayElementNode";
 }
+REGISTER_NODE_TYPE(SizeDoubleArrayElementNode);
 
 ClearDoubleArrayElementNode::ClearDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Clear Array", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2022,7 +2189,7 @@ ClearDoubleArrayElementNode::ClearDoubleArrayElementNode(const std::string& guid
 }
 
 void ClearDoubleArrayElementNode::execute() {
-    std::vector<long double>* Array = inputs[1]->getValue<std::vector<long double>*>();
+    ArrayValue<Real>* Array = inputs[1]->getValue<ArrayValue<Real>*>();
     if (Array) {
         Array->clear();
     }
@@ -2039,6 +2206,7 @@ void ClearDoubleArrayElementNode::execute() {
 std::string ClearDoubleArrayElementNode::getNodeType() const {
     return "ClearDoubleArrayElementNode";
 }
+REGISTER_NODE_TYPE(ClearDoubleArrayElementNode);
 
 RemoveDoubleArrayElementNode::RemoveDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Remove Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2054,11 +2222,11 @@ RemoveDoubleArrayElementNode::RemoveDoubleArrayElementNode(const std::string& gu
 }
 
 void RemoveDoubleArrayElementNode::execute() {
-    std::vector<long double>* Array = inputs[1]->getValue<std::vector<long double>*>();
+    ArrayValue<Real>* Array = inputs[1]->getValue<ArrayValue<Real>*>();
     int Index = inputs[2]->getValue<int>();
 
     if (Array && Index >= 0 && Index < Array->size()) {
-        Array->erase(Array->begin() + Index);
+        Array->erase(Index);
     }
 
     if (!outputs[0]->connected_pins.empty()) {
@@ -2073,6 +2241,46 @@ void RemoveDoubleArrayElementNode::execute() {
 std::string RemoveDoubleArrayElementNode::getNodeType() const {
     return "RemoveDoubleArrayElementNode";
 }
+REGISTER_NODE_TYPE(RemoveDoubleArrayElementNode);
+
+WindowDoubleArrayElementNode::WindowDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Set Window", dManager) {
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_DOUBLE, "Array"));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Size"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+
+    inputs[2]->setDefaultValue<int>(100);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(150, 110);
+    description = "Turns the array into a rolling window of the last Size elements.\n"
+        "Adding to a full window overwrites the oldest element without allocating.\n"
+        "Index 0 is the oldest element. Size 0 removes the limit.";
+}
+
+void WindowDoubleArrayElementNode::execute() {
+    ArrayValue<Real>* Array = inputs[1]->getValue<ArrayValue<Real>*>();
+    int Size = inputs[2]->getValue<int>();
+
+    if (Array && Size >= 0 && Array->window() != (size_t)Size) {
+        Array->setWindow(Size);
+    }
+
+    if (!outputs[0]->connected_pins.empty()) {
+        for (auto* connected_pin : outputs[0]->connected_pins) {
+            if (connected_pin->owner && !connected_pin->owner->isPure()) {
+                static_cast<ExecNode*>(connected_pin->owner)->execute();
+            }
+        }
+    }
+}
+
+std::string WindowDoubleArrayElementNode::getNodeType() const {
+    return "WindowDoubleArrayElementNode";
+}
+REGISTER_NODE_TYPE(WindowDoubleArrayElementNode);
 
 GetBoolArrayElementNode::GetBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Bool Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_BOOL, "Array"));
@@ -2087,7 +2295,7 @@ GetBoolArrayElementNode::GetBoolArrayElementNode(const std::string& guid, Bluepr
 }
 
 void GetBoolArrayElementNode::execute() {
-    std::vector<bool>* Array = inputs[0]->getValue<std::vector<bool>*>();
+    ArrayValue<bool>* Array = inputs[0]->getValue<ArrayValue<bool>*>();
     int Index = inputs[1]->getValue<int>();
     if (Array && Index >= 0 && Index < Array->size())
     {
@@ -2100,6 +2308,7 @@ void GetBoolArrayElementNode::execute() {
 std::string GetBoolArrayElementNode::getNodeType() const {
     return "GetBoolArrayElementNode";
 }
+REGISTER_NODE_TYPE(GetBoolArrayElementNode);
 
 AddBoolArrayElementNode::AddBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add Bool Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2116,7 +2325,7 @@ AddBoolArrayElementNode::AddBoolArrayElementNode(const std::string& guid, Bluepr
 }
 
 void AddBoolArrayElementNode::execute() {
-    std::vector<bool>* Array = inputs[1]->getValue<std::vector<bool>*>();
+    ArrayValue<bool>* Array = inputs[1]->getValue<ArrayValue<bool>*>();
     if (Array)
     {
         Array->push_back(inputs[2]->getValue<bool>());
@@ -2136,6 +2345,7 @@ void AddBoolArrayElementNode::execute() {
 std::string AddBoolArrayElementNode::getNodeType() const {
     return "AddBoolArrayElementNode";
 }
+REGISTER_NODE_TYPE(AddBoolArrayElementNode);
 
 SizeBoolArrayElementNode::SizeBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Size", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_BOOL, "Array"));
@@ -2149,7 +2359,7 @@ SizeBoolArrayElementNode::SizeBoolArrayElementNode(const std::string& guid, Blue
 }
 
 void SizeBoolArrayElementNode::execute() {
-    std::vector<bool>* Array = inputs[0]->getValue<std::vector<bool>*>();
+    ArrayValue<bool>* Array = inputs[0]->getValue<ArrayValue<bool>*>();
     if (Array) {
         outputs[0]->setValue((int)Array->size());
     }
@@ -2158,6 +2368,7 @@ void SizeBoolArrayElementNode::execute() {
 std::string SizeBoolArrayElementNode::getNodeType() const {
     return "SizeBoolArrayElementNode";
 }
+REGISTER_NODE_TYPE(SizeBoolArrayElementNode);
 
 ClearBoolArrayElementNode::ClearBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Clear Array", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2172,7 +2383,7 @@ ClearBoolArrayElementNode::ClearBoolArrayElementNode(const std::string& guid, Bl
 }
 
 void ClearBoolArrayElementNode::execute() {
-    std::vector<bool>* Array = inputs[1]->getValue<std::vector<bool>*>();
+    ArrayValue<bool>* Array = inputs[1]->getValue<ArrayValue<bool>*>();
     if (Array) {
         Array->clear();
     }
@@ -2189,6 +2400,7 @@ void ClearBoolArrayElementNode::execute() {
 std::string ClearBoolArrayElementNode::getNodeType() const {
     return "ClearBoolArrayElementNode";
 }
+REGISTER_NODE_TYPE(ClearBoolArrayElementNode);
 
 RemoveBoolArrayElementNode::RemoveBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Remove Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2204,11 +2416,11 @@ RemoveBoolArrayElementNode::RemoveBoolArrayElementNode(const std::string& guid,
 }
 
 void RemoveBoolArrayElementNode::execute() {
-    std::vector<bool>* Array = inputs[1]->getValue<std::vector<bool>*>();
+    ArrayValue<bool>* Array = inputs[1]->getValue<ArrayValue<bool>*>();
     int Index = inputs[2]->getValue<int>();
 
     if (Array && Index >= 0 && Index < Array->size()) {
-        Array->erase(Array->begin() + Index);
+        Array->erase(Index);
     }
 
     if (!outputs[0]->connected_pins.empty()) {
@@ -2223,6 +2435,46 @@ void RemoveBoolArrayElementNode::execute() {
 std::string RemoveBoolArrayElementNode::getNodeType() const {
     return "RemoveBoolArrayElementNode";
 }
+REGISTER_NODE_TYPE(RemoveBoolArrayElementNode);
+
+WindowBoolArrayElementNode::WindowBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Set Window", dManager) {
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_BOOL, "Array"));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Size"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+
+    inputs[2]->setDefaultValue<int>(100);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(150, 110);
+    description = "Turns the array into a rolling window of the last Size elements.\n"
+        "Adding to a full window overwrites the oldest element without allocating.\n"
+        "Index 0 is the oldest element. Size 0 removes the limit.";
+}
+
+void WindowBoolArrayElementNode::execute() {
+    ArrayValue<bool>* Array = inputs[1]->getValue<ArrayValue<bool>*>();
+    int Size = inputs[2]->getValue<int>();
+
+    if (Array && Size >= 0 && Array->window() != (size_t)Size) {
+        Array->setWindow(Size);
+    }
+
+    if (!outputs[0]->connected_pins.empty()) {
+        for (auto* connected_pin : outputs[0]->connected_pins) {
+            if (connected_pin->owner && !connected_pin->owner->isPure()) {
+                static_cast<ExecNode*>(connected_pin->owner)->execute();
+            }
+        }
+    }
+}
+
+std::string WindowBoolArrayElementNode::getNodeType() const {
+    return "WindowBoolArrayElementNode";
+}
+REGISTER_NODE_TYPE(WindowBoolArrayElementNode);
 
 GetStringArrayElementNode::GetStringArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get String Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_STRING, "Array"));
@@ -2237,7 +2489,7 @@ GetStringArrayElementNode::GetStringArrayElementNode(const std::string& guid, Bl
 }
 
 void GetStringArrayElementNode::execute() {
-    std::vector<std::string>* Array = inputs[0]->getValue<std::vector<std::string>*>();
+    ArrayValue<std::string>* Array = inputs[0]->getValue<ArrayValue<std::string>*>();
     int Index = inputs[1]->getValue<int>();
     if (Array && Index >= 0 && Index < Array->size())
     {
@@ -2250,6 +2502,7 @@ void GetStringArrayElementNode::execute() {
 std::string GetStringArrayElementNode::getNodeType() const {
     return "GetStringArrayElementNode";
 }
+REGISTER_NODE_TYPE(GetStringArrayElementNode);
 
 AddStringArrayElementNode::AddStringArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add String Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2266,7 +2519,7 @@ AddStringArrayElementNode::AddStringArrayElementNode(const std::string& guid, Bl
 }
 
 void AddStringArrayElementNode::execute() {
-    std::vector<std::string>* Array = inputs[1]->getValue<std::vector<std::string>*>();
+    ArrayValue<std::string>* Array = inputs[1]->getValue<ArrayValue<std::string>*>();
     if (Array)
     {
         Array->push_back(inputs[2]->getValue<std::string>());
@@ -2286,6 +2539,7 @@ void AddStringArrayElementNode::execute() {
 std::string AddStringArrayElementNode::getNodeType() const {
     return "AddStringArrayElementNode";
 }
+REGISTER_NODE_TYPE(AddStringArrayElementNode);
 
 SizeStringArrayElementNode::SizeStringArrayElementNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Size", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_STRING, "Array"));
@@ -2299,7 +2553,7 @@ SizeStringArrayElementNode::SizeStringArrayElementNode(const std::string& guid,
 }
 
 void SizeStringArrayElementNode::execute() {
-    std::vector<std::string>* Array = inputs[0]->getValue<std::vector<std::string>*>();
+    ArrayValue<std::string>* Array = inputs[0]->getValue<ArrayValue<std::string>*>();
     if (Array) {
         outputs[0]->setValue((int)Array->size());
     }
@@ -2308,6 +2562,7 @@ void SizeStringArrayElementNode::execute() {
 std::string SizeStringArrayElementNode::getNodeType() const {
     return "SizeStringArrayElementNode";
 }
+REGISTER_NODE_TYPE(SizeStringArrayElementNode);
 
 ClearStringArrayElementNode::ClearStringArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Clear Array", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2322,7 +2577,7 @@ ClearStringArrayElementNode::ClearStringArrayElementNode(const std::string& guid
 }
 
 void ClearStringArrayElementNode::execute() {
-    std::vector<std::string>* Array = inputs[1]->getValue<std::vector<std::string>*>();
+    ArrayValue<std::string>* Array = inputs[1]->getValue<ArrayValue<std::string>*>();
     if (Array) {
         Array->clear();
     }
@@ -2339,6 +2594,7 @@ void ClearStringArrayElementNode::execute() {
 std::string ClearStringArrayElementNode::getNodeType() const {
     return "ClearStringArrayElementNode";
 }
+REGISTER_NODE_TYPE(ClearStringArrayElementNode);
 
 RemoveStringArrayElementNode::RemoveStringArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Remove Element", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2354,11 +2610,11 @@ RemoveStringArrayElementNode::RemoveStringArrayElementNode(const std::string& gu
 }
 
 void RemoveStringArrayElementNode::execute() {
-    std::vector<std::string>* Array = inputs[1]->getValue<std::vector<std::string>*>();
+    ArrayValue<std::string>* Array = inputs[1]->getValue<ArrayValue<std::string>*>();
     int Index = inputs[2]->getValue<int>();
 
     if (Array && Index >= 0 && Index < Array->size()) {
-        Array->erase(Array->begin() + Index);
+        Array->erase(Index);
     }
 
     if (!outputs[0]->connected_pins.empty()) {
@@ -2373,6 +2629,46 @@ void RemoveStringArrayElementNode::execute() {
 std::string RemoveStringArrayElementNode::getNodeType() const {
     return "RemoveStringArrayElementNode";
 }
+REGISTER_NODE_TYPE(RemoveStringArrayElementNode);
+
+WindowStringArrayElementNode::WindowStringArrayElementNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Set Window", dManager) {
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::ARRAY_STRING, "Array"));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Size"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
+
+    inputs[2]->setDefaultValue<int>(100);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(150, 110);
+    description = "Turns the array into a rolling window of the last Size elements.\n"
+        "Adding to a full window overwrites the oldest element without allocating.\n"
+        "Index 0 is the oldest element. Size 0 removes the limit.";
+}
+
+void WindowStringArrayElementNode::execute() {
+    ArrayValue<std::string>* Array = inputs[1]->getValue<ArrayValue<std::string>*>();
+    int Size = inputs[2]->getValue<int>();
+
+    if (Array && Size >= 0 && Array->window() != (size_t)Size) {
+        Array->setWindow(Size);
+    }
+
+    if (!outputs[0]->connected_pins.empty()) {
+        for (auto* connected_pin : outputs[0]->connected_pins) {
+            if (connected_pin->owner && !connected_pin->owner->isPure()) {
+                static_cast<ExecNode*>(connected_pin->owner)->execute();
+            }
+        }
+    }
+}
+
+std::string WindowStringArrayElementNode::getNodeType() const {
+    return "WindowStringArrayElementNode";
+}
+REGISTER_NODE_TYPE(WindowStringArrayElementNode);
 
 ForLoopNode::ForLoopNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "For Loop", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2417,6 +2713,7 @@ void ForLoopNode::execute() {
 std::string ForLoopNode::getNodeType() const {
     return "ForLoopNode";
 }
+REGISTER_NODE_TYPE(ForLoopNode);
 
 
 AddMarkNode::AddMarkNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add Mark", dManager) {
@@ -2439,7 +2736,7 @@ AddMarkNode::AddMarkNode(const std::string& guid, BlueprintManager* dManager) :
 void AddMarkNode::execute() {
 
     int candle = inputs[1]->getValue<int>();
-    long double price = inputs[2]->getValue<long double>();
+    Real price = inputs[2]->getValue<Real>();
     int R = inputs[3]->getValue<int>();
     int G = inputs[4]->getValue<int>();
     int B = inputs[5]->getValue<int>();
@@ -2460,6 +2757,7 @@ void AddMarkNode::execute() {
 std::string AddMarkNode::getNodeType() const {
     return "AddMarkNode";
 }
+REGISTER_NODE_TYPE(AddMarkNode);
 
 AddLineNode::AddLineNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Add Mark", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -2483,13 +2781,13 @@ AddLineNode::AddLineNode(const std::string& guid, BlueprintManager* dManager) :
 void AddLineNode::execute() {
 
     int candle = inputs[1]->getValue<int>();
-    long double price = inputs[2]->getValue<long double>();
+    Real price = inputs[2]->getValue<Real>();
     int candle2 = inputs[3]->getValue<int>();
-    long double price2 = inputs[4]->getValue<long double>();
+    Real price2 = inputs[4]->getValue<Real>();
     int R = inputs[5]->getValue<int>();
     int G = inputs[6]->getValue<int>();
     int B = inputs[7]->getValue<int>();
-    long double thickness = inputs[8]->getValue<long double>();
+    Real thickness = inputs[8]->getValue<Real>();
 
     if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetChart())
         blueprintManager->GetDataManager()->GetChart()->addTradingLine(candle, price, candle2, price2, IM_COL32(R,G,B,255), thickness);
@@ -2506,6 +2804,7 @@ void AddLineNode::execute() {
 std::string AddLineNode::getNodeType() const {
     return "AddLineNode";
 }
+REGISTER_NODE_TYPE(AddLineNode);
 
 GetCurrentCandleDataNode::GetCurrentCandleDataNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Current Candle", dManager) {
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::INT, "Index"));
@@ -2526,7 +2825,7 @@ GetCurrentCandleDataNode::GetCurrentCandleDataNode(const std::string& guid, Blue
 
 void GetCurrentCandleDataNode::execute() {
 
-    if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetChart())
+    if (blueprintManager && blueprintManager->GetDataManager())
     {
         if(blueprintManager->GetDataManager()->getPublicData().size() > 0)
         {
@@ -2544,11 +2843,11 @@ void GetCurrentCandleDataNode::execute() {
         else
         {
             outputs[0]->setValue(0);
-            outputs[1]->setValue(0.0L);
-            outputs[2]->setValue(0.0L);
-            outputs[3]->setValue(0.0L);
-            outputs[4]->setValue(0.0L);
-            outputs[5]->setValue(0.0L);
+            outputs[1]->setValue(0.0);
+            outputs[2]->setValue(0.0);
+            outputs[3]->setValue(0.0);
+            outputs[4]->setValue(0.0);
+            outputs[5]->setValue(0.0);
             outputs[6]->setValue(0.0f);
             outputs[7]->setValue(0.0f);
         }
@@ -2558,6 +2857,7 @@ void GetCurrentCandleDataNode::execute() {
 std::string GetCurrentCandleDataNode::getNodeType() const {
     return "GetCurrentCandleDataNode";
 }
+REGISTER_NODE_TYPE(GetCurrentCandleDataNode);
 
 GetCandleDataAtIndexNode::GetCandleDataAtIndexNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Candle", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Index"));
@@ -2594,11 +2894,11 @@ void GetCandleDataAtIndexNode::execute() {
     else
     {
         outputs[0]->setValue(0);
-        outputs[1]->setValue(0.0L);
-        outputs[2]->setValue(0.0L);
-        outputs[3]->setValue(0.0L);
-        outputs[4]->setValue(0.0L);
-        outputs[5]->setValue(0.0L);
+        outputs[1]->setValue(0.0);
+        outputs[2]->setValue(0.0);
+        outputs[3]->setValue(0.0);
+        outputs[4]->setValue(0.0);
+        outputs[5]->setValue(0.0);
         outputs[6]->setValue(0.0f);
         outputs[7]->setValue(0.0f);
     }
@@ -2607,6 +2907,69 @@ void GetCandleDataAtIndexNode::execute() {
 std::string GetCandleDataAtIndexNode::getNodeType() const {
     return "GetCandleDataAtIndexNode";
 }
+REGISTER_NODE_TYPE(GetCandleDataAtIndexNode);
+
+GetTimeframeCandleNode::GetTimeframeCandleNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Timeframe Candle", dManager) {
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Minutes"));
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Shift"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::BOOL, "Valid"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::INT, "Index"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::INT, "Count"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Open"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "High"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Low"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Close"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::FLOAT, "Volume"));
+
+    inputs[0]->setDefaultValue<int>(60);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(160, 250);
+    description = "Retrieves a higher-timeframe candle built from the loaded candles, without downloading a second series.\n\nMinutes: 5, 15, 60, 240 or 1440. Bars are aligned to UTC like exchange klines.\n\nShift 0 is the newest bar, which is still forming while its period is open; Shift 1 is the last finished bar.\n\nExample: Get Timeframe Candle (Minutes: 60, Shift: 1) gives the last closed hourly candle for a trend filter on 1m entries.\n\nValid is false and values are zero if the timeframe is not supported or the bar does not exist yet.";
+}
+
+void GetTimeframeCandleNode::execute() {
+    int minutes = inputs[0]->getValue<int>();
+    int shift = inputs[1]->getValue<int>();
+
+    CandleSeriesView series;
+    if (blueprintManager && blueprintManager->GetDataManager()) {
+        series = blueprintManager->GetDataManager()->GetTimeframeSeries(minutes);
+    }
+
+    int count = static_cast<int>(series.size());
+    if (shift >= 0 && shift < count)
+    {
+        int index = count - 1 - shift;
+        const MarketData& candle = series[index];
+        outputs[0]->setValue(true);
+        outputs[1]->setValue(index);
+        outputs[2]->setValue(count);
+        outputs[3]->setValue(candle.open);
+        outputs[4]->setValue(candle.high);
+        outputs[5]->setValue(candle.low);
+        outputs[6]->setValue(candle.close);
+        outputs[7]->setValue(candle.volume);
+    }
+    else
+    {
+        outputs[0]->setValue(false);
+        outputs[1]->setValue(0);
+        outputs[2]->setValue(count);
+        outputs[3]->setValue<Real>(0.0);
+        outputs[4]->setValue<Real>(0.0);
+        outputs[5]->setValue<Real>(0.0);
+        outputs[6]->setValue<Real>(0.0);
+        outputs[7]->setValue(0.0f);
+    }
+}
+
+std::string GetTimeframeCandleNode::getNodeType() const {
+    return "GetTimeframeCandleNode";
+}
+REGISTER_NODE_TYPE(GetTimeframeCandleNode);
 
 GetCurrentCandleIndexNode::GetCurrentCandleIndexNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "Get Current Candle Index", dManager) {
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::INT, "Index"));
@@ -2620,7 +2983,7 @@ GetCurrentCandleIndexNode::GetCurrentCandleIndexNode(const std::string& guid, Bl
 
 void GetCurrentCandleIndexNode::execute() {
 
-    if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetChart())
+    if (blueprintManager && blueprintManager->GetDataManager())
     {
         if (blueprintManager->GetDataManager()->getPublicData().size() > 0)
         {
@@ -2634,6 +2997,7 @@ void GetCurrentCandleIndexNode::execute() {
 std::string GetCurrentCandleIndexNode::getNodeType() const {
     return "GetCurrentCandleIndexNode";
 }
+REGISTER_NODE_TYPE(GetCurrentCandleIndexNode);
 
 SMANode::SMANode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "SMA", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Period"));
@@ -2665,12 +3029,25 @@ void SMANode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
 
         if (index == 0) index = blueprintManager->GetDataManager()->getPublicData().size() - 1;
 
+        IndicatorBatch* batch = blueprintManager->GetDataManager()->GetIndicatorBatch();
+        if (batch && index >= 0 && index < (int)candles.size() && index < (int)batch->size()) {
+            outputs[0]->setValue<Real>(batch->sma(period)[index]);
+            return;
+        }
+
         if (index < period - 1 || index >= candles.size() || period <= 0) {
-            outputs[0]->setValue<long double>(0.0);
+            outputs[0]->setValue<Real>(0.0);
+            return;
+        }
+
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::SMA, period, 0, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
             return;
         }
 
@@ -2678,11 +3055,14 @@ void SMANode::execute() {
         for (int i = 0; i < period; i++) {
             sum += candles[index - i].close;
         }
-        outputs[0]->setValue<long double>(sum / period);
+        Real sma = sum / period;
+        cache.insert(key, { sma });
+        outputs[0]->setValue<Real>(sma);
     }
 }
 
 std::string SMANode::getNodeType() const { return "SMANode"; }
+REGISTER_NODE_TYPE(SMANode);
 
 EMANode::EMANode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "EMA", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Period"));
@@ -2706,39 +3086,50 @@ EMANode::EMANode(const std::string& guid, BlueprintManager* dManager) : PureNode
     outputs[0]->description = "Calculated Exponential Moving Average (EMA) value for the current candle.";
 }
 
+// EMA seeded with the SMA of the first `period` candles; shared by EMA and MACD nodes.
+static Real cachedEma(IndicatorCache& cache, const CandleSeriesView& candles, int period, int index) {
+    IndicatorCache::Key key{ IndicatorCache::Kind::EMA, period, 0, index, 0.0 };
+    if (const Real* cached = cache.find(key)) return cached[0];
+
+    Real multiplier = 2.0 / (period + 1);
+
+    Real sum = 0.0;
+    for (int i = 0; i < period; i++) {
+        sum += static_cast<Real>(candles[i].close);
+    }
+    Real ema = sum / static_cast<Real>(period);
+
+    for (int i = period; i <= index; i++) {
+        ema = (static_cast<Real>(candles[i].close) * multiplier) +
+            (ema * (1.0 - multiplier));
+    }
+
+    cache.insert(key, { ema });
+    return ema;
+}
+
 void EMANode::execute() {
     int period = inputs[0]->getValue<int>();
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
             return;
         }
 
-        long double multiplier = 2.0L / (period + 1);
-
-        long double sum = 0.0L;
-        for (int i = 0; i < period; i++) {
-            sum += static_cast<long double>(candles[i].close);
-        }
-        long double ema = sum / static_cast<long double>(period);
-
-        for (int i = period; i <= index; i++) {
-            ema = (static_cast<long double>(candles[i].close) * multiplier) +
-                (ema * (1.0L - multiplier));
-        }
-
-        outputs[0]->setValue<long double>(ema);
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        outputs[0]->setValue<Real>(cachedEma(cache, candles, period, index));
     }
 }
 
 std::string EMANode::getNodeType() const { return "EMANode"; }
+REGISTER_NODE_TYPE(EMANode);
 
 RSINode::RSINode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "RSI", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Period"));
@@ -2770,40 +3161,54 @@ void RSINode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
+        IndicatorBatch* batch = blueprintManager->GetDataManager()->GetIndicatorBatch();
+        if (batch && index >= 0 && index < static_cast<int>(candles.size()) && index < static_cast<int>(batch->size())) {
+            outputs[0]->setValue<Real>(batch->rsi(period)[index]);
+            return;
+        }
+
         if (index < period || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(50.0L);
+            outputs[0]->setValue<Real>(50.0);
             return;
         }
 
-        long double gains = 0.0L, losses = 0.0L;
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::RSI, period, 0, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
+            return;
+        }
+
+        Real gains = 0.0, losses = 0.0;
         for (int i = 1; i <= period; i++) {
-            long double change = static_cast<long double>(candles[index - i + 1].close - candles[index - i].close);
+            Real change = static_cast<Real>(candles[index - i + 1].close - candles[index - i].close);
             if (change > 0)
                 gains += change;
             else
                 losses -= change;
         }
 
-        long double avgGain = gains / static_cast<long double>(period);
-        long double avgLoss = losses / static_cast<long double>(period);
+        Real avgGain = gains / static_cast<Real>(period);
+        Real avgLoss = losses / static_cast<Real>(period);
 
-        if (avgLoss == 0.0L) {
-            outputs[0]->setValue<long double>(100.0L);
-        }
-        else {
-            long double rs = avgGain / avgLoss;
-            outputs[0]->setValue<long double>(100.0L - (100.0L / (1.0L + rs)));
+        Real rsi = 100.0;
+        if (avgLoss != 0.0) {
+            Real rs = avgGain / avgLoss;
+            rsi = 100.0 - (100.0 / (1.0 + rs));
         }
+        cache.insert(key, { rsi });
+        outputs[0]->setValue<Real>(rsi);
     }
 }
 
 
 std::string RSINode::getNodeType() const { return "RSINode"; }
+REGISTER_NODE_TYPE(RSINode);
 
 MACDNode::MACDNode(const std::string& guid, BlueprintManager* dManager) : PureNode(guid, "MACD", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Fast"));
@@ -2844,51 +3249,31 @@ void MACDNode::execute() {
     int index = inputs[2]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < slowPeriod - 1 || index >= static_cast<int>(candles.size()) ||
             fastPeriod <= 0 || slowPeriod <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
-            outputs[1]->setValue<long double>(0.0L);
-            outputs[2]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
+            outputs[1]->setValue<Real>(0.0);
+            outputs[2]->setValue<Real>(0.0);
             return;
         }
 
-        long double fastMultiplier = 2.0L / (fastPeriod + 1);
-        long double slowMultiplier = 2.0L / (slowPeriod + 1);
-
-        long double sumFast = 0.0L;
-        for (int i = 0; i < fastPeriod; i++) {
-            sumFast += static_cast<long double>(candles[i].close);
-        }
-        long double fastEma = sumFast / static_cast<long double>(fastPeriod);
-
-        for (int i = fastPeriod; i <= index; i++) {
-            fastEma = (static_cast<long double>(candles[i].close) * fastMultiplier) +
-                (fastEma * (1.0L - fastMultiplier));
-        }
-
-        long double sumSlow = 0.0L;
-        for (int i = 0; i < slowPeriod; i++) {
-            sumSlow += static_cast<long double>(candles[i].close);
-        }
-        long double slowEma = sumSlow / static_cast<long double>(slowPeriod);
-
-        for (int i = slowPeriod; i <= index; i++) {
-            slowEma = (static_cast<long double>(candles[i].close) * slowMultiplier) +
-                (slowEma * (1.0L - slowMultiplier));
-        }
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        Real fastEma = cachedEma(cache, candles, fastPeriod, index);
+        Real slowEma = cachedEma(cache, candles, slowPeriod, index);
 
-        outputs[0]->setValue<long double>(fastEma - slowEma);
-        outputs[1]->setValue<long double>(fastEma);
-        outputs[2]->setValue<long double>(slowEma);
+        outputs[0]->setValue<Real>(fastEma - slowEma);
+        outputs[1]->setValue<Real>(fastEma);
+        outputs[2]->setValue<Real>(slowEma);
     }
 }
 
 std::string MACDNode::getNodeType() const { return "MACDNode"; }
+REGISTER_NODE_TYPE(MACDNode);
 
 BollingerBandsNode::BollingerBandsNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Bollinger Bands", dManager)
@@ -2901,7 +3286,7 @@ BollingerBandsNode::BollingerBandsNode(const std::string& guid, BlueprintManager
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Lower"));
 
     inputs[0]->setDefaultValue<int>(20);
-    inputs[1]->setDefaultValue<long double>(2.0L);
+    inputs[1]->setDefaultValue<Real>(2.0);
 
     for (auto& pin : inputs) pin->owner = this;
     for (auto& pin : outputs) pin->owner = this;
@@ -2928,43 +3313,66 @@ BollingerBandsNode::BollingerBandsNode(const std::string& guid, BlueprintManager
 
 void BollingerBandsNode::execute() {
     int period = inputs[0]->getValue<int>();
-    long double stdDevMultiplier = inputs[1]->getValue<long double>();
+    Real stdDevMultiplier = inputs[1]->getValue<Real>();
     int index = inputs[2]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
+        IndicatorBatch* batch = blueprintManager->GetDataManager()->GetIndicatorBatch();
+        if (batch && index >= 0 && index < static_cast<int>(candles.size()) && index < static_cast<int>(batch->size())) {
+            const std::vector<double>* bands = batch->bollinger(period, static_cast<double>(stdDevMultiplier));
+            outputs[0]->setValue<Real>(bands[0][index]);
+            outputs[1]->setValue<Real>(bands[1][index]);
+            outputs[2]->setValue<Real>(bands[2][index]);
+            return;
+        }
+
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
-            outputs[1]->setValue<long double>(0.0L);
-            outputs[2]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
+            outputs[1]->setValue<Real>(0.0);
+            outputs[2]->setValue<Real>(0.0);
+            return;
+        }
+
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::BOLLINGER, period, 0, index, stdDevMultiplier };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
+            outputs[1]->setValue<Real>(cached[1]);
+            outputs[2]->setValue<Real>(cached[2]);
             return;
         }
 
-        long double sum = 0.0L;
+        Real sum = 0.0;
         for (int i = 0; i < period; i++) {
-            sum += static_cast<long double>(candles[index - i].close);
+            sum += static_cast<Real>(candles[index - i].close);
         }
-        long double sma = sum / static_cast<long double>(period);
+        Real sma = sum / static_cast<Real>(period);
 
-        long double sumSquaredDiff = 0.0L;
+        Real sumSquaredDiff = 0.0;
         for (int i = 0; i < period; i++) {
-            long double diff = static_cast<long double>(candles[index - i].close) - sma;
+            Real diff = static_cast<Real>(candles[index - i].close) - sma;
             sumSquaredDiff += diff * diff;
         }
-        long double stdDev = sqrt(sumSquaredDiff / static_cast<long double>(period));
+        Real stdDev = sqrt(sumSquaredDiff / static_cast<Real>(period));
+
+        Real upper = sma + (stdDev * stdDevMultiplier);
+        Real lower = sma - (stdDev * stdDevMultiplier);
+        cache.insert(key, { upper, sma, lower });
 
-        outputs[0]->setValue<long double>(sma + (stdDev * stdDevMultiplier));  
-        outputs[1]->setValue<long double>(sma);                                
-        outputs[2]->setValue<long double>(sma - (stdDev * stdDevMultiplier));  
+        outputs[0]->setValue<Real>(upper);
+        outputs[1]->setValue<Real>(sma);
+        outputs[2]->setValue<Real>(lower);
     }
 }
 
 
 std::string BollingerBandsNode::getNodeType() const { return "BollingerBandsNode"; }
+REGISTER_NODE_TYPE(BollingerBandsNode);
 
 StochasticNode::StochasticNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Stochastic", dManager)
@@ -3000,68 +3408,86 @@ StochasticNode::StochasticNode(const std::string& guid, BlueprintManager* dManag
     outputs[1]->description = "Calculated %D value (smoothed %K line) for the current candle.";
 }
 
+// Raw %K at one candle; %D averages the last dPeriod of these, so they are shared through the cache.
+static Real cachedStochasticK(IndicatorCache& cache, const CandleSeriesView& candles, int kPeriod, int index) {
+    IndicatorCache::Key key{ IndicatorCache::Kind::STOCHASTIC_K, kPeriod, 0, index, 0.0 };
+    if (const Real* cached = cache.find(key)) return cached[0];
+
+    Real highestHigh = candles[index].high;
+    Real lowestLow = candles[index].low;
+
+    for (int i = 1; i < kPeriod; i++) {
+        if (candles[index - i].high > highestHigh) highestHigh = candles[index - i].high;
+        if (candles[index - i].low < lowestLow) lowestLow = candles[index - i].low;
+    }
+
+    Real k;
+    if (highestHigh == lowestLow)
+        k = 50.0;
+    else
+        k = ((candles[index].close - lowestLow) / (highestHigh - lowestLow)) * 100.0;
+
+    cache.insert(key, { k });
+    return k;
+}
+
 void StochasticNode::execute() {
     int kPeriod = inputs[0]->getValue<int>();
     int dPeriod = inputs[1]->getValue<int>();
     int index = inputs[2]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
-        if (index < kPeriod - 1 || index >= static_cast<int>(candles.size()) || kPeriod <= 0 || dPeriod <= 0) {
-            outputs[0]->setValue<long double>(50.0L);
-            outputs[1]->setValue<long double>(50.0L);
+        IndicatorBatch* batch = blueprintManager->GetDataManager()->GetIndicatorBatch();
+        if (batch && index >= 0 && index < static_cast<int>(candles.size()) && index < static_cast<int>(batch->size())) {
+            const std::vector<double>* lines = batch->stochastic(kPeriod, dPeriod);
+            outputs[0]->setValue<Real>(lines[0][index]);
+            outputs[1]->setValue<Real>(lines[1][index]);
             return;
         }
 
-        long double highestHigh = candles[index].high;
-        long double lowestLow = candles[index].low;
+        if (index < kPeriod - 1 || index >= static_cast<int>(candles.size()) || kPeriod <= 0 || dPeriod <= 0) {
+            outputs[0]->setValue<Real>(50.0);
+            outputs[1]->setValue<Real>(50.0);
+            return;
+        }
 
-        for (int i = 1; i < kPeriod; i++) {
-            if (candles[index - i].high > highestHigh) highestHigh = candles[index - i].high;
-            if (candles[index - i].low < lowestLow) lowestLow = candles[index - i].low;
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::STOCHASTIC, kPeriod, dPeriod, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
+            outputs[1]->setValue<Real>(cached[1]);
+            return;
         }
 
-        long double k;
-        if (highestHigh == lowestLow)
-            k = 50.0L;
-        else
-            k = ((candles[index].close - lowestLow) / (highestHigh - lowestLow)) * 100.0L;
+        Real k = cachedStochasticK(cache, candles, kPeriod, index);
 
         if (index < kPeriod + dPeriod - 2) {
-            outputs[0]->setValue<long double>(k);
-            outputs[1]->setValue<long double>(50.0L);
+            outputs[0]->setValue<Real>(k);
+            outputs[1]->setValue<Real>(50.0);
             return;
         }
 
-        long double sumK = 0.0L;
+        Real sumK = 0.0;
         for (int i = 0; i < dPeriod; i++) {
-            int currIndex = index - i;
-            long double currHighest = candles[currIndex].high;
-            long double currLowest = candles[currIndex].low;
-
-            for (int j = 1; j < kPeriod; j++) {
-                if (candles[currIndex - j].high > currHighest) currHighest = candles[currIndex - j].high;
-                if (candles[currIndex - j].low < currLowest) currLowest = candles[currIndex - j].low;
-            }
-
-            if (currHighest != currLowest)
-                sumK += ((candles[currIndex].close - currLowest) / (currHighest - currLowest)) * 100.0L;
-            else
-                sumK += 50.0L;
+            sumK += cachedStochasticK(cache, candles, kPeriod, index - i);
         }
+        Real d = sumK / static_cast<Real>(dPeriod);
+        cache.insert(key, { k, d });
 
-        outputs[0]->setValue<long double>(k);
-        outputs[1]->setValue<long double>(sumK / static_cast<long double>(dPeriod));
+        outputs[0]->setValue<Real>(k);
+        outputs[1]->setValue<Real>(d);
     }
 }
 
 
 std::string StochasticNode::getNodeType() const { return "StochasticNode"; }
+REGISTER_NODE_TYPE(StochasticNode);
 
 ATRNode::ATRNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "ATR", dManager)
@@ -3096,35 +3522,44 @@ void ATRNode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
+            return;
+        }
+
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::ATR, period, 0, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
             return;
         }
 
-        long double sum = 0.0L;
+        Real sum = 0.0;
         for (int i = 1; i <= period; i++) {
-            long double high = candles[index - i + 1].high;
-            long double low = candles[index - i + 1].low;
-            long double prevClose = candles[index - i].close;
+            Real high = candles[index - i + 1].high;
+            Real low = candles[index - i + 1].low;
+            Real prevClose = candles[index - i].close;
 
-            long double tr1 = high - low;
-            long double tr2 = fabs(high - prevClose);
-            long double tr3 = fabs(low - prevClose);
+            Real tr1 = high - low;
+            Real tr2 = fabs(high - prevClose);
+            Real tr3 = fabs(low - prevClose);
 
-            long double trueRange = tr1;
+            Real trueRange = tr1;
             if (tr2 > trueRange) trueRange = tr2;
             if (tr3 > trueRange) trueRange = tr3;
 
             sum += trueRange;
         }
 
-        outputs[0]->setValue<long double>(sum / static_cast<long double>(period));
+        Real atr = sum / static_cast<Real>(period);
+        cache.insert(key, { atr });
+        outputs[0]->setValue<Real>(atr);
     }
 }
 
@@ -3132,6 +3567,7 @@ void ATRNode::execute() {
 std::string ATRNode::getNodeType() const { 
     return "ATRNode"; 
 }
+REGISTER_NODE_TYPE(ATRNode);
 
 CCINode::CCINode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "CCI", dManager)
@@ -3165,47 +3601,60 @@ void CCINode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
+        IndicatorBatch* batch = blueprintManager->GetDataManager()->GetIndicatorBatch();
+        if (batch && index >= 0 && index < static_cast<int>(candles.size()) && index < static_cast<int>(batch->size())) {
+            outputs[0]->setValue<Real>(batch->cci(period)[index]);
+            return;
+        }
+
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
+            return;
+        }
+
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::CCI, period, 0, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
             return;
         }
 
-        long double sumTP = 0.0L;
+        Real sumTP = 0.0;
         for (int i = 0; i < period; i++) {
             int idx = index - i;
-            long double tp = (candles[idx].high + candles[idx].low + candles[idx].close) / 3.0L;
+            Real tp = (candles[idx].high + candles[idx].low + candles[idx].close) / 3.0;
             sumTP += tp;
         }
-        long double smaTP = sumTP / static_cast<long double>(period);
+        Real smaTP = sumTP / static_cast<Real>(period);
 
-        long double sumDeviation = 0.0L;
+        Real sumDeviation = 0.0;
         for (int i = 0; i < period; i++) {
             int idx = index - i;
-            long double tp = (candles[idx].high + candles[idx].low + candles[idx].close) / 3.0L;
+            Real tp = (candles[idx].high + candles[idx].low + candles[idx].close) / 3.0;
             sumDeviation += fabs(tp - smaTP);
         }
-        long double meanDeviation = sumDeviation / static_cast<long double>(period);
+        Real meanDeviation = sumDeviation / static_cast<Real>(period);
 
-        if (meanDeviation == 0.0L) {
-            outputs[0]->setValue<long double>(0.0L);
-            return;
+        Real cci = 0.0;
+        if (meanDeviation != 0.0) {
+            Real currentTP = (candles[index].high + candles[index].low + candles[index].close) / 3.0;
+            cci = (currentTP - smaTP) / (0.015 * meanDeviation);
         }
 
-        long double currentTP = (candles[index].high + candles[index].low + candles[index].close) / 3.0L;
-        long double cci = (currentTP - smaTP) / (0.015L * meanDeviation);
-
-        outputs[0]->setValue<long double>(cci);
+        cache.insert(key, { cci });
+        outputs[0]->setValue<Real>(cci);
     }
 }
 
 
 std::string CCINode::getNodeType() const { return "CCINode"; }
+REGISTER_NODE_TYPE(CCINode);
 
 WilliamsRNode::WilliamsRNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Williams %R", dManager)
@@ -3239,37 +3688,44 @@ void WilliamsRNode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(-50.0L);
+            outputs[0]->setValue<Real>(-50.0);
+            return;
+        }
+
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::WILLIAMS_R, period, 0, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
             return;
         }
 
-        long double highestHigh = candles[index].high;
-        long double lowestLow = candles[index].low;
+        Real highestHigh = candles[index].high;
+        Real lowestLow = candles[index].low;
 
         for (int i = 1; i < period; i++) {
             if (candles[index - i].high > highestHigh) highestHigh = candles[index - i].high;
             if (candles[index - i].low < lowestLow) lowestLow = candles[index - i].low;
         }
 
-        if (highestHigh == lowestLow) {
-            outputs[0]->setValue<long double>(-50.0L);
-            return;
-        }
+        Real williamsR = -50.0;
+        if (highestHigh != lowestLow)
+            williamsR = ((highestHigh - candles[index].close) / (highestHigh - lowestLow)) * -100.0;
 
-        long double williamsR = ((highestHigh - candles[index].close) / (highestHigh - lowestLow)) * -100.0L;
-        outputs[0]->setValue<long double>(williamsR);
+        cache.insert(key, { williamsR });
+        outputs[0]->setValue<Real>(williamsR);
     }
 }
 
 
 std::string WilliamsRNode::getNodeType() const { return "WilliamsRNode"; }
+REGISTER_NODE_TYPE(WilliamsRNode);
 
 MFINode::MFINode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "MFI", dManager)
@@ -3303,27 +3759,40 @@ void MFINode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
+        IndicatorBatch* batch = blueprintManager->GetDataManager()->GetIndicatorBatch();
+        if (batch && index >= 0 && index < static_cast<int>(candles.size()) && index < static_cast<int>(batch->size())) {
+            outputs[0]->setValue<Real>(batch->mfi(period)[index]);
+            return;
+        }
+
         if (index < period || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(50.0L);
+            outputs[0]->setValue<Real>(50.0);
             return;
         }
 
-        long double positiveFlow = 0.0L;
-        long double negativeFlow = 0.0L;
+        IndicatorCache& cache = blueprintManager->GetDataManager()->GetIndicatorCache();
+        IndicatorCache::Key key{ IndicatorCache::Kind::MFI, period, 0, index, 0.0 };
+        if (const Real* cached = cache.find(key)) {
+            outputs[0]->setValue<Real>(cached[0]);
+            return;
+        }
+
+        Real positiveFlow = 0.0;
+        Real negativeFlow = 0.0;
 
         for (int i = 1; i <= period; i++) {
             int currIdx = index - i + 1;
             int prevIdx = currIdx - 1;
 
-            long double currTP = (candles[currIdx].high + candles[currIdx].low + candles[currIdx].close) / 3.0L;
-            long double prevTP = (candles[prevIdx].high + candles[prevIdx].low + candles[prevIdx].close) / 3.0L;
-            long double moneyFlow = currTP * candles[currIdx].volume;
+            Real currTP = (candles[currIdx].high + candles[currIdx].low + candles[currIdx].close) / 3.0;
+            Real prevTP = (candles[prevIdx].high + candles[prevIdx].low + candles[prevIdx].close) / 3.0;
+            Real moneyFlow = currTP * candles[currIdx].volume;
 
             if (currTP > prevTP) {
                 positiveFlow += moneyFlow;
@@ -3333,20 +3802,20 @@ void MFINode::execute() {
             }
         }
 
-        if (negativeFlow == 0.0L) {
-            outputs[0]->setValue<long double>(100.0L);
-            return;
+        Real mfi = 100.0;
+        if (negativeFlow != 0.0) {
+            Real moneyFlowRatio = positiveFlow / negativeFlow;
+            mfi = 100.0 - (100.0 / (1.0 + moneyFlowRatio));
         }
 
-        long double moneyFlowRatio = positiveFlow / negativeFlow;
-        long double mfi = 100.0L - (100.0L / (1.0L + moneyFlowRatio));
-
-        outputs[0]->setValue<long double>(mfi);
+        cache.insert(key, { mfi });
+        outputs[0]->setValue<Real>(mfi);
     }
 }
 
 
 std::string MFINode::getNodeType() const { return "MFINode"; }
+REGISTER_NODE_TYPE(MFINode);
 
 VWAPNode::VWAPNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "VWAP", dManager)
@@ -3381,39 +3850,40 @@ void VWAPNode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
             return;
         }
 
-        long double totalVolume = 0.0L;
-        long double totalPriceVolume = 0.0L;
+        Real totalVolume = 0.0;
+        Real totalPriceVolume = 0.0;
 
         for (int i = 0; i < period; i++) {
             int idx = index - i;
-            long double typicalPrice = (candles[idx].high + candles[idx].low + candles[idx].close) / 3.0L;
-            long double volume = candles[idx].volume;
+            Real typicalPrice = (candles[idx].high + candles[idx].low + candles[idx].close) / 3.0;
+            Real volume = candles[idx].volume;
 
             totalPriceVolume += typicalPrice * volume;
             totalVolume += volume;
         }
 
-        if (totalVolume > 0.0L) {
-            outputs[0]->setValue<long double>(totalPriceVolume / totalVolume);
+        if (totalVolume > 0.0) {
+            outputs[0]->setValue<Real>(totalPriceVolume / totalVolume);
         }
         else {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
         }
     }
 }
 
 std::string VWAPNode::getNodeType() const { return "VWAPNode"; }
+REGISTER_NODE_TYPE(VWAPNode);
 
 HighestNode::HighestNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Highest", dManager)
@@ -3447,30 +3917,31 @@ void HighestNode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
             return;
         }
 
-        long double highest = candles[index].close;
+        Real highest = candles[index].close;
         for (int i = 1; i < period; i++) {
             if (candles[index - i].close > highest) {
                 highest = candles[index - i].close;
             }
         }
 
-        outputs[0]->setValue<long double>(highest);
+        outputs[0]->setValue<Real>(highest);
     }
 }
 
 
 std::string HighestNode::getNodeType() const { return "HighestNode"; }
+REGISTER_NODE_TYPE(HighestNode);
 
 LowestNode::LowestNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Lowest", dManager)
@@ -3504,30 +3975,31 @@ void LowestNode::execute() {
     int index = inputs[1]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) return;
 
         if (index == 0)
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period - 1 || index >= static_cast<int>(candles.size()) || period <= 0) {
-            outputs[0]->setValue<long double>(0.0L);
+            outputs[0]->setValue<Real>(0.0);
             return;
         }
 
-        long double lowest = candles[index].close;
+        Real lowest = candles[index].close;
         for (int i = 1; i < period; i++) {
             if (candles[index - i].close < lowest) {
                 lowest = candles[index - i].close;
             }
         }
 
-        outputs[0]->setValue<long double>(lowest);
+        outputs[0]->setValue<Real>(lowest);
     }
 }
 
 
 std::string LowestNode::getNodeType() const { return "LowestNode"; }
+REGISTER_NODE_TYPE(LowestNode);
 
 DojiPatternNode::DojiPatternNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Doji Pattern", dManager)
@@ -3536,7 +4008,7 @@ DojiPatternNode::DojiPatternNode(const std::string& guid, BlueprintManager* dMan
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Threshold"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::BOOL, "Is Doji"));
 
-    inputs[1]->setDefaultValue<long double>(0.1);
+    inputs[1]->setDefaultValue<Real>(0.1);
 
     for (auto& pin : inputs) pin->owner = this;
     for (auto& pin : outputs) pin->owner = this;
@@ -3558,10 +4030,10 @@ DojiPatternNode::DojiPatternNode(const std::string& guid, BlueprintManager* dMan
 
 void DojiPatternNode::execute() {
     int index = inputs[0]->getValue<int>();
-    double threshold = inputs[1]->getValue<long double>();
+    double threshold = inputs[1]->getValue<Real>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) {
             outputs[0]->setValue<bool>(false);
             return;
@@ -3591,6 +4063,7 @@ void DojiPatternNode::execute() {
 
 
 std::string DojiPatternNode::getNodeType() const { return "DojiPatternNode"; }
+REGISTER_NODE_TYPE(DojiPatternNode);
 
 HammerPatternNode::HammerPatternNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Hammer Pattern", dManager)
@@ -3624,7 +4097,7 @@ void HammerPatternNode::execute() {
     int index = inputs[0]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.empty()) {
             outputs[0]->setValue<bool>(false);
             outputs[1]->setValue<bool>(false);
@@ -3658,6 +4131,7 @@ void HammerPatternNode::execute() {
 
 
 std::string HammerPatternNode::getNodeType() const { return "HammerPatternNode"; }
+REGISTER_NODE_TYPE(HammerPatternNode);
 
 EngulfingPatternNode::EngulfingPatternNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Engulfing Pattern", dManager)
@@ -3690,7 +4164,7 @@ void EngulfingPatternNode::execute() {
     int index = inputs[0]->getValue<int>();
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
         if (candles.size() < 2) {
             outputs[0]->setValue<bool>(false);
             outputs[1]->setValue<bool>(false);
@@ -3724,6 +4198,7 @@ void EngulfingPatternNode::execute() {
 
 
 std::string EngulfingPatternNode::getNodeType() const { return "EngulfingPatternNode"; }
+REGISTER_NODE_TYPE(EngulfingPatternNode);
 
 CenterOfGravityNode::CenterOfGravityNode(const std::string& guid, BlueprintManager* dManager)
     : PureNode(guid, "Center of Gravity", dManager)
@@ -3767,10 +4242,10 @@ void CenterOfGravityNode::execute() {
     if (period <= 0) period = 10;   
 
     if (blueprintManager && blueprintManager->GetDataManager()) {
-        auto& candles = blueprintManager->GetDataManager()->getPublicData();
+        auto candles = blueprintManager->GetDataManager()->getPublicData();
 
         if (candles.size() < static_cast<size_t>(period + 1)) {
-            outputs[0]->setValue<long double>(0.0);
+            outputs[0]->setValue<Real>(0.0);
             outputs[1]->setValue<bool>(false);
             outputs[2]->setValue<bool>(false);
             return;
@@ -3780,7 +4255,7 @@ void CenterOfGravityNode::execute() {
             index = static_cast<int>(candles.size()) - 1;
 
         if (index < period || index >= static_cast<int>(candles.size())) {
-            outputs[0]->setValue<long double>(0.0);
+            outputs[0]->setValue<Real>(0.0);
             outputs[1]->setValue<bool>(false);
             outputs[2]->setValue<bool>(false);
             return;
@@ -3816,13 +4291,137 @@ void CenterOfGravityNode::execute() {
         bool crossUp = (prevPrice <= prevCoG) && (currentPrice > currentCoG);
         bool crossDown = (prevPrice >= prevCoG) && (currentPrice < currentCoG);
 
-        outputs[0]->setValue<long double>(currentCoG);
+        outputs[0]->setValue<Real>(currentCoG);
         outputs[1]->setValue<bool>(crossUp);
         outputs[2]->setValue<bool>(crossDown);
     }
 }
 
 std::string CenterOfGravityNode::getNodeType() const { return "CenterOfGravityNode"; }
+REGISTER_NODE_TYPE(CenterOfGravityNode);
+
+OrderBookTopNode::OrderBookTopNode(const std::string& guid, BlueprintManager* dManager)
+    : PureNode(guid, "Order Book", dManager)
+{
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::BOOL, "Valid"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Best Bid"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Best Ask"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Spread"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Mid"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Bid Size"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Ask Size"));
+
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(180, 200);
+
+    description = "Order Book\n\n"
+        "Top of the live order book of the symbol\n"
+        "(orderbook.{depth} stream).\n\n"
+        "Only available while streaming; in a\n"
+        "backtest or while the book resyncs\n"
+        "Valid is false and all values are 0.\n\n";
+
+    outputs[0]->description = "True if the book is in sync";
+    outputs[1]->description = "Highest bid price";
+    outputs[2]->description = "Lowest ask price";
+    outputs[3]->description = "Best ask - best bid";
+    outputs[4]->description = "(Best bid + best ask) / 2";
+    outputs[5]->description = "Size at the best bid";
+    outputs[6]->description = "Size at the best ask";
+}
+
+void OrderBookTopNode::execute() {
+    OrderBook::Top top;
+
+    if (blueprintManager && blueprintManager->GetDataManager()) {
+        if (std::shared_ptr<const OrderBook> book = blueprintManager->GetDataManager()->GetOrderBook()) {
+            top = book->getTop();
+        }
+    }
+
+    if (!top.valid) {
+        top = OrderBook::Top();
+    }
+
+    outputs[0]->setValue<bool>(top.valid);
+    outputs[1]->setValue<Real>(top.bid);
+    outputs[2]->setValue<Real>(top.ask);
+    outputs[3]->setValue<Real>(top.valid ? top.ask - top.bid : 0.0);
+    outputs[4]->setValue<Real>(top.valid ? (top.bid + top.ask) * 0.5 : 0.0);
+    outputs[5]->setValue<Real>(top.bidSize);
+    outputs[6]->setValue<Real>(top.askSize);
+}
+
+std::string OrderBookTopNode::getNodeType() const { return "OrderBookTopNode"; }
+REGISTER_NODE_TYPE(OrderBookTopNode);
+
+OrderBookDepthNode::OrderBookDepthNode(const std::string& guid, BlueprintManager* dManager)
+    : PureNode(guid, "Order Book Depth", dManager)
+{
+    inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::INT, "Levels"));
+
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Bid Depth"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Ask Depth"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Imbalance"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Bid Price"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Ask Price"));
+
+    inputs[0]->setDefaultValue<int>(10);
+
+    for (auto& pin : inputs) pin->owner = this;
+    for (auto& pin : outputs) pin->owner = this;
+
+    size = ImVec2(200, 170);
+
+    description = "Order Book Depth\n\n"
+        "Liquidity within the first N levels\n"
+        "of the live order book.\n\n"
+        "Imbalance = (bid - ask) / (bid + ask),\n"
+        "from -1 (only asks) to +1 (only bids).\n\n"
+        "Levels beyond the subscribed depth\n"
+        "are not available. All values are 0\n"
+        "in a backtest.\n\n";
+
+    inputs[0]->description = "Number of levels per side (default: 10)";
+    outputs[0]->description = "Summed bid size of N levels";
+    outputs[1]->description = "Summed ask size of N levels";
+    outputs[2]->description = "Depth imbalance in [-1, 1]";
+    outputs[3]->description = "Bid price at level N (0 if missing)";
+    outputs[4]->description = "Ask price at level N (0 if missing)";
+}
+
+void OrderBookDepthNode::execute() {
+    int levels = inputs[0]->getValue<int>();
+    if (levels <= 0) levels = 10;
+
+    double bidDepth = 0.0;
+    double askDepth = 0.0;
+    OrderBook::Level bidLevel{ 0.0, 0.0 };
+    OrderBook::Level askLevel{ 0.0, 0.0 };
+
+    if (blueprintManager && blueprintManager->GetDataManager()) {
+        std::shared_ptr<const OrderBook> book = blueprintManager->GetDataManager()->GetOrderBook();
+        if (book && book->isValid()) {
+            size_t count = static_cast<size_t>(levels);
+            bidDepth = book->getDepth(OrderBook::Side::BID, count);
+            askDepth = book->getDepth(OrderBook::Side::ASK, count);
+            book->getLevel(OrderBook::Side::BID, count - 1, bidLevel);
+            book->getLevel(OrderBook::Side::ASK, count - 1, askLevel);
+        }
+    }
+
+    double total = bidDepth + askDepth;
+
+    outputs[0]->setValue<Real>(bidDepth);
+    outputs[1]->setValue<Real>(askDepth);
+    outputs[2]->setValue<Real>(total > 0.0 ? (bidDepth - askDepth) / total : 0.0);
+    outputs[3]->setValue<Real>(bidLevel.price);
+    outputs[4]->setValue<Real>(askLevel.price);
+}
+
+std::string OrderBookDepthNode::getNodeType() const { return "OrderBookDepthNode"; }
+REGISTER_NODE_TYPE(OrderBookDepthNode);
 
 BranchNode::BranchNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Branch", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -3856,6 +4455,7 @@ void BranchNode::execute() {
 std::string BranchNode::getNodeType() const {
     return "BranchNode";
 }
+REGISTER_NODE_TYPE(BranchNode);
 
 SequenceNode::SequenceNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Sequence", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -3890,6 +4490,7 @@ void SequenceNode::execute() {
 std::string SequenceNode::getNodeType() const {
     return "SequenceNode";
 }
+REGISTER_NODE_TYPE(SequenceNode);
 
 PrintString::PrintString(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Print String", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
@@ -3920,6 +4521,7 @@ void PrintString::execute() {
 std::string PrintString::getNodeType() const {
     return "PrintString";
 }
+REGISTER_NODE_TYPE(PrintString);
 
 nlohmann::json PrintString::serializeData() const
 {
@@ -3935,6 +4537,49 @@ void PrintString::deserializeData(const nlohmann::json& data)
     }
 }
 
+static void executeConnected(PinOut& pin) {
+    for (auto* connected_pin : pin.connected_pins) {
+        if (connected_pin->owner && !connected_pin->owner->isPure()) {
+            static_cast<ExecNode*>(connected_pin->owner)->execute();
+        }
+    }
+}
+
+// Live margin orders finish after execute() returned. The completion is delivered through
+// the data manager's LiveOrderHandle on the strategy's own thread, and the node is looked up
+// again by GUID there: a strategy reloaded or torn down in the meantime is never touched,
+// while the fill is still booked into the runtime stats if the data manager is alive.
+static void submitMarginOrder(CandlestickDataManager& dataManager, const std::string& nodeGuid, const OrderRequest& request,
+    std::function<void(CandlestickDataManager&, BasicNode*, const OrderUpdate&)> onFill)
+{
+    BybitOrderGateway& gateway = BybitOrderGateway::getInstance();
+    gateway.setCredentials(Config::getInstance().getBybitAPIKey(), Config::getInstance().getBybitSignature(), Config::getInstance().bybitIsDemoMode());
+
+    std::shared_ptr<LiveOrderHandle> handle = dataManager.GetLiveOrderHandle();
+    gateway.submit(request, [handle, nodeGuid, onFill](const OrderUpdate& update) {
+        LiveOrderHandle::deliver(handle, [nodeGuid, onFill, update](CandlestickDataManager& target) {
+            BlueprintManager* blueprint = target.GetBlueprintManager();
+            onFill(target, blueprint ? blueprint->getNodeByGuid(nodeGuid) : nullptr, update);
+            });
+        });
+}
+
+// Blueprints made before "On Filled" existed read the results after the regular exec output.
+// While "On Filled" is unwired that output waits for the completion instead of running at once.
+static PinOut& completionPin(BasicNode& node, size_t onFilled) {
+    PinOut& pin = *node.outputs[onFilled];
+    return pin.connected_pins.empty() ? *node.outputs[0] : pin;
+}
+
+// A leverage the exchange did not end up with means the gateway's cached value is wrong.
+static void checkLeverage(const OrderUpdate& update, double requested) {
+    if (requested != 0.0 && update.result.success && std::fabs(update.position.leverage - requested) > 1e-9) {
+        BybitOrderGateway::getInstance().invalidateLeverage(update.symbol);
+    }
+}
+
+REGISTER_NODE_TYPE(BybiyMarginLongNode);
+
 BybiyMarginLongNode::BybiyMarginLongNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Bybit Margin Open Long", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Quantity"));
@@ -3947,55 +4592,54 @@ BybiyMarginLongNode::BybiyMarginLongNode(const std::string& guid, BlueprintManag
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Mark Price"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Liq Price"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Bust Price"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, "On Filled"));
     inputs[1]->default_stored_double = 1.0;
     inputs[2]->default_stored_double = 0.0;
 
     inputs[1]->description = "Quantity to buy";
     inputs[2]->description = "Leverage (0 - doesnt change current)";
+    outputs[6]->description = "Runs once the order completed; Success and the prices are valid from here. Live orders complete later, backtests at once. While unwired, the exec output above waits for the completion instead";
 
     for (auto& pin : inputs) pin->owner = this;
     for (auto& pin : outputs) pin->owner = this;
-    size = ImVec2(180, 180);
+    size = ImVec2(180, 200);
 }
 
 void BybiyMarginLongNode::execute() {
 
-    double quantity = inputs[1]->getValue<long double>();
-    double leverage = inputs[2]->getValue<long double>();
+    double quantity = inputs[1]->getValue<Real>();
+    double leverage = inputs[2]->getValue<Real>();
     auto candle = blueprintManager->GetDataManager()->getPublicData().back();
 
     if (blueprintManager->GetDataManager()->RuntimeModeIsActive())
     {
-        std::unique_ptr<BybitMargin> margin = std::make_unique<BybitMargin>();
-        margin->setApiKeys(Config::getInstance().getBybitAPIKey(), Config::getInstance().getBybitSignature());
-        margin->setTestnet(Config::getInstance().bybitIsDemoMode());
-        if(leverage != 0.0) margin->setLeverage(blueprintManager->GetDataManager()->GetSymbol(), leverage);
-        OrderResult longResult = margin->openLong(blueprintManager->GetDataManager()->GetSymbol(), quantity);
-        PositionInfo position = margin->getPosition(blueprintManager->GetDataManager()->GetSymbol());
-
-        outputs[1]->setValue<bool>(longResult.success);
-        outputs[2]->setValue<long double>(position.avgPrice);
-        outputs[3]->setValue<long double>(position.markPrice);
-        outputs[4]->setValue<long double>(position.liqPrice);
-        outputs[5]->setValue<long double>(position.bustPrice);
-
-        if(longResult.success)
-        {
-            if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetRuntimeTradingStats()) {
-                if (blueprintManager->GetDataManager()->getPublicData().size() > 0) {
-                    blueprintManager->GetDataManager()->GetRuntimeTradingStats()->EnterLong(position.createdTime, position.avgPrice, quantity, position.leverage, position.liqPrice);
+        OrderRequest request;
+        request.symbol = blueprintManager->GetDataManager()->GetSymbol();
+        request.action = OrderAction::OPEN_LONG;
+        request.quantity = quantity;
+        request.leverage = leverage;
+
+        // Result outputs describe the fill and stay cleared until it arrives.
+        outputs[1]->setValue<bool>(false);
+        for (size_t i = 2; i <= 5; ++i) outputs[i]->setValue<Real>(0.0);
+
+        submitMarginOrder(*blueprintManager->GetDataManager(), node_guid, request,
+            [quantity, leverage](CandlestickDataManager& dataManager, BasicNode* node, const OrderUpdate& update) {
+                if (update.result.success && dataManager.GetRuntimeTradingStats()) {
+                    dataManager.GetRuntimeTradingStats()->EnterLong(update.position.createdTime, update.fillPrice, quantity, update.position.leverage, update.position.liqPrice);
                 }
-            }
-            
-        }
-
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+                checkLeverage(update, leverage);
+                if (!node || node->outputs.size() < 7) return;
+
+                node->outputs[1]->setValue<bool>(update.result.success);
+                node->outputs[2]->setValue<Real>(update.fillPrice);
+                node->outputs[3]->setValue<Real>(update.position.markPrice);
+                node->outputs[4]->setValue<Real>(update.position.liqPrice);
+                node->outputs[5]->setValue<Real>(update.position.bustPrice);
+                executeConnected(completionPin(*node, 6));
+            });
+
+        if (!outputs[6]->connected_pins.empty()) executeConnected(*outputs[0]);
     }
     else
     {
@@ -4013,20 +4657,17 @@ void BybiyMarginLongNode::execute() {
         Position longf = blueprintManager->GetDataManager()->GetBacktestTradingStats()->GetOpenLongPosition();
 
         outputs[1]->setValue<bool>(true);
-        outputs[2]->setValue<long double>(longf.buyPrice);
-        outputs[4]->setValue<long double>(longf.liquidationPrice);
+        outputs[2]->setValue<Real>(longf.buyPrice);
+        outputs[4]->setValue<Real>(longf.liquidationPrice);
 
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+        executeConnected(*outputs[0]);
+        executeConnected(*outputs[6]);
     }
 
 }
 
+REGISTER_NODE_TYPE(BybiyMarginShortNode);
+
 BybiyMarginShortNode::BybiyMarginShortNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Bybit Margin Short", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Quantity"));
@@ -4038,55 +4679,54 @@ BybiyMarginShortNode::BybiyMarginShortNode(const std::string& guid, BlueprintMan
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Mark Price"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Liq Price"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Bust Price"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, "On Filled"));
 
     inputs[1]->default_stored_double = 1.0;
     inputs[2]->default_stored_double = 0.0;
 
     inputs[1]->description = "Quantity to sell short";
     inputs[2]->description = "Leverage (0 - doesnt change current)";
+    outputs[6]->description = "Runs once the order completed; Success and the prices are valid from here. Live orders complete later, backtests at once. While unwired, the exec output above waits for the completion instead";
 
     for (auto& pin : inputs) pin->owner = this;
     for (auto& pin : outputs) pin->owner = this;
-    size = ImVec2(180, 150);
+    size = ImVec2(180, 200);
 }
 
 void BybiyMarginShortNode::execute() {
 
-    double quantity = inputs[1]->getValue<long double>();
-    double leverage = inputs[2]->getValue<long double>();
+    double quantity = inputs[1]->getValue<Real>();
+    double leverage = inputs[2]->getValue<Real>();
     auto candle = blueprintManager->GetDataManager()->getPublicData().back();
 
     if (blueprintManager->GetDataManager()->RuntimeModeIsActive())
     {
-        BybitMargin margin;
-        margin.setApiKeys(Config::getInstance().getBybitAPIKey(), Config::getInstance().getBybitSignature());
-        margin.setTestnet(Config::getInstance().bybitIsDemoMode());
-        if (leverage != 0.0) margin.setLeverage(blueprintManager->GetDataManager()->GetSymbol(), leverage);
-        OrderResult shortResult = margin.openShort(blueprintManager->GetDataManager()->GetSymbol(), quantity);
-        PositionInfo position = margin.getPosition(blueprintManager->GetDataManager()->GetSymbol());
-
-        outputs[1]->setValue<bool>(shortResult.success);
-        outputs[2]->setValue<long double>(position.avgPrice);
-        outputs[3]->setValue<long double>(position.markPrice);
-        outputs[4]->setValue<long double>(position.liqPrice);
-        outputs[5]->setValue<long double>(position.bustPrice);
-
-        if (shortResult.success)
-        {
-            if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetRuntimeTradingStats()) {
-                if (blueprintManager->GetDataManager()->getPublicData().size() > 0) {
-                    blueprintManager->GetDataManager()->GetRuntimeTradingStats()->EnterShort(position.createdTime, position.avgPrice, quantity, position.leverage, position.liqPrice);
+        OrderRequest request;
+        request.symbol = blueprintManager->GetDataManager()->GetSymbol();
+        request.action = OrderAction::OPEN_SHORT;
+        request.quantity = quantity;
+        request.leverage = leverage;
+
+        outputs[1]->setValue<bool>(false);
+        for (size_t i = 2; i <= 5; ++i) outputs[i]->setValue<Real>(0.0);
+
+        submitMarginOrder(*blueprintManager->GetDataManager(), node_guid, request,
+            [quantity, leverage](CandlestickDataManager& dataManager, BasicNode* node, const OrderUpdate& update) {
+                if (update.result.success && dataManager.GetRuntimeTradingStats()) {
+                    dataManager.GetRuntimeTradingStats()->EnterShort(update.position.createdTime, update.fillPrice, quantity, update.position.leverage, update.position.liqPrice);
                 }
-            }
-        }
-
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+                checkLeverage(update, leverage);
+                if (!node || node->outputs.size() < 7) return;
+
+                node->outputs[1]->setValue<bool>(update.result.success);
+                node->outputs[2]->setValue<Real>(update.fillPrice);
+                node->outputs[3]->setValue<Real>(update.position.markPrice);
+                node->outputs[4]->setValue<Real>(update.position.liqPrice);
+                node->outputs[5]->setValue<Real>(update.position.bustPrice);
+                executeConnected(completionPin(*node, 6));
+            });
+
+        if (!outputs[6]->connected_pins.empty()) executeConnected(*outputs[0]);
     }
     else
     {
@@ -4104,19 +4744,16 @@ void BybiyMarginShortNode::execute() {
         Position shortf = blueprintManager->GetDataManager()->GetBacktestTradingStats()->GetOpenShortPosition();
 
         outputs[1]->setValue<bool>(true);
-        outputs[2]->setValue<long double>(shortf.buyPrice);
-        outputs[4]->setValue<long double>(shortf.liquidationPrice);
+        outputs[2]->setValue<Real>(shortf.buyPrice);
+        outputs[4]->setValue<Real>(shortf.liquidationPrice);
 
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+        executeConnected(*outputs[0]);
+        executeConnected(*outputs[6]);
     }
 }
 
+REGISTER_NODE_TYPE(BybiyMarginCloseLongPositionNode);
+
 BybiyMarginCloseLongPositionNode::BybiyMarginCloseLongPositionNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Bybit Margin Close Long", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Percent"));
@@ -4126,44 +4763,45 @@ BybiyMarginCloseLongPositionNode::BybiyMarginCloseLongPositionNode(const std::st
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::BOOL, "Success"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Price"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, "On Filled"));
+
+    outputs[3]->description = "Runs once the order completed; Success and Price are valid from here. Live orders complete later, backtests at once. While unwired, the exec output above waits for the completion instead";
 
     for (auto& pin : inputs) pin->owner = this;
     for (auto& pin : outputs) pin->owner = this;
-    size = ImVec2(200, 100);
+    size = ImVec2(200, 125);
 }
 
 void BybiyMarginCloseLongPositionNode::execute() {
 
-    long double percent = inputs[1]->getValue<long double>();
+    Real percent = inputs[1]->getValue<Real>();
     auto candle = blueprintManager->GetDataManager()->getPublicData().back();
 
     if (blueprintManager->GetDataManager()->RuntimeModeIsActive())
     {
-        BybitMargin margin;
-        margin.setApiKeys(Config::getInstance().getBybitAPIKey(), Config::getInstance().getBybitSignature());
-        margin.setTestnet(Config::getInstance().bybitIsDemoMode());
-        OrderResult closeResult = margin.closePosition(blueprintManager->GetDataManager()->GetSymbol());
-
-        OrderHistoryResult history = margin.getOrderHistory("linear", blueprintManager->GetDataManager()->GetSymbol(), closeResult.orderId);
-        outputs[1]->setValue<bool>(closeResult.success);
-        outputs[2]->setValue<long double>(!history.orders.empty() ? history.orders[0].price : candle.close);
-
-        if (closeResult.success)
-        {
-            if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetRuntimeTradingStats()) {
-                if (blueprintManager->GetDataManager()->getPublicData().size() > 0) {
-                    blueprintManager->GetDataManager()->GetRuntimeTradingStats()->CloseLong(candle.timestamp, !history.orders.empty() ? history.orders[0].price : candle.close, percent);
+        OrderRequest request;
+        request.symbol = blueprintManager->GetDataManager()->GetSymbol();
+        request.action = OrderAction::CLOSE_POSITION;
+
+        outputs[1]->setValue<bool>(false);
+        outputs[2]->setValue<Real>(0.0);
+
+        uint64_t candleTime = candle.timestamp;
+        Real candleClose = candle.close;
+        submitMarginOrder(*blueprintManager->GetDataManager(), node_guid, request,
+            [candleTime, candleClose, percent](CandlestickDataManager& dataManager, BasicNode* node, const OrderUpdate& update) {
+                if (update.result.success && dataManager.GetRuntimeTradingStats()) {
+                    dataManager.GetRuntimeTradingStats()->CloseLong(candleTime, update.fillPrice > 0.0 ? update.fillPrice : (double)candleClose, percent);
                 }
-            }
-        }
+                if (!node || node->outputs.size() < 4) return;
 
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+                // Price stays 0 when the exchange did not report the fill.
+                node->outputs[1]->setValue<bool>(update.result.success);
+                node->outputs[2]->setValue<Real>(update.fillPrice);
+                executeConnected(completionPin(*node, 3));
+            });
+
+        if (!outputs[3]->connected_pins.empty()) executeConnected(*outputs[0]);
     }
     else
     {
@@ -4174,18 +4812,15 @@ void BybiyMarginCloseLongPositionNode::execute() {
         }
 
         outputs[1]->setValue<bool>(true);
-        outputs[2]->setValue<long double>(candle.close);
+        outputs[2]->setValue<Real>(candle.close);
 
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+        executeConnected(*outputs[0]);
+        executeConnected(*outputs[3]);
     }
 }
 
+REGISTER_NODE_TYPE(BybiyMarginCloseShortPositionNode);
+
 BybiyMarginCloseShortPositionNode::BybiyMarginCloseShortPositionNode(const std::string& guid, BlueprintManager* dManager) : ExecNode(guid, "Bybit Margin Close Short", dManager) {
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
     inputs.push_back(std::make_unique<PinIn>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Percent"));
@@ -4195,44 +4830,45 @@ BybiyMarginCloseShortPositionNode::BybiyMarginCloseShortPositionNode(const std::
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, ""));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::BOOL, "Success"));
     outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::DOUBLE, "Price"));
+    outputs.push_back(std::make_unique<PinOut>(GUIDGenerator::generate(), guid, PinType::EXEC, "On Filled"));
+
+    outputs[3]->description = "Runs once the order completed; Success and Price are valid from here. Live orders complete later, backtests at once. While unwired, the exec output above waits for the completion instead";
 
     for (auto& pin : inputs) pin->owner = this;
     for (auto& pin : outputs) pin->owner = this;
-    size = ImVec2(200, 100);
+    size = ImVec2(200, 125);
 }
 
 void BybiyMarginCloseShortPositionNode::execute() {
 
-    long double percent = inputs[1]->getValue<long double>();
+    Real percent = inputs[1]->getValue<Real>();
     auto candle = blueprintManager->GetDataManager()->getPublicData().back();
 
     if (blueprintManager->GetDataManager()->RuntimeModeIsActive())
     {
-        BybitMargin margin;
-        margin.setApiKeys(Config::getInstance().getBybitAPIKey(), Config::getInstance().getBybitSignature());
-        margin.setTestnet(Config::getInstance().bybitIsDemoMode());
-        OrderResult closeResult = margin.closePosition(blueprintManager->GetDataManager()->GetSymbol());
-
-        OrderHistoryResult history = margin.getOrderHistory("linear", blueprintManager->GetDataManager()->GetSymbol(), closeResult.orderId);
-        outputs[1]->setValue<bool>(closeResult.success);
-        outputs[2]->setValue<long double>(!history.orders.empty() ? history.orders[0].price : candle.close);
-
-        if (closeResult.success)
-        {
-            if (blueprintManager && blueprintManager->GetDataManager() && blueprintManager->GetDataManager()->GetRuntimeTradingStats()) {
-                if (blueprintManager->GetDataManager()->getPublicData().size() > 0) {
-                    blueprintManager->GetDataManager()->GetRuntimeTradingStats()->CloseShort(candle.timestamp, !history.orders.empty() ? history.orders[0].price : candle.close, percent);
+        OrderRequest request;
+        request.symbol = blueprintManager->GetDataManager()->GetSymbol();
+        request.action = OrderAction::CLOSE_POSITION;
+
+        outputs[1]->setValue<bool>(false);
+        outputs[2]->setValue<Real>(0.0);
+
+        uint64_t candleTime = candle.timestamp;
+        Real candleClose = candle.close;
+        submitMarginOrder(*blueprintManager->GetDataManager(), node_guid, request,
+            [candleTime, candleClose, percent](CandlestickDataManager& dataManager, BasicNode* node, const OrderUpdate& update) {
+                if (update.result.success && dataManager.GetRuntimeTradingStats()) {
+                    dataManager.GetRuntimeTradingStats()->CloseShort(candleTime, update.fillPrice > 0.0 ? update.fillPrice : (double)candleClose, percent);
                 }
-            }
-        }
+                if (!node || node->outputs.size() < 4) return;
 
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+                // Price stays 0 when the exchange did not report the fill.
+                node->outputs[1]->setValue<bool>(update.result.success);
+                node->outputs[2]->setValue<Real>(update.fillPrice);
+                executeConnected(completionPin(*node, 3));
+            });
+
+        if (!outputs[3]->connected_pins.empty()) executeConnected(*outputs[0]);
     }
     else
     {
@@ -4243,14 +4879,9 @@ void BybiyMarginCloseShortPositionNode::execute() {
         }
 
         outputs[1]->setValue<bool>(true);
-        outputs[2]->setValue<long double>(candle.close);
+        outputs[2]->setValue<Real>(candle.close);
 
-        if (!outputs[0]->connected_pins.empty()) {
-            for (auto* connected_pin : outputs[0]->connected_pins) {
-                if (connected_pin->owner && !connected_pin->owner->isPure()) {
-                    static_cast<ExecNode*>(connected_pin->owner)->execute();
-                }
-            }
-        }
+        executeConnected(*outputs[0]);
+        executeConnected(*outputs[3]);
     }
 }
\ No newline at end of file
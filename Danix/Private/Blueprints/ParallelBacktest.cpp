@@ -0,0 +1,253 @@
+#include "../../Public/Blueprints/ParallelBacktest.h"
+#include "../../Public/Blueprints/StrategyTemplate.h"
+#include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/StatsManager/TradingStatsManager.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <thread>
+#include <tuple>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct ShardRun {
+    CandlestickDataManager dataManager;
+    TradingStatsManager scratch;
+    TradingStatsManager stats;
+    std::unique_ptr<BlueprintManager> blueprint;
+    ParallelBacktest::ShardReport report;
+    uint64_t ownedUntil = std::numeric_limits<uint64_t>::max();
+};
+
+void configure(TradingStatsManager& stats, const TradingStatsManager& from) {
+    stats.Reset(from.GetStartingBalance());
+    stats.SetFixedCommission(from.GetFixedCommission());
+    stats.SetPercentFixedCommission(from.GetPercentFixedCommission());
+}
+
+bool hasOpenOwned(const TradingStatsManager& stats, uint64_t ownedUntil) {
+    for (const Position& position : stats.GetPositions()) {
+        if (position.isOpen && position.buyTime < ownedUntil) return true;
+    }
+    return false;
+}
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void runShard(ShardRun& shard, CandleSeriesView series, size_t warmBegin) {
+    Clock::time_point start = Clock::now();
+    size_t begin = shard.report.begin;
+    size_t end = shard.report.end;
+
+    // The shard reads the caller's candles in place; its public series starts at warmBegin.
+    shard.dataManager.attachSeriesView(CandleSeriesView(series.data() + warmBegin, end - warmBegin));
+    shard.dataManager.SetBacktestTradingStats(&shard.scratch);
+    shard.dataManager.beginIndicatorBatch();
+
+    BlueprintManager* blueprint = shard.blueprint.get();
+    for (size_t i = warmBegin; i < end; ++i) {
+        if (i == begin) {
+            shard.report.flatAtStart = shard.scratch.GetOpenPositionsCount() == 0;
+            shard.dataManager.SetBacktestTradingStats(&shard.stats);
+        }
+        shard.dataManager.setMappedVisibleCount(i - warmBegin + 1);
+        blueprint->executeFromEntry();
+    }
+    shard.dataManager.endIndicatorBatch();
+
+    // Run-off candles are beyond the batch; the indicator nodes use their scalar path.
+    shard.dataManager.attachSeriesView(CandleSeriesView(series.data() + warmBegin, series.size() - warmBegin));
+    for (size_t i = end; i < series.size() && hasOpenOwned(shard.stats, shard.ownedUntil); ++i) {
+        shard.dataManager.setMappedVisibleCount(i - warmBegin + 1);
+        blueprint->executeFromEntry();
+        shard.report.runoff++;
+    }
+    shard.dataManager.detachMappedSeries();
+
+    shard.report.warmup = begin - warmBegin;
+    shard.report.elapsedMs = elapsedMs(start);
+}
+
+using TradeKey = std::tuple<uint64_t, uint64_t, bool, double, double>;
+
+std::vector<TradeKey> closedTrades(const TradingStatsManager& stats) {
+    std::vector<TradeKey> trades;
+    for (const Position& position : stats.GetPositions()) {
+        if (position.isOpen) continue;
+        trades.emplace_back(position.buyTime, position.sellTime, position.isLong, position.quantity, position.buyPrice);
+    }
+    std::sort(trades.begin(), trades.end());
+    return trades;
+}
+
+}
+
+// Friend of TradingStatsManager: rebuilds one manager from the positions each shard owns.
+class ParallelBacktestStitcher {
+public:
+    static void stitch(std::vector<std::unique_ptr<ShardRun>>& shards, TradingStatsManager& result);
+};
+
+ParallelBacktest::Report ParallelBacktest::run(const StrategyTemplate& strategy, CandleSeriesView series,
+    const Settings& settings, TradingStatsManager& result)
+{
+    Report report;
+    report.candles = series.size();
+
+    size_t count = std::max<size_t>(1, std::min(settings.shards, series.size()));
+    if (series.empty()) return report;
+
+    // Instances are built here; only evaluation runs on the shard threads.
+    std::vector<std::unique_ptr<ShardRun>> shards;
+    for (size_t k = 0; k < count; ++k) {
+        auto shard = std::make_unique<ShardRun>();
+        shard->report.begin = series.size() * k / count;
+        shard->report.end = series.size() * (k + 1) / count;
+        if (k + 1 < count) shard->ownedUntil = series[shard->report.end].timestamp;
+
+        configure(shard->scratch, result);
+        configure(shard->stats, result);
+        shard->blueprint = strategy.instantiate(&shard->dataManager);
+        if (!shard->blueprint) return report;
+        shard->dataManager.SetBlueprintManager(shard->blueprint.get());
+        shards.push_back(std::move(shard));
+    }
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (auto& shard : shards) {
+        size_t warmBegin = shard->report.begin > settings.warmupCandles ? shard->report.begin - settings.warmupCandles : 0;
+        threads.emplace_back(runShard, std::ref(*shard), series, warmBegin);
+    }
+    for (auto& thread : threads) thread.join();
+
+    ParallelBacktestStitcher::stitch(shards, result);
+    report.elapsedMs = elapsedMs(start);
+    for (auto& shard : shards) report.shards.push_back(shard->report);
+
+    report.shardedTrades = result.GetClosedPositionsCount();
+    report.shardedPnL = result.GetRealizedPnL();
+    report.shardedBalance = result.GetCurrentBalance();
+    report.ok = true;
+
+    if (settings.verify) {
+        ShardRun serial;
+        serial.report.begin = 0;
+        serial.report.end = series.size();
+        configure(serial.scratch, result);
+        configure(serial.stats, result);
+        serial.blueprint = strategy.instantiate(&serial.dataManager);
+        if (serial.blueprint) {
+            serial.dataManager.SetBlueprintManager(serial.blueprint.get());
+            runShard(serial, series, 0);
+
+            report.verified = true;
+            report.serialMs = serial.report.elapsedMs;
+            report.serialTrades = serial.stats.GetClosedPositionsCount();
+            report.serialPnL = serial.stats.GetRealizedPnL();
+            report.serialBalance = serial.stats.GetCurrentBalance();
+
+            std::vector<TradeKey> expected = closedTrades(serial.stats);
+            std::vector<TradeKey> actual = closedTrades(result);
+            std::vector<TradeKey> difference;
+            std::set_symmetric_difference(expected.begin(), expected.end(), actual.begin(), actual.end(),
+                std::back_inserter(difference));
+            report.mismatchedTrades = difference.size();
+        }
+    }
+
+    return report;
+}
+
+void ParallelBacktestStitcher::stitch(std::vector<std::unique_ptr<ShardRun>>& shards, TradingStatsManager& result) {
+    struct OwnedOrder {
+        Order order;
+        size_t shard;
+    };
+
+    std::vector<OwnedOrder> orders;
+    std::vector<std::map<int, int>> ids(shards.size());
+
+    for (size_t k = 0; k < shards.size(); ++k) {
+        const TradingStatsManager& stats = shards[k]->stats;
+        for (const Position& position : stats.allPositions) {
+            if (position.buyTime >= shards[k]->ownedUntil) continue;
+            ids[k][position.buyOrderId] = 0;
+            if (position.sellOrderId >= 0) ids[k][position.sellOrderId] = 0;
+        }
+        for (const Order& order : stats.allOrders) {
+            if (ids[k].count(order.id)) orders.push_back({ order, k });
+        }
+    }
+
+    std::stable_sort(orders.begin(), orders.end(), [](const OwnedOrder& a, const OwnedOrder& b) {
+        return a.order.time < b.order.time;
+    });
+
+    result.allOrders.clear();
+    result.allPositions.clear();
+    result.orderCandlesIDs.clear();
+    result.totalCommissionPaid = 0.0;
+    result.nextOrderId = 1;
+
+    // The balance replays the owned orders' cash flows. Every position closed by one order
+    // carries that order's full commission in its pnl, so commissions come from the orders.
+    double balance = result.startingBalance;
+    for (OwnedOrder& owned : orders) {
+        int id = result.nextOrderId++;
+        ids[owned.shard][owned.order.id] = id;
+        owned.order.id = id;
+        result.totalCommissionPaid += owned.order.commission;
+        result.allOrders.push_back(owned.order);
+
+        const Order& order = owned.order;
+        if (order.type == OrderType::BUY) {
+            balance -= order.price * order.quantity;
+        }
+        else if (order.type == OrderType::LONG || order.type == OrderType::SHORT) {
+            balance -= order.price * order.quantity / order.leverage;
+        }
+        balance -= order.commission;
+    }
+
+    double shares = 0.0;
+    for (size_t k = 0; k < shards.size(); ++k) {
+        for (Position position : shards[k]->stats.allPositions) {
+            if (position.buyTime >= shards[k]->ownedUntil) continue;
+            position.buyOrderId = ids[k][position.buyOrderId];
+            if (position.sellOrderId >= 0) position.sellOrderId = ids[k][position.sellOrderId];
+
+            // Proceeds of the closing order for this position, commissions excluded. A
+            // liquidation has no order and returns nothing.
+            if (position.isOpen) {
+                if (position.mode == PositionMode::SPOT) shares += position.quantity;
+            }
+            else if (position.sellOrderId >= 0) {
+                if (position.mode == PositionMode::SPOT) {
+                    balance += position.sellPrice * position.quantity;
+                }
+                else {
+                    balance += position.initialMargin + position.pnl + position.buyCommission + position.sellCommission;
+                }
+            }
+
+            result.allPositions.push_back(position);
+            shards[k]->report.positions++;
+        }
+    }
+
+    std::stable_sort(result.allPositions.begin(), result.allPositions.end(), [](const Position& a, const Position& b) {
+        return a.buyTime < b.buyTime;
+    });
+
+    result.currentBalance = balance;
+    result.totalShares = shares;
+    result.UpdateBalanceHistory();
+    result.InvalidateStatsCache();
+}
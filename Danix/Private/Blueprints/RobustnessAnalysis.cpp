@@ -0,0 +1,250 @@
+#include "../../Public/Blueprints/RobustnessAnalysis.h"
+#include "../../Public/Blueprints/StrategyTemplate.h"
+#include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/StatsManager/TradingStatsManager.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <iostream>
+
+constexpr double RobustnessAnalysis::PERCENTILES[RobustnessAnalysis::PERCENTILE_COUNT];
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Window {
+    size_t warmBegin = 0;
+    size_t inSampleBegin = 0;
+    size_t outOfSampleBegin = 0;
+    size_t end = 0;
+};
+
+struct WindowRun {
+    CandlestickDataManager dataManager;
+    TradingStatsManager scratch;
+    TradingStatsManager inSample;
+    TradingStatsManager outOfSample;
+    std::unique_ptr<BlueprintManager> blueprint;
+};
+
+void configure(TradingStatsManager& stats, const TradingStatsManager& from) {
+    stats.Reset(from.GetStartingBalance());
+    stats.SetFixedCommission(from.GetFixedCommission());
+    stats.SetPercentFixedCommission(from.GetPercentFixedCommission());
+}
+
+RobustnessAnalysis::SegmentResult summarize(const TradingStatsManager& stats, size_t begin, size_t end) {
+    RobustnessAnalysis::SegmentResult result;
+    result.begin = begin;
+    result.end = end;
+    result.pnl = stats.GetRealizedPnL();
+    result.winRate = stats.GetWinRate();
+    result.trades = stats.GetClosedPositionsCount();
+    result.maxDrawdown = RobustnessAnalysis::maxDrawdownPercent(stats.GetBalanceHistory());
+    return result;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    double position = p / 100.0 * static_cast<double>(sorted.size() - 1);
+    size_t lower = static_cast<size_t>(position);
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    double weight = position - static_cast<double>(lower);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * weight;
+}
+
+size_t threadCount(size_t jobs) {
+    size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(hardware, jobs));
+}
+
+// Runs job(0..jobs-1) on threads of its own, so long runs stay off the shared executor
+// that evaluates live strategies.
+void runJobs(size_t jobs, const std::function<void(size_t)>& job) {
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&]() {
+        for (size_t k = next++; k < jobs; k = next++) job(k);
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < threadCount(jobs); ++t) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+}
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Built on the worker and gone once summarized, so only one window per thread is alive.
+// The window reads the caller's candles in place, as a mapped backtest does.
+bool runWindow(const StrategyTemplate& strategy, const TradingStatsManager& config, CandleSeriesView series,
+    const Window& window, RobustnessAnalysis::SegmentResult& inSample, RobustnessAnalysis::SegmentResult& outOfSample)
+{
+    WindowRun run;
+    configure(run.scratch, config);
+    configure(run.inSample, config);
+    configure(run.outOfSample, config);
+    run.blueprint = strategy.instantiate(&run.dataManager);
+    if (!run.blueprint) return false;
+    run.dataManager.SetBlueprintManager(run.blueprint.get());
+
+    run.dataManager.attachSeriesView(CandleSeriesView(series.data() + window.warmBegin, window.end - window.warmBegin));
+    run.dataManager.SetBacktestTradingStats(&run.scratch);
+    run.dataManager.beginIndicatorBatch();
+
+    for (size_t i = window.warmBegin; i < window.end; ++i) {
+        if (i == window.inSampleBegin) run.dataManager.SetBacktestTradingStats(&run.inSample);
+        if (i == window.outOfSampleBegin) run.dataManager.SetBacktestTradingStats(&run.outOfSample);
+        run.dataManager.setMappedVisibleCount(i - window.warmBegin + 1);
+        run.blueprint->executeFromEntry();
+    }
+    run.dataManager.endIndicatorBatch();
+    run.dataManager.detachMappedSeries();
+
+    inSample = summarize(run.inSample, window.inSampleBegin, window.outOfSampleBegin);
+    outOfSample = summarize(run.outOfSample, window.outOfSampleBegin, window.end);
+    return true;
+}
+
+}
+
+RobustnessAnalysis::WalkForwardReport RobustnessAnalysis::walkForward(const StrategyTemplate& strategy,
+    CandleSeriesView series, const WalkForwardSettings& settings, const TradingStatsManager& config)
+{
+    WalkForwardReport report;
+    if (settings.inSampleCandles == 0 || settings.outOfSampleCandles == 0) return report;
+
+    // Only the bounds are laid out here; each worker builds the window it evaluates.
+    std::vector<Window> windows;
+    for (size_t begin = 0; begin + settings.inSampleCandles + settings.outOfSampleCandles <= series.size();
+        begin += settings.outOfSampleCandles)
+    {
+        Window window;
+        window.warmBegin = begin > settings.warmupCandles ? begin - settings.warmupCandles : 0;
+        window.inSampleBegin = begin;
+        window.outOfSampleBegin = begin + settings.inSampleCandles;
+        window.end = window.outOfSampleBegin + settings.outOfSampleCandles;
+        windows.push_back(window);
+    }
+    if (windows.empty()) {
+        std::cout << "[RobustnessAnalysis] Series too short for one walk-forward window" << std::endl;
+        return report;
+    }
+
+    Clock::time_point start = Clock::now();
+    report.inSample.resize(windows.size());
+    report.outOfSample.resize(windows.size());
+    std::atomic<bool> failed{ false };
+    runJobs(windows.size(), [&](size_t k) {
+        if (failed.load()) return;
+        if (!runWindow(strategy, config, series, windows[k], report.inSample[k], report.outOfSample[k])) failed = true;
+    });
+    if (failed.load()) return WalkForwardReport();
+
+    double inSamplePnL = 0.0;
+    size_t inSampleCandles = 0;
+    size_t outOfSampleCandles = 0;
+    for (size_t k = 0; k < windows.size(); ++k) {
+        inSamplePnL += report.inSample[k].pnl;
+        inSampleCandles += windows[k].outOfSampleBegin - windows[k].inSampleBegin;
+        report.outOfSamplePnL += report.outOfSample[k].pnl;
+        outOfSampleCandles += windows[k].end - windows[k].outOfSampleBegin;
+        if (report.outOfSample[k].pnl > 0.0) report.profitableWindows++;
+    }
+
+    if (inSamplePnL > 0.0) {
+        report.efficiency = (report.outOfSamplePnL / outOfSampleCandles) / (inSamplePnL / inSampleCandles);
+    }
+    report.elapsedMs = elapsedMs(start);
+    report.ok = true;
+    return report;
+}
+
+RobustnessAnalysis::MonteCarloReport RobustnessAnalysis::monteCarlo(const std::vector<Trade>& trades,
+    double startingBalance, const MonteCarloSettings& settings)
+{
+    MonteCarloReport report;
+    report.trades = trades.size();
+    report.permutations = settings.permutations;
+    report.startingBalance = startingBalance;
+    if (trades.empty() || settings.permutations == 0 || startingBalance <= 0.0) return report;
+
+    std::vector<double> pnl;
+    pnl.reserve(trades.size());
+    for (const Trade& trade : trades) pnl.push_back(trade.totalPnL);
+
+    std::vector<double> equity(pnl.size() + 1, startingBalance);
+    for (size_t i = 0; i < pnl.size(); ++i) equity[i + 1] = equity[i] + pnl[i];
+    report.actualFinalEquity = equity.back();
+    report.actualMaxDrawdown = maxDrawdownPercent(equity);
+
+    uint64_t seed = settings.seed != 0 ? settings.seed : std::random_device{}();
+    std::vector<double> finalEquity(settings.permutations);
+    std::vector<double> drawdown(settings.permutations);
+
+    Clock::time_point start = Clock::now();
+    size_t chunks = threadCount(settings.permutations);
+    runJobs(chunks, [&](size_t c) {
+        size_t first = settings.permutations * c / chunks;
+        size_t last = settings.permutations * (c + 1) / chunks;
+        std::vector<double> sequence = pnl;
+        std::vector<double> curve(pnl.size() + 1, startingBalance);
+        std::uniform_int_distribution<size_t> pick(0, pnl.size() - 1);
+
+        for (size_t p = first; p < last; ++p) {
+            // Seeded per permutation, so results do not depend on the chunking.
+            std::mt19937_64 rng(seed + p);
+            if (settings.resample) {
+                for (double& value : sequence) value = pnl[pick(rng)];
+            }
+            else {
+                // From the original order each time, so a permutation depends only on its seed.
+                sequence = pnl;
+                std::shuffle(sequence.begin(), sequence.end(), rng);
+            }
+
+            for (size_t i = 0; i < sequence.size(); ++i) curve[i + 1] = curve[i] + sequence[i];
+            finalEquity[p] = curve.back();
+            drawdown[p] = maxDrawdownPercent(curve);
+        }
+    });
+
+    size_t losses = std::count_if(finalEquity.begin(), finalEquity.end(),
+        [startingBalance](double value) { return value < startingBalance; });
+    report.lossProbability = static_cast<double>(losses) / static_cast<double>(finalEquity.size());
+
+    std::sort(finalEquity.begin(), finalEquity.end());
+    std::sort(drawdown.begin(), drawdown.end());
+    for (size_t i = 0; i < PERCENTILE_COUNT; ++i) {
+        report.finalEquity[i] = percentile(finalEquity, PERCENTILES[i]);
+        report.maxDrawdown[i] = percentile(drawdown, PERCENTILES[i]);
+    }
+
+    report.drawdownHistogramMax = drawdown.back();
+    report.drawdownHistogram.assign(DRAWDOWN_BINS, 0.0f);
+    for (double value : drawdown) {
+        size_t bin = report.drawdownHistogramMax > 0.0
+            ? static_cast<size_t>(value / report.drawdownHistogramMax * DRAWDOWN_BINS) : 0;
+        report.drawdownHistogram[std::min(bin, DRAWDOWN_BINS - 1)] += 1.0f;
+    }
+
+    report.elapsedMs = elapsedMs(start);
+    report.ok = true;
+    return report;
+}
+
+double RobustnessAnalysis::maxDrawdownPercent(const std::vector<double>& equity) {
+    double peak = 0.0;
+    double worst = 0.0;
+    for (double value : equity) {
+        peak = std::max(peak, value);
+        if (peak > 0.0) worst = std::max(worst, (peak - std::max(value, 0.0)) / peak * 100.0);
+    }
+    return worst;
+}
@@ -0,0 +1,524 @@
+#include "../../Public/Blueprints/StrategyHost.h"
+#include "../../Public/Exchanges/Bybit/BybitOrderGateway.h"
+#include "../../Public/Exchanges/Bybit/Bybitwebsocketmanager.h"
+#include "../../Public/Blueprints/StrategySnapshot.h"
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+
+class StrategyHost::Instance {
+public:
+    // Latest forming-candle state not yet evaluated; newer updates overwrite it in place.
+    struct PendingUpdate {
+        MarketData candle;
+        WorkStealingExecutor::Clock::time_point origin;
+        bool taken = false;
+    };
+
+    std::string symbol;
+    CandlestickDataManager dataManager;
+    TradingStatsManager stats;
+    BybitPriceCollector collector;
+    BybitTradeAggregator aggregator;
+    std::unique_ptr<BlueprintManager> blueprint;
+    std::shared_ptr<WorkStealingExecutor::Strand> strand;
+
+    std::mutex runMutex;            // held while the strategy evaluates and while the UI is attached
+    std::mutex updateMutex;
+    std::shared_ptr<PendingUpdate> openUpdate;
+    std::atomic<bool> removed{ false };
+    bool orderBook = false;
+
+    std::mutex statsMutex;
+    SymbolStats published;          // trading figures as of the last run on the strand
+
+    std::atomic<uint64_t> candles{ 0 };
+    std::atomic<uint64_t> evaluations{ 0 };
+    std::atomic<uint64_t> lastCandle{ 0 };     // timestamp of the last evaluated confirmed candle
+    uint64_t resumeAfter = 0;                   // from a restored snapshot; set before streaming
+};
+
+static MarketData toMarketData(const BybitCandle& candle) {
+    MarketData data;
+    data.index = candle.index;
+    data.timestamp = candle.timestamp;
+    data.open = candle.open;
+    data.high = candle.high;
+    data.low = candle.low;
+    data.close = candle.close;
+    data.volume = static_cast<float>(candle.volume);
+    data.mcap = 0.0f;
+    return data;
+}
+
+static std::string categoryToString(BybitCategory category) {
+    switch (category) {
+    case BybitCategory::SPOT: return "spot";
+    case BybitCategory::LINEAR: return "linear";
+    case BybitCategory::INVERSE: return "inverse";
+    case BybitCategory::OPTION: return "option";
+    default: return "spot";
+    }
+}
+
+const std::string& StrategyHost::AttachedInstance::getSymbol() const { return instance->symbol; }
+CandlestickDataManager& StrategyHost::AttachedInstance::getDataManager() { return instance->dataManager; }
+BlueprintManager& StrategyHost::AttachedInstance::getBlueprintManager() { return *instance->blueprint; }
+TradingStatsManager& StrategyHost::AttachedInstance::getTradingStats() { return instance->stats; }
+
+StrategyHost::StrategyHost(std::shared_ptr<const StrategyTemplate> strategy, const Settings& settings)
+    : strategy(std::move(strategy)), settings(settings) {
+}
+
+StrategyHost::StrategyHost(std::shared_ptr<const StrategyTemplate> strategy)
+    : StrategyHost(std::move(strategy), Settings()) {
+}
+
+StrategyHost::~StrategyHost() {
+    stop();
+}
+
+bool StrategyHost::start(const std::vector<std::string>& symbols) {
+    if (running.load()) return false;
+    if (!strategy) {
+        std::cout << "[StrategyHost] No strategy to run" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> unique;
+    for (const auto& symbol : symbols) {
+        if (!symbol.empty() && std::find(unique.begin(), unique.end(), symbol) == unique.end()) unique.push_back(symbol);
+    }
+    if (unique.empty()) return false;
+
+    // Threads of a previous run that stopped by itself.
+    if (loaderThread.joinable()) loaderThread.join();
+    if (dispatchThread.joinable()) dispatchThread.join();
+
+    running = true;
+    stopping = false;
+
+    if (settings.dispatchFills || !settings.snapshotDir.empty()) {
+        dispatchThread = std::thread(&StrategyHost::dispatchLoop, this);
+    }
+
+    loading = unique.size();
+    loaderThread = std::thread(&StrategyHost::loadLoop, this, std::move(unique));
+    return true;
+}
+
+void StrategyHost::loadLoop(std::vector<std::string> symbols) {
+    std::atomic<size_t> next{ 0 };
+    std::atomic<size_t> started{ 0 };
+
+    // History requests are network bound, so they overlap instead of running one by one.
+    auto load = [&]() {
+        for (size_t i = next++; i < symbols.size(); i = next++) {
+            if (!stopping.load() && addSymbol(symbols[i])) started++;
+            loading--;
+        }
+    };
+
+    std::vector<std::thread> loaders;
+    size_t count = std::min(HISTORY_LOADERS, symbols.size());
+    for (size_t i = 1; i < count; ++i) loaders.emplace_back(load);
+    load();
+    for (auto& loader : loaders) loader.join();
+
+    std::cout << "[StrategyHost] Running on " << started.load() << "/" << symbols.size()
+        << " symbols on " << WorkStealingExecutor::getInstance().getWorkerCount() << " workers" << std::endl;
+
+    if (started.load() == 0 && !stopping.load()) {
+        std::cout << "[StrategyHost] No symbol could be started" << std::endl;
+        running = false;
+    }
+}
+
+void StrategyHost::detachInstance(Instance& instance) {
+    instance.removed = true;
+    instance.collector.stopRealtimeStream();
+    instance.aggregator.stopRealtimeStream();
+    releaseOrderBook(instance);
+    instance.dataManager.DetachLiveOrders();
+}
+
+void StrategyHost::stop() {
+    // Symbols still loading are skipped; the ones in flight finish before instances are taken.
+    stopping = true;
+    if (loaderThread.joinable()) loaderThread.join();
+
+    std::map<std::string, std::shared_ptr<Instance>> stopped;
+    {
+        std::lock_guard<std::mutex> lock(instancesMutex);
+        stopped.swap(instances);
+    }
+    for (auto& [symbol, instance] : stopped) {
+        detachInstance(*instance);
+    }
+    // Queued candles are skipped once removed is set; wait out the evaluation in flight.
+    for (auto& [symbol, instance] : stopped) {
+        WorkStealingExecutor::getInstance().waitIdle(instance->strand);
+    }
+
+    running = false;
+    if (dispatchThread.joinable()) dispatchThread.join();
+
+    for (auto& [symbol, instance] : stopped) {
+        saveSnapshot(*instance);
+    }
+}
+
+bool StrategyHost::addSymbol(const std::string& symbol) {
+    if (!running.load() || stopping.load() || symbol.empty()) return false;
+    {
+        std::lock_guard<std::mutex> lock(instancesMutex);
+        if (instances.count(symbol)) return true;
+    }
+
+    std::shared_ptr<Instance> instance = createInstance(symbol);
+    if (!instance) return false;
+
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    instances[symbol] = instance;
+    return true;
+}
+
+void StrategyHost::removeSymbol(const std::string& symbol) {
+    std::shared_ptr<Instance> instance;
+    {
+        std::lock_guard<std::mutex> lock(instancesMutex);
+        auto it = instances.find(symbol);
+        if (it == instances.end()) return;
+        instance = it->second;
+        instances.erase(it);
+    }
+
+    // Queued candles keep the instance alive and are skipped by the strand. As in stop(),
+    // the final save waits for the evaluation or fill in flight there; fills reach the
+    // instance only on its strand under runMutex, which saveSnapshot() holds as well.
+    detachInstance(*instance);
+    WorkStealingExecutor::getInstance().waitIdle(instance->strand);
+    saveSnapshot(*instance);
+}
+
+std::vector<std::string> StrategyHost::getSymbols() const {
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    std::vector<std::string> symbols;
+    symbols.reserve(instances.size());
+    for (const auto& [symbol, instance] : instances) symbols.push_back(symbol);
+    return symbols;
+}
+
+StrategyHost::AttachedInstance StrategyHost::attach(const std::string& symbol) {
+    std::shared_ptr<Instance> instance;
+    {
+        std::lock_guard<std::mutex> lock(instancesMutex);
+        auto it = instances.find(symbol);
+        if (it == instances.end()) return AttachedInstance();
+        instance = it->second;
+    }
+
+    AttachedInstance attached;
+    attached.lock = std::unique_lock<std::mutex>(instance->runMutex);
+    attached.instance = instance.get();
+    return attached;
+}
+
+std::shared_ptr<StrategyHost::Instance> StrategyHost::createInstance(const std::string& symbol) {
+    auto instance = std::make_shared<Instance>();
+    instance->symbol = symbol;
+    instance->strand = WorkStealingExecutor::getInstance().createStrand(symbol);
+    instance->stats.SetStartingBalance(settings.startingBalance);
+
+    instance->dataManager.SetSymbol(symbol);
+    instance->dataManager.SetBacktestTradingStats(&instance->stats);
+    instance->dataManager.SetRuntimeTradingStats(&instance->stats);
+
+    instance->blueprint = strategy->instantiate(&instance->dataManager);
+    instance->dataManager.SetBlueprintManager(instance->blueprint.get());
+
+    std::weak_ptr<Instance> weak = instance;
+
+    // Order fills run on the strand like candles, under the same lock as an evaluation.
+    instance->dataManager.SetStrategyPoster([weak](std::function<void()> task) {
+        auto target = weak.lock();
+        if (!target) return;
+        WorkStealingExecutor::getInstance().post(target->strand, [target, task]() {
+            std::lock_guard<std::mutex> lock(target->runMutex);
+            task();
+            publishStats(*target);
+            });
+        });
+
+    if (settings.orderBookDepth > 0) {
+        std::shared_ptr<const OrderBook> book = BybitWebSocketManager::getInstance().subscribeOrderBook(
+            symbol, categoryToString(settings.category), settings.orderBookDepth);
+        if (!book) {
+            std::cout << "[StrategyHost] Failed to subscribe order book of " << symbol << std::endl;
+            return nullptr;
+        }
+        instance->dataManager.SetOrderBook(book);
+        instance->orderBook = true;
+    }
+
+    if (settings.tradeBars) {
+        // Trade bars start from the first trade; every bar runs the strategy.
+        instance->dataManager.SetRuntimeMode(true);
+
+        BybitTradeAggregator& aggregator = instance->aggregator;
+        aggregator.setSymbol(symbol, settings.category);
+        aggregator.setBarSpec(settings.bars);
+        aggregator.setOnNewCandleCallback([this, weak](const BybitCandle& candle) {
+            if (auto target = weak.lock()) onCandle(target, candle);
+            });
+        aggregator.setOnCandleUpdateCallback([this, weak](const BybitCandle& candle) {
+            if (auto target = weak.lock()) onCandleUpdate(target, candle);
+            });
+
+        restoreSnapshot(*instance);
+        publishStats(*instance);
+        if (!aggregator.startRealtimeStream()) {
+            std::cout << "[StrategyHost] Failed to subscribe trades of " << symbol << std::endl;
+            releaseOrderBook(*instance);
+            return nullptr;
+        }
+        return instance;
+    }
+
+    BybitPriceCollector& collector = instance->collector;
+    collector.setSymbol(symbol, settings.category);
+    collector.setInterval(settings.interval);
+    collector.setDataManager(&instance->dataManager);
+
+    if (!collector.loadHistoricalData(settings.historyLimit)) {
+        std::cout << "[StrategyHost] Failed to load history for " << symbol << std::endl;
+        releaseOrderBook(*instance);
+        return nullptr;
+    }
+
+    restoreSnapshot(*instance);
+    publishStats(*instance);
+
+    // History is in place; from here every candle runs the strategy.
+    instance->dataManager.SetRuntimeMode(true);
+
+    collector.setOnNewCandleCallback([this, weak](const BybitCandle& candle) {
+        if (auto target = weak.lock()) onCandle(target, candle);
+        });
+    collector.setOnCandleUpdateCallback([this, weak](const BybitCandle& candle) {
+        if (auto target = weak.lock()) onCandleUpdate(target, candle);
+        });
+
+    if (!collector.startRealtimeStream()) {
+        std::cout << "[StrategyHost] Failed to subscribe " << symbol << std::endl;
+        releaseOrderBook(*instance);
+        return nullptr;
+    }
+    return instance;
+}
+
+void StrategyHost::releaseOrderBook(Instance& instance) {
+    if (!instance.orderBook) return;
+    instance.orderBook = false;
+
+    // The data manager keeps its pointer; the book just stops updating.
+    BybitWebSocketManager::getInstance().unsubscribeOrderBook(
+        instance.symbol, categoryToString(settings.category), settings.orderBookDepth);
+}
+
+void StrategyHost::onCandle(const std::shared_ptr<Instance>& instance, const BybitCandle& candle) {
+    if (!running.load() || instance->removed.load()) return;
+    // Evaluated before the snapshot was taken.
+    if (candle.timestamp <= instance->resumeAfter) return;
+
+    {
+        // Updates after this point belong to the next candle and must not merge into a queued one.
+        std::lock_guard<std::mutex> lock(instance->updateMutex);
+        instance->openUpdate.reset();
+    }
+    instance->candles++;
+
+    MarketData data = toMarketData(candle);
+    WorkStealingExecutor::getInstance().post(instance->strand, [instance, data]() {
+        if (instance->removed.load()) return;
+        std::lock_guard<std::mutex> lock(instance->runMutex);
+        instance->dataManager.addCandle(data);
+        instance->evaluations++;
+        instance->lastCandle = data.timestamp;
+        publishStats(*instance);
+        }, WorkStealingExecutor::Clock::now());
+}
+
+void StrategyHost::onCandleUpdate(const std::shared_ptr<Instance>& instance, const BybitCandle& candle) {
+    if (!running.load() || instance->removed.load()) return;
+
+    std::shared_ptr<Instance::PendingUpdate> update;
+    {
+        std::lock_guard<std::mutex> lock(instance->updateMutex);
+        if (instance->openUpdate && !instance->openUpdate->taken) {
+            // An evaluation for this candle is already queued; it will pick up the newer values.
+            instance->openUpdate->candle = toMarketData(candle);
+            return;
+        }
+        update = std::make_shared<Instance::PendingUpdate>();
+        update->candle = toMarketData(candle);
+        update->origin = WorkStealingExecutor::Clock::now();
+        instance->openUpdate = update;
+    }
+
+    WorkStealingExecutor::getInstance().post(instance->strand, [instance, update]() {
+        MarketData data;
+        {
+            std::lock_guard<std::mutex> lock(instance->updateMutex);
+            update->taken = true;
+            data = update->candle;
+        }
+        if (instance->removed.load()) return;
+        std::lock_guard<std::mutex> lock(instance->runMutex);
+        instance->dataManager.UpdateLastCandle(data);
+        instance->evaluations++;
+        publishStats(*instance);
+        }, update->origin);
+}
+
+void StrategyHost::dispatchLoop() {
+    // Only this thread saves periodic snapshots, so the timer needs no synchronization.
+    std::chrono::steady_clock::time_point lastSnapshot = std::chrono::steady_clock::now();
+    while (running.load()) {
+        if (settings.dispatchFills) Bybit::BybitOrderGateway::getInstance().dispatchCompleted();
+        maintainSnapshots(lastSnapshot);
+        std::this_thread::sleep_for(std::chrono::milliseconds(DISPATCH_INTERVAL_MS));
+    }
+    if (settings.dispatchFills) Bybit::BybitOrderGateway::getInstance().dispatchCompleted();
+}
+
+std::string StrategyHost::snapshotPath(const std::string& symbol) const {
+    return settings.snapshotDir + "/" + symbol + ".dxss";
+}
+
+void StrategyHost::saveSnapshot(Instance& instance) {
+    if (settings.snapshotDir.empty()) return;
+
+    std::lock_guard<std::mutex> lock(instance.runMutex);
+    StrategySnapshot::save(snapshotPath(instance.symbol), *instance.blueprint, instance.stats,
+        instance.symbol, instance.lastCandle.load());
+}
+
+void StrategyHost::restoreSnapshot(Instance& instance) {
+    if (settings.snapshotDir.empty()) return;
+
+    StrategySnapshot::Info info;
+    if (!StrategySnapshot::load(snapshotPath(instance.symbol), *instance.blueprint, instance.stats, info)) return;
+
+    instance.lastCandle = info.lastCandle;
+    instance.resumeAfter = info.lastCandle;
+
+    // Signals of candles closed while the app was down are stale; live orders must not
+    // be placed for them, so they stay history and the strategy resumes with the next one.
+    size_t missed = 0;
+    const std::vector<MarketData>& history = instance.dataManager.getData();
+    for (auto it = history.rbegin(); it != history.rend() && it->timestamp > info.lastCandle; ++it) missed++;
+
+    std::cout << "[StrategyHost] Restored " << instance.symbol << " (" << info.variables << " variables, "
+        << instance.stats.GetTotalOrdersCount() << " orders), " << missed << " newer candles not replayed" << std::endl;
+}
+
+void StrategyHost::saveSnapshots() {
+    std::vector<std::shared_ptr<Instance>> current;
+    {
+        std::lock_guard<std::mutex> lock(instancesMutex);
+        for (const auto& [symbol, instance] : instances) current.push_back(instance);
+    }
+    for (auto& instance : current) {
+        saveSnapshot(*instance);
+    }
+}
+
+void StrategyHost::maintainSnapshots(std::chrono::steady_clock::time_point& lastSnapshot) {
+    if (settings.snapshotDir.empty() || !running.load()) return;
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastSnapshot < std::chrono::seconds(std::max(1, settings.snapshotIntervalSec))) return;
+    saveSnapshots();
+    lastSnapshot = now;
+}
+
+void StrategyHost::publishStats(Instance& instance) {
+    const TradingStatsManager& tsm = instance.stats;
+    CandleSeriesView series = instance.dataManager.getPublicData();
+    double close = series.empty() ? 0.0 : series.back().close;
+
+    std::lock_guard<std::mutex> lock(instance.statsMutex);
+    SymbolStats& stats = instance.published;
+    stats.realizedPnL = tsm.GetRealizedPnL();
+    stats.unrealizedPnL = tsm.GetUnrealizedPnL(close);
+    stats.winRate = tsm.GetWinRate();
+    stats.orders = tsm.GetTotalOrdersCount();
+    stats.openPositions = tsm.GetOpenPositionsCount();
+    stats.trades = tsm.GetTotalTradesCount();
+    stats.startingBalance = tsm.GetStartingBalance();
+    stats.currentBalance = tsm.GetCurrentBalance();
+}
+
+void StrategyHost::collectStats(Instance& instance, SymbolStats& stats) {
+    {
+        std::lock_guard<std::mutex> lock(instance.statsMutex);
+        stats = instance.published;
+    }
+
+    stats.symbol = instance.symbol;
+    bool tradeBars = instance.aggregator.isStreaming();
+    stats.streaming = tradeBars || instance.collector.isStreaming();
+    stats.candles = instance.candles.load();
+    stats.evaluations = instance.evaluations.load();
+    stats.lastClose = tradeBars ? instance.aggregator.getCurrentPrice() : instance.collector.getCurrentPrice();
+}
+
+bool StrategyHost::getSymbolStats(const std::string& symbol, SymbolStats& stats) const {
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    auto it = instances.find(symbol);
+    if (it == instances.end()) return false;
+    collectStats(*it->second, stats);
+    return true;
+}
+
+std::vector<StrategyHost::SymbolStats> StrategyHost::getAllSymbolStats() const {
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    std::vector<SymbolStats> result(instances.size());
+    size_t i = 0;
+    for (const auto& [symbol, instance] : instances) {
+        collectStats(*instance, result[i++]);
+    }
+    return result;
+}
+
+StrategyHost::PortfolioStats StrategyHost::getPortfolioStats() const {
+    PortfolioStats portfolio;
+    double weightedWins = 0.0;
+
+    for (const auto& stats : getAllSymbolStats()) {
+        portfolio.symbols++;
+        if (stats.streaming) portfolio.streaming++;
+        portfolio.realizedPnL += stats.realizedPnL;
+        portfolio.unrealizedPnL += stats.unrealizedPnL;
+        portfolio.orders += stats.orders;
+        portfolio.openPositions += stats.openPositions;
+        portfolio.trades += stats.trades;
+        portfolio.startingBalance += stats.startingBalance;
+        portfolio.currentBalance += stats.currentBalance;
+        weightedWins += stats.winRate * stats.trades;
+    }
+
+    if (portfolio.trades > 0) portfolio.winRate = weightedWins / portfolio.trades;
+    return portfolio;
+}
+
+size_t StrategyHost::pendingJobs() const {
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    size_t pending = 0;
+    for (const auto& [symbol, instance] : instances) pending += instance->strand->pending();
+    return pending;
+}
+
+WorkStealingExecutor::LatencyStats StrategyHost::getLatencyStats() const {
+    return WorkStealingExecutor::getInstance().getLatencyStats();
+}
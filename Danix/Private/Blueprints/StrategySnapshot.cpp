@@ -0,0 +1,423 @@
+#include "../../Public/Blueprints/StrategySnapshot.h"
+#include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/Blueprints/BlueprintBinary.h"
+#include "../../Public/StatsManager/TradingStatsManager.h"
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+static const char SNAPSHOT_MAGIC[4] = { 'D', 'X', 'S', 'S' };
+static constexpr size_t VARIABLE_MIN_SIZE = 5;    // GUID length + type byte
+
+namespace {
+
+class Writer {
+public:
+    explicit Writer(std::vector<uint8_t>& out) : buffer(out) {}
+
+    template<typename T>
+    void put(T value) {
+        size_t offset = buffer.size();
+        buffer.resize(offset + sizeof(T));
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    void putString(const std::string& value) {
+        put<uint32_t>((uint32_t)value.size());
+        size_t offset = buffer.size();
+        buffer.resize(offset + value.size());
+        if (!value.empty()) std::memcpy(buffer.data() + offset, value.data(), value.size());
+    }
+
+    void putDoubles(const std::vector<double>& values) {
+        put<uint32_t>((uint32_t)values.size());
+        for (double value : values) put<double>(value);
+    }
+
+    template<typename T>
+    void putArray(const ArrayValue<T>& array) {
+        put<uint32_t>((uint32_t)array.window());
+        put<uint32_t>((uint32_t)array.size());
+        for (size_t i = 0; i < array.size(); ++i) {
+            if constexpr (std::is_same_v<T, std::string>) putString(array[i]);
+            else if constexpr (std::is_same_v<T, bool>) put<uint8_t>(array[i] ? 1 : 0);
+            else if constexpr (std::is_same_v<T, int>) put<int32_t>(array[i]);
+            else if constexpr (std::is_same_v<T, float>) put<float>(array[i]);
+            else put<double>((double)array[i]);
+        }
+    }
+
+private:
+    std::vector<uint8_t>& buffer;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : cursor(data), end(data + size) {}
+
+    size_t remaining() const { return end - cursor; }
+
+    template<typename T>
+    bool get(T& value) {
+        if ((size_t)(end - cursor) < sizeof(T)) return false;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    bool getString(std::string& value) {
+        uint32_t length = 0;
+        if (!get(length) || (size_t)(end - cursor) < length) return false;
+        value.assign((const char*)cursor, length);
+        cursor += length;
+        return true;
+    }
+
+    bool getDoubles(std::vector<double>& values) {
+        uint32_t count = 0;
+        if (!get(count) || (size_t)(end - cursor) / sizeof(double) < count) return false;
+        values.resize(count);
+        for (double& value : values) get(value);
+        return true;
+    }
+
+    template<typename T>
+    bool getArray(ArrayValue<T>& array) {
+        uint32_t window = 0, count = 0;
+        if (!get(window) || !get(count)) return false;
+
+        std::vector<T> items;
+        items.reserve(std::min<size_t>(count, end - cursor));
+        for (uint32_t i = 0; i < count; ++i) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                std::string item;
+                if (!getString(item)) return false;
+                items.push_back(std::move(item));
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                uint8_t item = 0;
+                if (!get(item)) return false;
+                items.push_back(item != 0);
+            }
+            else if constexpr (std::is_same_v<T, int>) {
+                int32_t item = 0;
+                if (!get(item)) return false;
+                items.push_back(item);
+            }
+            else if constexpr (std::is_same_v<T, float>) {
+                float item = 0.0f;
+                if (!get(item)) return false;
+                items.push_back(item);
+            }
+            else {
+                double item = 0.0;
+                if (!get(item)) return false;
+                items.push_back((T)item);
+            }
+        }
+
+        array.clear();
+        array.setWindow(0);
+        array.assign(items);
+        array.setWindow(window);
+        return true;
+    }
+
+private:
+    const uint8_t* cursor;
+    const uint8_t* end;
+};
+
+// Decoded value of one variable, applied only after the whole snapshot parsed.
+struct VariableState {
+    std::string guid;
+    PinType type = PinType::INT;
+    int32_t intValue = 0;
+    float floatValue = 0.0f;
+    double doubleValue = 0.0;
+    bool boolValue = false;
+    std::string stringValue;
+    ArrayValue<int> arrayInt;
+    ArrayValue<float> arrayFloat;
+    ArrayValue<Real> arrayDouble;
+    ArrayValue<bool> arrayBool;
+    ArrayValue<std::string> arrayString;
+};
+
+void writeVariable(Writer& writer, const Variable& variable) {
+    writer.putString(variable.guid);
+    writer.put<uint8_t>((uint8_t)variable.type);
+
+    switch (variable.type) {
+    case PinType::INT: writer.put<int32_t>(variable.intValue); break;
+    case PinType::FLOAT: writer.put<float>(variable.floatValue); break;
+    case PinType::DOUBLE: writer.put<double>((double)variable.doubleValue); break;
+    case PinType::BOOL: writer.put<uint8_t>(variable.boolValue ? 1 : 0); break;
+    case PinType::STRING: writer.putString(variable.stringValue); break;
+    case PinType::ARRAY_INT: writer.putArray(variable.arrayIntValue); break;
+    case PinType::ARRAY_FLOAT: writer.putArray(variable.arrayFloatValue); break;
+    case PinType::ARRAY_DOUBLE: writer.putArray(variable.arrayDoubleValue); break;
+    case PinType::ARRAY_BOOL: writer.putArray(variable.arrayBoolValue); break;
+    case PinType::ARRAY_STRING: writer.putArray(variable.arrayStringValue); break;
+    default: break;
+    }
+}
+
+bool readVariable(Reader& reader, VariableState& state) {
+    uint8_t type = 0;
+    if (!reader.getString(state.guid) || !reader.get(type)) return false;
+    state.type = (PinType)type;
+
+    switch (state.type) {
+    case PinType::INT: return reader.get(state.intValue);
+    case PinType::FLOAT: return reader.get(state.floatValue);
+    case PinType::DOUBLE: return reader.get(state.doubleValue);
+    case PinType::BOOL: {
+        uint8_t value = 0;
+        if (!reader.get(value)) return false;
+        state.boolValue = value != 0;
+        return true;
+    }
+    case PinType::STRING: return reader.getString(state.stringValue);
+    case PinType::ARRAY_INT: return reader.getArray(state.arrayInt);
+    case PinType::ARRAY_FLOAT: return reader.getArray(state.arrayFloat);
+    case PinType::ARRAY_DOUBLE: return reader.getArray(state.arrayDouble);
+    case PinType::ARRAY_BOOL: return reader.getArray(state.arrayBool);
+    case PinType::ARRAY_STRING: return reader.getArray(state.arrayString);
+    default: return true;
+    }
+}
+
+void applyVariable(Variable& variable, const VariableState& state) {
+    switch (state.type) {
+    case PinType::INT: variable.intValue = state.intValue; break;
+    case PinType::FLOAT: variable.floatValue = state.floatValue; break;
+    case PinType::DOUBLE: variable.doubleValue = (Real)state.doubleValue; break;
+    case PinType::BOOL: variable.boolValue = state.boolValue; break;
+    case PinType::STRING: variable.stringValue = state.stringValue; break;
+    case PinType::ARRAY_INT: variable.arrayIntValue = state.arrayInt; break;
+    case PinType::ARRAY_FLOAT: variable.arrayFloatValue = state.arrayFloat; break;
+    case PinType::ARRAY_DOUBLE: variable.arrayDoubleValue = state.arrayDouble; break;
+    case PinType::ARRAY_BOOL: variable.arrayBoolValue = state.arrayBool; break;
+    case PinType::ARRAY_STRING: variable.arrayStringValue = state.arrayString; break;
+    default: break;
+    }
+}
+
+}
+
+void StrategySnapshot::capture(const BlueprintManager& blueprint, const TradingStatsManager& stats,
+    const std::string& symbol, uint64_t lastCandle, std::vector<uint8_t>& out)
+{
+    out.clear();
+    Writer writer(out);
+
+    uint64_t now = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    for (char c : SNAPSHOT_MAGIC) writer.put<char>(c);
+    writer.put<uint16_t>(VERSION);
+    writer.put<uint16_t>(0);
+    writer.put<uint64_t>(lastCandle);
+    writer.put<uint64_t>(now);
+    writer.putString(symbol);
+
+    // Non-global variables reset every candle, so only globals carry state.
+    uint32_t globals = 0;
+    for (const auto& [guid, variable] : blueprint.getVariables()) {
+        if (variable->global) globals++;
+    }
+    writer.put<uint32_t>(globals);
+    for (const auto& [guid, variable] : blueprint.getVariables()) {
+        if (variable->global) writeVariable(writer, *variable);
+    }
+
+    writer.put<double>(stats.startingBalance);
+    writer.put<double>(stats.currentBalance);
+    writer.put<double>(stats.totalShares);
+    writer.put<double>(stats.fixedCommission);
+    writer.put<double>(stats.fixedPercentCommission);
+    writer.put<double>(stats.totalCommissionPaid);
+    writer.put<int32_t>(stats.nextOrderId);
+
+    writer.put<uint32_t>((uint32_t)stats.allOrders.size());
+    for (const Order& order : stats.allOrders) {
+        writer.put<int32_t>(order.id);
+        writer.put<uint8_t>((uint8_t)order.type);
+        writer.put<uint64_t>(order.time);
+        writer.put<double>(order.price);
+        writer.put<double>(order.quantity);
+        writer.put<double>(order.commission);
+        writer.put<uint8_t>(order.isExecuted ? 1 : 0);
+        writer.put<double>(order.leverage);
+    }
+
+    writer.put<uint32_t>((uint32_t)stats.allPositions.size());
+    for (const Position& position : stats.allPositions) {
+        writer.put<int32_t>(position.buyOrderId);
+        writer.put<int32_t>(position.sellOrderId);
+        writer.put<double>(position.buyPrice);
+        writer.put<double>(position.sellPrice);
+        writer.put<double>(position.quantity);
+        writer.put<uint64_t>(position.buyTime);
+        writer.put<uint64_t>(position.sellTime);
+        writer.put<double>(position.buyCommission);
+        writer.put<double>(position.sellCommission);
+        writer.put<double>(position.pnl);
+        writer.put<double>(position.roi);
+        writer.put<uint8_t>(position.isOpen ? 1 : 0);
+        writer.put<uint8_t>((uint8_t)position.mode);
+        writer.put<uint8_t>(position.isLong ? 1 : 0);
+        writer.put<double>(position.leverage);
+        writer.put<double>(position.liquidationPrice);
+        writer.put<double>(position.initialMargin);
+    }
+
+    writer.putDoubles(stats.balanceHistory);
+    writer.putDoubles(stats.balanceTimepoints);
+    writer.putDoubles(stats.orderCandlesIDs);
+}
+
+bool StrategySnapshot::restore(const uint8_t* data, size_t size, BlueprintManager& blueprint,
+    TradingStatsManager& stats, Info& info)
+{
+    if (size < sizeof(SNAPSHOT_MAGIC) || std::memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        return false;
+    }
+
+    Reader reader(data + sizeof(SNAPSHOT_MAGIC), size - sizeof(SNAPSHOT_MAGIC));
+    uint16_t version = 0, flags = 0;
+    if (!reader.get(version) || !reader.get(flags) || version != VERSION) {
+        std::cout << "[StrategySnapshot] Unsupported snapshot version " << version << std::endl;
+        return false;
+    }
+
+    Info parsed;
+    if (!reader.get(parsed.lastCandle) || !reader.get(parsed.savedAt) || !reader.getString(parsed.symbol)) {
+        return false;
+    }
+
+    // A variable takes at least its GUID length and type byte; a count the rest of the file
+    // cannot hold is corrupt, not an allocation to attempt.
+    uint32_t variableCount = 0;
+    if (!reader.get(variableCount) || reader.remaining() / VARIABLE_MIN_SIZE < variableCount) return false;
+    std::vector<VariableState> variables(variableCount);
+    for (VariableState& state : variables) {
+        if (!readVariable(reader, state)) return false;
+    }
+
+    // Parsed into a separate manager, so a truncated file leaves the live one untouched.
+    TradingStatsManager restored;
+    uint32_t orderCount = 0, positionCount = 0;
+    if (!reader.get(restored.startingBalance) || !reader.get(restored.currentBalance) ||
+        !reader.get(restored.totalShares) || !reader.get(restored.fixedCommission) ||
+        !reader.get(restored.fixedPercentCommission) || !reader.get(restored.totalCommissionPaid) ||
+        !reader.get(restored.nextOrderId) || !reader.get(orderCount)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < orderCount; ++i) {
+        Order order;
+        uint8_t type = 0, executed = 0;
+        if (!reader.get(order.id) || !reader.get(type) || !reader.get(order.time) ||
+            !reader.get(order.price) || !reader.get(order.quantity) || !reader.get(order.commission) ||
+            !reader.get(executed) || !reader.get(order.leverage)) {
+            return false;
+        }
+        order.type = (OrderType)type;
+        order.isExecuted = executed != 0;
+        restored.allOrders.push_back(order);
+    }
+
+    if (!reader.get(positionCount)) return false;
+    for (uint32_t i = 0; i < positionCount; ++i) {
+        Position position;
+        uint8_t open = 0, mode = 0, isLong = 0;
+        if (!reader.get(position.buyOrderId) || !reader.get(position.sellOrderId) ||
+            !reader.get(position.buyPrice) || !reader.get(position.sellPrice) || !reader.get(position.quantity) ||
+            !reader.get(position.buyTime) || !reader.get(position.sellTime) ||
+            !reader.get(position.buyCommission) || !reader.get(position.sellCommission) ||
+            !reader.get(position.pnl) || !reader.get(position.roi) ||
+            !reader.get(open) || !reader.get(mode) || !reader.get(isLong) ||
+            !reader.get(position.leverage) || !reader.get(position.liquidationPrice) || !reader.get(position.initialMargin)) {
+            return false;
+        }
+        position.isOpen = open != 0;
+        position.mode = (PositionMode)mode;
+        position.isLong = isLong != 0;
+        restored.allPositions.push_back(position);
+    }
+
+    if (!reader.getDoubles(restored.balanceHistory) || !reader.getDoubles(restored.balanceTimepoints) ||
+        !reader.getDoubles(restored.orderCandlesIDs)) {
+        return false;
+    }
+
+    for (const VariableState& state : variables) {
+        Variable* variable = blueprint.getVariable(state.guid);
+        if (!variable || !variable->global || variable->type != state.type) {
+            parsed.skipped++;
+            continue;
+        }
+        applyVariable(*variable, state);
+        parsed.variables++;
+    }
+
+    stats.allOrders = std::move(restored.allOrders);
+    stats.allPositions = std::move(restored.allPositions);
+    stats.balanceHistory = std::move(restored.balanceHistory);
+    stats.balanceTimepoints = std::move(restored.balanceTimepoints);
+    stats.orderCandlesIDs = std::move(restored.orderCandlesIDs);
+    stats.startingBalance = restored.startingBalance;
+    stats.currentBalance = restored.currentBalance;
+    stats.totalShares = restored.totalShares;
+    stats.fixedCommission = restored.fixedCommission;
+    stats.fixedPercentCommission = restored.fixedPercentCommission;
+    stats.totalCommissionPaid = restored.totalCommissionPaid;
+    stats.nextOrderId = restored.nextOrderId;
+    stats.InvalidateStatsCache();
+
+    info = parsed;
+    return true;
+}
+
+bool StrategySnapshot::save(const std::string& filename, const BlueprintManager& blueprint,
+    const TradingStatsManager& stats, const std::string& symbol, uint64_t lastCandle)
+{
+    std::vector<uint8_t> data;
+    capture(blueprint, stats, symbol, lastCandle, data);
+
+    std::error_code error;
+    std::filesystem::path path(filename);
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), error);
+    }
+
+    std::string temporary = filename + ".tmp";
+    if (!BlueprintBinary::writeFile(temporary, data)) {
+        std::cout << "[StrategySnapshot] Failed to write " << temporary << std::endl;
+        return false;
+    }
+
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::cout << "[StrategySnapshot] Failed to replace " << filename << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool StrategySnapshot::load(const std::string& filename, BlueprintManager& blueprint,
+    TradingStatsManager& stats, Info& info)
+{
+    std::vector<uint8_t> data;
+    if (!BlueprintBinary::readFile(filename, data)) return false;
+
+    if (!restore(data.data(), data.size(), blueprint, stats, info)) {
+        std::cout << "[StrategySnapshot] Ignoring damaged snapshot " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
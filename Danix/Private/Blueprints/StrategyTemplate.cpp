@@ -0,0 +1,190 @@
+#include "../../Public/Blueprints/StrategyTemplate.h"
+#include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/Systems/GuidGenerator.h"
+#include <iostream>
+
+std::shared_ptr<const StrategyTemplate> StrategyTemplate::compile(BlueprintManager& source) {
+    BlueprintBinary::Graph graph;
+    if (!BlueprintBinary::fromJson(source.serializeToJson(), graph)) return nullptr;
+    return compileGraph(std::move(graph));
+}
+
+std::shared_ptr<const StrategyTemplate> StrategyTemplate::compileFile(const std::string& filename) {
+    std::vector<uint8_t> data;
+    if (!BlueprintBinary::readFile(filename, data)) {
+        std::cout << "[StrategyTemplate] Failed to open file: " << filename << std::endl;
+        return nullptr;
+    }
+
+    BlueprintBinary::Graph graph;
+    if (BlueprintBinary::isBinary(data.data(), data.size())) {
+        if (!BlueprintBinary::read(data.data(), data.size(), graph)) return nullptr;
+    }
+    else {
+        try {
+            if (!BlueprintBinary::fromJson(nlohmann::json::parse(data.begin(), data.end()), graph)) return nullptr;
+        }
+        catch (const std::exception& e) {
+            std::cout << "[StrategyTemplate] JSON parsing error: " << e.what() << std::endl;
+            return nullptr;
+        }
+    }
+    return compileGraph(std::move(graph));
+}
+
+std::shared_ptr<const StrategyTemplate> StrategyTemplate::compileGraph(BlueprintBinary::Graph graph) {
+    std::shared_ptr<StrategyTemplate> compiled(new StrategyTemplate());
+    compiled->m_graph = std::move(graph);
+    const BlueprintBinary::Graph& g = compiled->m_graph;
+
+    compiled->m_nodes.reserve(g.nodes.size());
+    for (uint32_t i = 0; i < g.nodes.size(); ++i) {
+        const auto& record = g.nodes[i];
+
+        CompiledNode node;
+        node.record = i;
+        node.factory = NodeRegistry::getInstance().getFactory(g.str(record.type));
+        if (!node.factory) {
+            std::cout << "Unknown node type: " << g.str(record.type) << std::endl;
+            continue;
+        }
+
+        try {
+            if (!record.data.empty()) node.data = nlohmann::json::from_cbor(record.data);
+        }
+        catch (const std::exception& e) {
+            std::cout << "[StrategyTemplate] Bad node data for " << g.str(record.guid) << ": " << e.what() << std::endl;
+            return nullptr;
+        }
+        compiled->m_nodes.push_back(std::move(node));
+    }
+
+    // An input takes one link and an exec output drives one input; anything beyond
+    // that, or a type mismatch, goes through createConnection to keep its semantics.
+    std::vector<bool> inputLinked(g.pins.size(), false);
+    std::vector<bool> execLinked(g.pins.size(), false);
+
+    compiled->m_links.reserve(g.connections.size());
+    for (const auto& conn : g.connections) {
+        const auto& from = g.pins[conn.fromPin];
+        const auto& to = g.pins[conn.toPin];
+
+        CompiledLink link;
+        link.fromPin = conn.fromPin;
+        link.toPin = conn.toPin;
+        link.direct = from.type == to.type && !inputLinked[conn.toPin] &&
+            !(from.type == static_cast<uint8_t>(PinType::EXEC) && execLinked[conn.fromPin]);
+
+        inputLinked[conn.toPin] = true;
+        if (from.type == static_cast<uint8_t>(PinType::EXEC)) execLinked[conn.fromPin] = true;
+
+        compiled->m_links.push_back(link);
+    }
+
+    return compiled;
+}
+
+std::unique_ptr<BlueprintManager> StrategyTemplate::instantiate(CandlestickDataManager* dataManager) const {
+    auto manager = std::make_unique<BlueprintManager>();
+    manager->SetDataManager(dataManager);
+    instantiateInto(*manager);
+    return manager;
+}
+
+bool StrategyTemplate::instantiateInto(BlueprintManager& target) const {
+    const BlueprintBinary::Graph& g = m_graph;
+
+    target.clearAllBeforeLoad();
+    target.variables.clear();
+    target.FirstEntry = true;
+
+    for (const auto& var : g.variables) {
+        const std::string& guid = g.str(var.guid);
+        PinType type = static_cast<PinType>(var.type);
+        auto variable = std::make_unique<Variable>(g.str(var.name), guid, type, var.global != 0);
+
+        switch (type) {
+        case PinType::INT:
+            variable->def_intValue = var.intValue;
+            break;
+        case PinType::FLOAT:
+            variable->def_floatValue = var.floatValue;
+            break;
+        case PinType::DOUBLE:
+            variable->def_doubleValue = var.doubleValue;
+            break;
+        case PinType::BOOL:
+            variable->def_boolValue = var.boolValue != 0;
+            break;
+        case PinType::STRING:
+            variable->def_stringValue = g.str(var.stringValue);
+            break;
+        }
+        variable->setDefaultValue();
+        target.variables[guid] = std::move(variable);
+    }
+
+    std::vector<Pin*> pins(g.pins.size(), nullptr);
+
+    for (const auto& compiled : m_nodes) {
+        const auto& record = g.nodes[compiled.record];
+        std::unique_ptr<BasicNode> node;
+        {
+            GUIDGenerator::DeferScope deferGuids;
+            node = compiled.factory(g.str(record.guid), &target);
+        }
+
+        node->position.x = record.x;
+        node->position.y = record.y;
+
+        for (size_t i = 0; i < record.inputCount && i < node->inputs.size(); i++) {
+            const BlueprintBinary::PinRecord& pin_record = g.pins[record.firstPin + i];
+            auto& pin = node->inputs[i];
+
+            pin->pin_guid = g.str(pin_record.guid);
+            pin->default_stored_int = pin_record.storedInt;
+            pin->default_stored_float = pin_record.storedFloat;
+            pin->default_stored_double = pin_record.storedDouble;
+            pin->default_stored_bool = pin_record.storedBool != 0;
+            pin->default_stored_string = g.str(pin_record.storedString);
+            pins[record.firstPin + i] = pin.get();
+        }
+
+        for (size_t i = 0; i < record.outputCount && i < node->outputs.size(); i++) {
+            size_t index = record.firstPin + record.inputCount + i;
+            auto& pin = node->outputs[i];
+
+            pin->pin_guid = g.str(g.pins[index].guid);
+            pins[index] = pin.get();
+        }
+
+        // Pins added to the node type after the template was saved.
+        for (auto& pin : node->inputs) {
+            if (pin->pin_guid.empty()) pin->pin_guid = GUIDGenerator::generate();
+        }
+        for (auto& pin : node->outputs) {
+            if (pin->pin_guid.empty()) pin->pin_guid = GUIDGenerator::generate();
+        }
+
+        if (!compiled.data.is_null()) {
+            node->deserializeData(compiled.data);
+        }
+
+        target.addNode(std::move(node));
+    }
+
+    for (const auto& link : m_links) {
+        PinOut* from_pin = dynamic_cast<PinOut*>(pins[link.fromPin]);
+        PinIn* to_pin = dynamic_cast<PinIn*>(pins[link.toPin]);
+        if (!from_pin || !to_pin) continue;
+
+        if (link.direct && from_pin->type == to_pin->type) {
+            target.linkPins(from_pin, to_pin);
+        }
+        else {
+            target.createConnection(from_pin, to_pin);
+        }
+    }
+
+    return true;
+}
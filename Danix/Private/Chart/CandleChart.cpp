@@ -429,8 +429,9 @@ void CandlestickChart::drawCandleInfo(ImDrawList* draw_list, const ImVec2& canva
     char buffer[512];
 
     char ohlc_part[128];
-    snprintf_custom(ohlc_part, sizeof(ohlc_part), "ID %d OPEN %.8Lf  HIGH %.8Lf  LOW %.8Lf  CLOSE %.8Lf",
-        candle.index,candle.open, candle.high, candle.low, candle.close);
+    snprintf_custom(ohlc_part, sizeof(ohlc_part), "ID %d OPEN %.8f  HIGH %.8f  LOW %.8f  CLOSE %.8f",
+        candle.index, static_cast<double>(candle.open), static_cast<double>(candle.high),
+        static_cast<double>(candle.low), static_cast<double>(candle.close));
 
     char volume_part[64];
     if (candle.volume > 1000000) {
@@ -471,7 +472,7 @@ void CandlestickChart::drawCandleInfo(ImDrawList* draw_list, const ImVec2& canva
         const char* sign = (change >= 0) ? "+" : "";
 
         char change_part[64];
-        snprintf_custom(change_part, sizeof(change_part), "  %s%.2f%% (%s$%.10Lf)",
+        snprintf_custom(change_part, sizeof(change_part), "  %s%.2f%% (%s$%.10f)",
             sign, change_percent, sign, change);
 
         ImVec2 main_text_size = ImGui::CalcTextSize(buffer);
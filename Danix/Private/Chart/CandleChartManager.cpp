@@ -1,4 +1,8 @@
 #include "../../Public/Chart/CandleChartManager.h"
+#include "../../Public/Chart/MappedCandleSeries.h"
+#include "../../Public/Chart/CandleCsvImporter.h"
+#include "../../Public/Chart/IndicatorBatch.h"
+#include "../../Public/Chart/CandleResampler.h"
 #include <algorithm>
 #include "../../Public/Chart/CandleChart.h"
 #include "../../Public/Blueprints/BlueprintManager.h"
@@ -14,11 +18,53 @@ float clampf(float v, float lo, float hi) {
     return v;
 }
 
+void LiveOrderHandle::deliver(const std::shared_ptr<LiveOrderHandle>& handle, Task task) {
+    Poster target;
+    {
+        std::lock_guard<std::mutex> lock(handle->mutex);
+        if (!handle->dataManager) return;
+        target = handle->poster;
+    }
+
+    if (!target) {
+        std::cout << "[LiveOrderHandle] No strategy thread to deliver an order completion to" << std::endl;
+        return;
+    }
+    target([handle, task]() { handle->run(task); });
+}
+
+void LiveOrderHandle::setPoster(Poster newPoster) {
+    std::lock_guard<std::mutex> lock(mutex);
+    poster = std::move(newPoster);
+}
+
+void LiveOrderHandle::detach() {
+    std::lock_guard<std::mutex> lock(mutex);
+    dataManager = nullptr;
+    poster = nullptr;
+}
+
+void LiveOrderHandle::run(const Task& task) {
+    // Runs on the poster's thread, which the owner drains after detach() before the data
+    // manager goes away; the lock only covers reading the attached state.
+    CandlestickDataManager* target;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        target = dataManager;
+    }
+    if (target) task(*target);
+}
+
 CandlestickDataManager::CandlestickDataManager()
+    : liveOrders(std::make_shared<LiveOrderHandle>(this))
 {
 
 }
 
+CandlestickDataManager::~CandlestickDataManager() {
+    liveOrders->detach();
+}
+
 void CandlestickDataManager::addData(const std::vector<MarketData>& newData) {
     data.insert(data.end(), newData.begin(), newData.end());
     std::sort(data.begin(), data.end(), [](const MarketData& a, const MarketData& b) {
@@ -30,6 +76,7 @@ void CandlestickDataManager::addData(const std::vector<MarketData>& newData) {
     std::sort(public_data.begin(), public_data.end(), [](const MarketData& a, const MarketData& b) {
         return a.timestamp < b.timestamp;
         });
+    seriesVersion++;
 }
 
 void CandlestickDataManager::addCandle(const MarketData& candle) {
@@ -45,6 +92,7 @@ void CandlestickDataManager::addCandle(const MarketData& candle) {
             return a.timestamp < b.timestamp;
         });
     public_data.insert(it1, candle);
+    seriesVersion++;
 
     if (RuntimeMode)
     {
@@ -67,6 +115,7 @@ void CandlestickDataManager::UpdateLastCandle(const MarketData& candle) {
             lastPublicCandle = candle;
         }
     }
+    seriesVersion++;
 
     if (RuntimeMode) {
         GetBlueprintManager()->executeFromEntry();
@@ -85,11 +134,19 @@ std::vector<MarketData> CandlestickDataManager::getDataRange(size_t start, size_
     return std::vector<MarketData>(data.begin() + start, data.begin() + end);
 }
 
-const std::vector<MarketData>& CandlestickDataManager::getPublicData() const {
-    return public_data;
+CandleSeriesView CandlestickDataManager::getPublicData() const {
+    if (mappedSeries) {
+        return mappedSeries->view(mappedVisible);
+    }
+    if (attachedSeries.data()) {
+        return CandleSeriesView(attachedSeries.data(), mappedVisible);
+    }
+    return CandleSeriesView(public_data);
 }
 
 std::vector<MarketData>* CandlestickDataManager::getPublicDataPtr(){
+    // The caller may edit candles in place; size changes are caught by the cache on their own.
+    seriesVersion++;
     return &public_data;
 }
 
@@ -100,9 +157,117 @@ std::vector<MarketData> CandlestickDataManager::getPublicDataRange(size_t start,
 }
 
 
+bool CandlestickDataManager::attachMappedSeries(const std::string& filename) {
+    auto series = std::make_unique<MappedCandleSeries>();
+    if (!series->open(filename)) {
+        return false;
+    }
+
+    std::cout << "[DataManager] Mapped " << series->size() << " candles of "
+        << series->getSymbol() << " from " << filename << std::endl;
+    attachedSeries = CandleSeriesView();
+    mappedSeries = std::move(series);
+    mappedVisible = mappedSeries->size();
+    seriesVersion++;
+    return true;
+}
+
+void CandlestickDataManager::attachSeriesView(CandleSeriesView series) {
+    mappedSeries.reset();
+    attachedSeries = series;
+    mappedVisible = series.size();
+    seriesVersion++;
+}
+
+void CandlestickDataManager::detachMappedSeries() {
+    mappedSeries.reset();
+    attachedSeries = CandleSeriesView();
+    mappedVisible = 0;
+    seriesVersion++;
+}
+
+bool CandlestickDataManager::exportMappedSeries(const std::string& filename) const {
+    return MappedCandleSeries::writeFile(filename, symbol, data);
+}
+
+void CandlestickDataManager::setMappedVisibleCount(size_t count) {
+    if (attachedSeries.data()) {
+        mappedVisible = MIN(count, attachedSeries.size());
+        seriesVersion++;
+        return;
+    }
+    if (!mappedSeries) return;
+
+    count = MIN(count, mappedSeries->size());
+    // Hint the next window ahead of time so the backtest loop does not stall on page faults.
+    size_t window = MappedCandleSeries::PREFETCH_WINDOW;
+    if (count / window != mappedVisible / window) {
+        mappedSeries->prefetch((count / window + 1) * window, window);
+    }
+    mappedVisible = count;
+    seriesVersion++;
+}
+
+void CandlestickDataManager::beginIndicatorBatch() {
+    CandleSeriesView series = mappedSeries ? mappedSeries->view()
+        : attachedSeries.data() ? attachedSeries : CandleSeriesView(data);
+    indicatorBatch = std::make_unique<IndicatorBatch>(series);
+    std::cout << "[DataManager] Indicator batch over " << series.size() << " candles ("
+        << IndicatorKernels::instructionSet() << ")" << std::endl;
+}
+
+void CandlestickDataManager::endIndicatorBatch() {
+    indicatorBatch.reset();
+}
+
+IndicatorCache& CandlestickDataManager::GetIndicatorCache() {
+    indicatorCache.sync(seriesVersion, getPublicData().size());
+    return indicatorCache;
+}
+
+CandleSeriesView CandlestickDataManager::GetTimeframeSeries(int minutes) {
+    CandleResampler::Timeframe timeframe;
+    if (!CandleResampler::fromMinutes(minutes, timeframe)) {
+        return CandleSeriesView();
+    }
+
+    if (!resampler) resampler = std::make_unique<CandleResampler>();
+    resampler->sync(getPublicData(), seriesVersion);
+    return resampler->getSeries(timeframe);
+}
+
+bool CandlestickDataManager::LoadSelectedCSVFile(const std::string& filename) {
+    std::vector<MarketData> imported;
+    if (!CandleCsvImporter::load(filename, imported)) {
+        return false;
+    }
+
+    if (chart) chart->clearAllTradingElements();
+    data = std::move(imported);
+    public_data.clear();
+    public_data.shrink_to_fit();
+    seriesVersion++;
+    return true;
+}
+
+void CandlestickDataManager::SetRuntimeMode(bool newMode) {
+    // A live strategy sees the whole history, also after an import left the public series empty.
+    if (newMode && !RuntimeMode && public_data.size() != data.size()) {
+        public_data = data;
+        seriesVersion++;
+    }
+    RuntimeMode = newMode;
+}
+
+bool CandlestickDataManager::SaveCSVFile(const std::string& filename) {
+    return CandleCsvImporter::save(filename, data);
+}
+
 void CandlestickDataManager::clear() {
     data.clear();
     public_data.clear();
+    detachMappedSeries();
+    seriesVersion++;
     chart->clearAllTradingElements();
 }
 
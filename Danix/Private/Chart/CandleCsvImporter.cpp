@@ -0,0 +1,502 @@
+#include "../../Public/Chart/CandleCsvImporter.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+    struct CsvLayout {
+        char delimiter = ',';
+        bool hasHeader = false;
+        int timeCol = 0;
+        int openCol = 1;
+        int highCol = 2;
+        int lowCol = 3;
+        int closeCol = 4;
+        int volumeCol = 5;
+        int lastCol = 5;
+    };
+
+    struct ChunkResult {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        size_t lines = 0;
+        size_t offset = 0;
+        size_t skipped = 0;
+        uint64_t firstTs = 0;
+        uint64_t lastTs = 0;
+        bool ascending = true;
+        bool descending = true;
+        bool hasEqual = false;
+    };
+
+    inline bool isBlank(char c) {
+        return c == ' ' || c == '\t' || c == '"' || c == '\'' || c == '<' || c == '>';
+    }
+
+    inline void trimField(const char*& b, const char*& e) {
+        while (b < e && isBlank(*b)) ++b;
+        while (e > b && (isBlank(e[-1]) || e[-1] == '\r')) --e;
+    }
+
+    inline bool parseDouble(const char* b, const char* e, Real& out) {
+        if (b < e && *b == '+') ++b;
+        double value = 0.0;
+        auto res = std::from_chars(b, e, value);
+        if (res.ec != std::errc() || res.ptr == b) return false;
+        out = value;
+        return true;
+    }
+
+    // Howard Hinnant's days_from_civil.
+    inline int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+        y -= m <= 2;
+        const int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const unsigned yoe = (unsigned)(y - era * 400);
+        const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + (int64_t)doe - 719468;
+    }
+
+    inline bool readInt(const char*& p, const char* e, int digits, int& out) {
+        if (e - p < digits) return false;
+        auto res = std::from_chars(p, p + digits, out);
+        if (res.ec != std::errc() || res.ptr != p + digits) return false;
+        p += digits;
+        return true;
+    }
+
+    // YYYY-MM-DD[ T]HH:MM[:SS[.fff]][Z], '/' and '.' accepted as date separators.
+    bool parseDateTime(const char* b, const char* e, uint64_t& outMs) {
+        const char* p = b;
+        int year, month, day, hour = 0, minute = 0, second = 0, millis = 0;
+        if (!readInt(p, e, 4, year)) return false;
+        if (p >= e || (*p != '-' && *p != '/' && *p != '.')) return false;
+        ++p;
+        if (!readInt(p, e, 2, month)) return false;
+        if (p >= e || (*p != '-' && *p != '/' && *p != '.')) return false;
+        ++p;
+        if (!readInt(p, e, 2, day)) return false;
+
+        if (p < e && (*p == ' ' || *p == 'T')) {
+            ++p;
+            if (!readInt(p, e, 2, hour)) return false;
+            if (p >= e || *p != ':') return false;
+            ++p;
+            if (!readInt(p, e, 2, minute)) return false;
+            if (p < e && *p == ':') {
+                ++p;
+                if (!readInt(p, e, 2, second)) return false;
+                if (p < e && *p == '.') {
+                    ++p;
+                    int scale = 100;
+                    while (p < e && *p >= '0' && *p <= '9') {
+                        millis += (*p - '0') * scale;
+                        scale /= 10;
+                        ++p;
+                    }
+                }
+            }
+        }
+        if (month < 1 || month > 12 || day < 1 || day > 31) return false;
+
+        int64_t days = daysFromCivil(year, (unsigned)month, (unsigned)day);
+        int64_t secs = days * 86400 + hour * 3600 + minute * 60 + second;
+        if (secs < 0) return false;
+        outMs = (uint64_t)secs * 1000 + (uint64_t)millis;
+        return true;
+    }
+
+    bool parseTimestamp(const char* b, const char* e, uint64_t& outMs) {
+        if (b >= e) return false;
+
+        uint64_t value = 0;
+        auto res = std::from_chars(b, e, value);
+        if (res.ec == std::errc() && res.ptr == e) {
+            if (value < 100000000000ULL) outMs = value * 1000;              // seconds
+            else if (value < 100000000000000ULL) outMs = value;             // milliseconds
+            else if (value < 100000000000000000ULL) outMs = value / 1000;   // microseconds
+            else outMs = value / 1000000;                                   // nanoseconds
+            return outMs > 0;
+        }
+
+        if (res.ec == std::errc() && res.ptr < e && (*res.ptr == '.' || *res.ptr == 'e' || *res.ptr == 'E')) {
+            double seconds = 0.0;
+            auto dres = std::from_chars(b, e, seconds);
+            if (dres.ec != std::errc() || seconds <= 0.0) return false;
+            if (seconds < 1e11) outMs = (uint64_t)(seconds * 1000.0);
+            else outMs = (uint64_t)seconds;
+            return true;
+        }
+
+        return parseDateTime(b, e, outMs);
+    }
+
+    bool parseLine(const char* b, const char* e, const CsvLayout& layout, MarketData& candle) {
+        uint64_t ts = 0;
+        Real open = 0, high = 0, low = 0, close = 0, volume = 0;
+        unsigned found = 0;
+
+        int col = 0;
+        const char* field = b;
+        while (col <= layout.lastCol) {
+            const char* fieldEnd = field;
+            while (fieldEnd < e && *fieldEnd != layout.delimiter) ++fieldEnd;
+
+            const char* fb = field;
+            const char* fe = fieldEnd;
+            trimField(fb, fe);
+
+            if (col == layout.timeCol) { if (!parseTimestamp(fb, fe, ts)) return false; found |= 1; }
+            else if (col == layout.openCol) { if (!parseDouble(fb, fe, open)) return false; found |= 2; }
+            else if (col == layout.highCol) { if (!parseDouble(fb, fe, high)) return false; found |= 4; }
+            else if (col == layout.lowCol) { if (!parseDouble(fb, fe, low)) return false; found |= 8; }
+            else if (col == layout.closeCol) { if (!parseDouble(fb, fe, close)) return false; found |= 16; }
+            else if (col == layout.volumeCol) { if (!parseDouble(fb, fe, volume)) volume = 0; }
+
+            if (fieldEnd >= e) break;
+            field = fieldEnd + 1;
+            ++col;
+        }
+
+        if (found != 31) return false;
+
+        candle.timestamp = ts;
+        candle.open = open;
+        candle.high = high;
+        candle.low = low;
+        candle.close = close;
+        candle.volume = (float)volume;
+        candle.mcap = 0.0f;
+        return true;
+    }
+
+    std::string normalizeName(const char* b, const char* e) {
+        trimField(b, e);
+        std::string name(b, e);
+        for (auto& c : name) {
+            if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+            if (c == ' ') c = '_';
+        }
+        return name;
+    }
+
+    bool applyHeader(const char* b, const char* e, CsvLayout& layout) {
+        layout.timeCol = layout.openCol = layout.highCol = layout.lowCol = layout.closeCol = layout.volumeCol = -1;
+
+        int col = 0;
+        const char* field = b;
+        while (true) {
+            const char* fieldEnd = field;
+            while (fieldEnd < e && *fieldEnd != layout.delimiter) ++fieldEnd;
+            std::string name = normalizeName(field, fieldEnd);
+
+            if (layout.timeCol < 0 && (name == "timestamp" || name == "time" || name == "open_time" || name == "opentime" ||
+                name == "start" || name == "starttime" || name == "start_time" || name == "date" || name == "datetime" ||
+                name == "unix" || name == "ts" || name == "t")) layout.timeCol = col;
+            else if (layout.openCol < 0 && (name == "open" || name == "o" || name == "open_price")) layout.openCol = col;
+            else if (layout.highCol < 0 && (name == "high" || name == "h" || name == "high_price")) layout.highCol = col;
+            else if (layout.lowCol < 0 && (name == "low" || name == "l" || name == "low_price")) layout.lowCol = col;
+            else if (layout.closeCol < 0 && (name == "close" || name == "c" || name == "close_price")) layout.closeCol = col;
+            else if (layout.volumeCol < 0 && (name == "v" || name.compare(0, 3, "vol") == 0 || name == "base_volume")) layout.volumeCol = col;
+
+            if (fieldEnd >= e) break;
+            field = fieldEnd + 1;
+            ++col;
+        }
+
+        if (layout.timeCol < 0 || layout.openCol < 0 || layout.highCol < 0 || layout.lowCol < 0 || layout.closeCol < 0) {
+            return false;
+        }
+        layout.lastCol = std::max({ layout.timeCol, layout.openCol, layout.highCol, layout.lowCol, layout.closeCol, layout.volumeCol });
+        return true;
+    }
+
+    bool detectLayout(const char* b, const char* e, CsvLayout& layout, const char*& dataBegin) {
+        const char* lineEnd = static_cast<const char*>(memchr(b, '\n', e - b));
+        if (!lineEnd) lineEnd = e;
+
+        size_t commas = std::count(b, lineEnd, ',');
+        size_t semicolons = std::count(b, lineEnd, ';');
+        size_t tabs = std::count(b, lineEnd, '\t');
+        if (semicolons > commas && semicolons >= tabs) layout.delimiter = ';';
+        else if (tabs > commas && tabs > semicolons) layout.delimiter = '\t';
+        else layout.delimiter = ',';
+
+        MarketData probe{};
+        if (parseLine(b, lineEnd, layout, probe)) {
+            layout.hasHeader = false;
+            dataBegin = b;
+            return true;
+        }
+
+        if (!applyHeader(b, lineEnd, layout)) return false;
+        layout.hasHeader = true;
+        dataBegin = lineEnd < e ? lineEnd + 1 : e;
+        return true;
+    }
+
+    size_t countLines(const char* b, const char* e) {
+        size_t lines = 0;
+        const char* p = b;
+        while (p < e) {
+            const char* nl = static_cast<const char*>(memchr(p, '\n', e - p));
+            ++lines;
+            if (!nl) break;
+            p = nl + 1;
+        }
+        return lines;
+    }
+
+    void parseChunk(ChunkResult& chunk, const CsvLayout& layout, MarketData* out) {
+        const char* p = chunk.begin;
+        size_t slot = chunk.offset;
+        uint64_t prevTs = 0;
+
+        while (p < chunk.end) {
+            const char* nl = static_cast<const char*>(memchr(p, '\n', chunk.end - p));
+            const char* lineEnd = nl ? nl : chunk.end;
+
+            MarketData& candle = out[slot];
+            if (parseLine(p, lineEnd, layout, candle)) {
+                candle.index = (int)slot;
+                if (prevTs == 0) {
+                    chunk.firstTs = candle.timestamp;
+                }
+                else {
+                    if (candle.timestamp < prevTs) chunk.ascending = false;
+                    if (candle.timestamp > prevTs) chunk.descending = false;
+                    if (candle.timestamp == prevTs) chunk.hasEqual = true;
+                }
+                prevTs = candle.timestamp;
+            }
+            else {
+                candle.timestamp = 0;
+                ++chunk.skipped;
+            }
+
+            ++slot;
+            if (!nl) break;
+            p = nl + 1;
+        }
+        chunk.lastTs = prevTs;
+    }
+}
+
+bool CandleCsvImporter::parse(const char* begin, const char* end, std::vector<MarketData>& out, CsvImportStats* stats) {
+    auto startTime = std::chrono::steady_clock::now();
+    out.clear();
+
+    if (end - begin >= 3 && (unsigned char)begin[0] == 0xEF && (unsigned char)begin[1] == 0xBB && (unsigned char)begin[2] == 0xBF) {
+        begin += 3;
+    }
+    if (begin >= end) return false;
+
+    CsvLayout layout;
+    const char* dataBegin = begin;
+    if (!detectLayout(begin, end, layout, dataBegin)) {
+        std::cerr << "[CsvImporter] Unrecognised column layout" << std::endl;
+        return false;
+    }
+
+    size_t bytes = (size_t)(end - dataBegin);
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = (unsigned)std::min<size_t>(threads, std::max<size_t>(1, bytes / MIN_BYTES_PER_THREAD));
+
+    std::vector<ChunkResult> chunks(threads);
+    const char* chunkStart = dataBegin;
+    for (unsigned t = 0; t < threads; ++t) {
+        const char* chunkEnd = end;
+        if (t + 1 < threads) {
+            chunkEnd = dataBegin + bytes * (t + 1) / threads;
+            if (chunkEnd < chunkStart) chunkEnd = chunkStart;
+            const char* nl = static_cast<const char*>(memchr(chunkEnd, '\n', end - chunkEnd));
+            chunkEnd = nl ? nl + 1 : end;
+        }
+        chunks[t].begin = chunkStart;
+        chunks[t].end = chunkEnd;
+        chunkStart = chunkEnd;
+    }
+
+    // Pass 1: count rows per chunk so every thread can write straight into its slice of out.
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back([&chunks, t]() { chunks[t].lines = countLines(chunks[t].begin, chunks[t].end); });
+    }
+    chunks[0].lines = countLines(chunks[0].begin, chunks[0].end);
+    for (auto& w : workers) w.join();
+    workers.clear();
+
+    size_t total = 0;
+    for (auto& chunk : chunks) {
+        chunk.offset = total;
+        total += chunk.lines;
+    }
+    out.resize(total);
+
+    // Pass 2: parse in place.
+    MarketData* slots = out.data();
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back([&chunks, &layout, slots, t]() { parseChunk(chunks[t], layout, slots); });
+    }
+    parseChunk(chunks[0], layout, slots);
+    for (auto& w : workers) w.join();
+
+    size_t skipped = 0;
+    bool ascending = true;
+    bool descending = true;
+    bool hasEqual = false;
+    uint64_t prevLast = 0;
+    for (auto& chunk : chunks) {
+        skipped += chunk.skipped;
+        ascending = ascending && chunk.ascending;
+        descending = descending && chunk.descending;
+        hasEqual = hasEqual || chunk.hasEqual;
+        if (chunk.firstTs == 0) continue;
+        if (prevLast != 0) {
+            if (chunk.firstTs < prevLast) ascending = false;
+            if (chunk.firstTs > prevLast) descending = false;
+            if (chunk.firstTs == prevLast) hasEqual = true;
+        }
+        prevLast = chunk.lastTs;
+    }
+
+    if (skipped > 0) {
+        out.erase(std::remove_if(out.begin(), out.end(), [](const MarketData& c) { return c.timestamp == 0; }), out.end());
+    }
+
+    bool reordered = false;
+    if (!ascending) {
+        if (descending) {
+            std::reverse(out.begin(), out.end());
+        }
+        else {
+            std::stable_sort(out.begin(), out.end(), [](const MarketData& a, const MarketData& b) {
+                return a.timestamp < b.timestamp;
+                });
+            hasEqual = true;
+        }
+        reordered = true;
+    }
+
+    size_t duplicates = 0;
+    if (hasEqual) {
+        size_t w = 0;
+        for (size_t r = 0; r < out.size(); ++r) {
+            if (w > 0 && out[w - 1].timestamp == out[r].timestamp) {
+                out[w - 1] = out[r];
+                ++duplicates;
+            }
+            else {
+                out[w++] = out[r];
+            }
+        }
+        out.resize(w);
+    }
+
+    if (skipped > 0 || reordered || duplicates > 0) {
+        for (size_t i = 0; i < out.size(); ++i) out[i].index = (int)i;
+    }
+
+    if (stats) {
+        stats->bytes = (size_t)(end - begin);
+        stats->rows = out.size();
+        stats->skippedRows = skipped;
+        stats->duplicateRows = duplicates;
+        stats->threads = threads;
+        stats->reordered = reordered;
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    return !out.empty();
+}
+
+bool CandleCsvImporter::load(const std::string& filename, std::vector<MarketData>& out, CsvImportStats* stats) {
+    auto startTime = std::chrono::steady_clock::now();
+
+    FILE* file = nullptr;
+#ifdef _WIN32
+    if (fopen_s(&file, filename.c_str(), "rb") != 0) file = nullptr;
+#else
+    file = fopen(filename.c_str(), "rb");
+#endif
+    if (!file) {
+        std::cerr << "[CsvImporter] Failed to open " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<char> buffer;
+#ifdef _WIN32
+    _fseeki64(file, 0, SEEK_END);
+    long long fileSize = _ftelli64(file);
+    _fseeki64(file, 0, SEEK_SET);
+#else
+    fseeko(file, 0, SEEK_END);
+    long long fileSize = (long long)ftello(file);
+    fseeko(file, 0, SEEK_SET);
+#endif
+    if (fileSize <= 0) {
+        fclose(file);
+        std::cerr << "[CsvImporter] Empty file " << filename << std::endl;
+        return false;
+    }
+
+    buffer.resize((size_t)fileSize);
+    size_t read = fread(buffer.data(), 1, buffer.size(), file);
+    fclose(file);
+    buffer.resize(read);
+
+    CsvImportStats localStats;
+    CsvImportStats& s = stats ? *stats : localStats;
+    bool ok = parse(buffer.data(), buffer.data() + buffer.size(), out, &s);
+    s.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    std::cout << "[CsvImporter] " << filename << ": " << s.rows << " candles, "
+        << s.skippedRows << " skipped, " << s.duplicateRows << " duplicates, "
+        << s.threads << " threads, " << (size_t)s.throughputMBs() << " MB/s" << std::endl;
+    return ok;
+}
+
+bool CandleCsvImporter::save(const std::string& filename, const std::vector<MarketData>& candles) {
+    FILE* file = nullptr;
+#ifdef _WIN32
+    if (fopen_s(&file, filename.c_str(), "wb") != 0) file = nullptr;
+#else
+    file = fopen(filename.c_str(), "wb");
+#endif
+    if (!file) {
+        std::cerr << "[CsvImporter] Failed to create " << filename << std::endl;
+        return false;
+    }
+
+    static const char header[] = "timestamp,open,high,low,close,volume\n";
+    fwrite(header, 1, sizeof(header) - 1, file);
+
+    std::vector<char> buffer(1 << 20);
+    size_t used = 0;
+    for (const auto& candle : candles) {
+        if (buffer.size() - used < 256) {
+            fwrite(buffer.data(), 1, used, file);
+            used = 0;
+        }
+        char* p = buffer.data() + used;
+        char* e = buffer.data() + buffer.size();
+        p = std::to_chars(p, e, candle.timestamp).ptr; *p++ = ',';
+        p = std::to_chars(p, e, (double)candle.open).ptr; *p++ = ',';
+        p = std::to_chars(p, e, (double)candle.high).ptr; *p++ = ',';
+        p = std::to_chars(p, e, (double)candle.low).ptr; *p++ = ',';
+        p = std::to_chars(p, e, (double)candle.close).ptr; *p++ = ',';
+        p = std::to_chars(p, e, candle.volume).ptr; *p++ = '\n';
+        used = (size_t)(p - buffer.data());
+    }
+    if (used > 0) fwrite(buffer.data(), 1, used, file);
+
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    if (!ok) std::cerr << "[CsvImporter] Write failed for " << filename << std::endl;
+    return ok;
+}
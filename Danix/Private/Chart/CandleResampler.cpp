@@ -0,0 +1,102 @@
+#include "../../Public/Chart/CandleResampler.h"
+#include <algorithm>
+
+uint64_t CandleResampler::periodMs(Timeframe timeframe) {
+    switch (timeframe) {
+    case Timeframe::MIN_5: return 5ULL * 60 * 1000;
+    case Timeframe::MIN_15: return 15ULL * 60 * 1000;
+    case Timeframe::HOUR_1: return 60ULL * 60 * 1000;
+    case Timeframe::HOUR_4: return 4ULL * 60 * 60 * 1000;
+    case Timeframe::DAY_1: return 24ULL * 60 * 60 * 1000;
+    default: return 60ULL * 1000;
+    }
+}
+
+bool CandleResampler::fromMinutes(int minutes, Timeframe& timeframe) {
+    switch (minutes) {
+    case 5: timeframe = Timeframe::MIN_5; return true;
+    case 15: timeframe = Timeframe::MIN_15; return true;
+    case 60: timeframe = Timeframe::HOUR_1; return true;
+    case 240: timeframe = Timeframe::HOUR_4; return true;
+    case 1440: timeframe = Timeframe::DAY_1; return true;
+    default: return false;
+    }
+}
+
+void CandleResampler::sync(CandleSeriesView base, uint64_t version) {
+    if (version == m_version && base.size() == m_consumed) return;
+    m_version = version;
+
+    if (base.empty()) {
+        reset();
+        return;
+    }
+
+    if (base.size() < m_consumed || base.front().timestamp != m_firstTimestamp) {
+        reset();
+        m_firstTimestamp = base.front().timestamp;
+    }
+    else if (m_consumed > 0) {
+        // The last folded candle may have been updated since.
+        undoLastFold();
+        m_consumed--;
+    }
+
+    for (; m_consumed < base.size(); ++m_consumed) {
+        fold(base[m_consumed]);
+    }
+}
+
+void CandleResampler::reset() {
+    for (Series& series : m_series) {
+        series.bars.clear();
+        series.lastOpened = false;
+    }
+    m_consumed = 0;
+    m_firstTimestamp = 0;
+}
+
+CandleSeriesView CandleResampler::getSeries(Timeframe timeframe) const {
+    size_t slot = static_cast<size_t>(timeframe);
+    if (slot >= static_cast<size_t>(Timeframe::COUNT)) return CandleSeriesView();
+    return CandleSeriesView(m_series[slot].bars);
+}
+
+void CandleResampler::fold(const MarketData& candle) {
+    for (size_t slot = 0; slot < static_cast<size_t>(Timeframe::COUNT); ++slot) {
+        Series& series = m_series[slot];
+        uint64_t period = periodMs(static_cast<Timeframe>(slot));
+        uint64_t start = candle.timestamp / period * period;
+
+        if (series.bars.empty() || series.bars.back().timestamp != start) {
+            MarketData bar = candle;
+            bar.index = static_cast<int>(series.bars.size());
+            bar.timestamp = start;
+            series.bars.push_back(bar);
+            series.lastOpened = true;
+            continue;
+        }
+
+        MarketData& bar = series.bars.back();
+        series.lastPrevious = bar;
+        series.lastOpened = false;
+
+        bar.high = std::max(bar.high, candle.high);
+        bar.low = std::min(bar.low, candle.low);
+        bar.close = candle.close;
+        bar.volume += candle.volume;
+        bar.mcap = candle.mcap;
+    }
+}
+
+void CandleResampler::undoLastFold() {
+    for (Series& series : m_series) {
+        if (series.bars.empty()) continue;
+        if (series.lastOpened) {
+            series.bars.pop_back();
+        }
+        else {
+            series.bars.back() = series.lastPrevious;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include "../../Public/Chart/IndicatorBatch.h"
+
+IndicatorBatch::IndicatorBatch(CandleSeriesView candles) {
+    IndicatorKernels::extract(candles, series);
+}
+
+std::vector<double>* IndicatorBatch::find(const Key& key, size_t outputs, bool& created) {
+    auto it = columns.find(key);
+    if (it != columns.end()) {
+        created = false;
+        return it->second.data();
+    }
+
+    auto& entry = columns[key];
+    entry.assign(outputs, std::vector<double>(series.size()));
+    created = true;
+    return entry.data();
+}
+
+const double* IndicatorBatch::sma(int period) {
+    bool created;
+    std::vector<double>* out = find({ Kind::SMA, period, 0, 0.0 }, 1, created);
+    if (created) IndicatorKernels::sma(series.close.data(), series.size(), period, out[0].data());
+    return out[0].data();
+}
+
+const double* IndicatorBatch::rsi(int period) {
+    bool created;
+    std::vector<double>* out = find({ Kind::RSI, period, 0, 0.0 }, 1, created);
+    if (created) IndicatorKernels::rsi(series.close.data(), series.size(), period, out[0].data());
+    return out[0].data();
+}
+
+const double* IndicatorBatch::cci(int period) {
+    bool created;
+    std::vector<double>* out = find({ Kind::CCI, period, 0, 0.0 }, 1, created);
+    if (created) IndicatorKernels::cci(series.typical.data(), series.size(), period, out[0].data());
+    return out[0].data();
+}
+
+const double* IndicatorBatch::mfi(int period) {
+    bool created;
+    std::vector<double>* out = find({ Kind::MFI, period, 0, 0.0 }, 1, created);
+    if (created) IndicatorKernels::mfi(series.typical.data(), series.volume.data(), series.size(), period, out[0].data());
+    return out[0].data();
+}
+
+const std::vector<double>* IndicatorBatch::bollinger(int period, double multiplier) {
+    bool created;
+    std::vector<double>* out = find({ Kind::BOLLINGER, period, 0, multiplier }, 3, created);
+    if (created) {
+        IndicatorKernels::bollinger(series.close.data(), series.size(), period, multiplier,
+            out[0].data(), out[1].data(), out[2].data());
+    }
+    return out;
+}
+
+const std::vector<double>* IndicatorBatch::stochastic(int kPeriod, int dPeriod) {
+    bool created;
+    std::vector<double>* out = find({ Kind::STOCHASTIC, kPeriod, dPeriod, 0.0 }, 2, created);
+    if (created) {
+        IndicatorKernels::stochastic(series.high.data(), series.low.data(), series.close.data(), series.size(),
+            kPeriod, dPeriod, out[0].data(), out[1].data());
+    }
+    return out;
+}
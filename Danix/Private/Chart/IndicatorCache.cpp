@@ -0,0 +1,28 @@
+#include "../../Public/Chart/IndicatorCache.h"
+
+void IndicatorCache::sync(uint64_t version, size_t size) {
+    if (version == m_version && size == m_size) return;
+    m_version = version;
+    m_size = size;
+    m_entries.clear();
+}
+
+const Real* IndicatorCache::find(const Key& key) const {
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        m_hits++;
+        return it->second.values;
+    }
+    m_misses++;
+    return nullptr;
+}
+
+void IndicatorCache::insert(const Key& key, std::initializer_list<Real> values) {
+    Values& entry = m_entries[key];
+    size_t i = 0;
+    for (Real value : values) {
+        if (i == MAX_VALUES) break;
+        entry.values[i++] = value;
+    }
+    for (; i < MAX_VALUES; ++i) entry.values[i] = 0.0;
+}
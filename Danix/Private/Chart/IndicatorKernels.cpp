@@ -0,0 +1,351 @@
+#include "../../Public/Chart/IndicatorKernels.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#define INDICATOR_AVX 1
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define INDICATOR_SSE2 1
+#endif
+#elif defined(__AVX__)
+#include <immintrin.h>
+#define INDICATOR_AVX 1
+#define INDICATOR_SSE2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define INDICATOR_SSE2 1
+#endif
+
+namespace {
+
+struct ScalarLane {
+    static constexpr size_t WIDTH = 1;
+    using Reg = double;
+    using Mask = bool;
+
+    static Reg load(const double* p) { return *p; }
+    static void store(double* p, Reg v) { *p = v; }
+    static Reg set(double v) { return v; }
+    static Reg add(Reg a, Reg b) { return a + b; }
+    static Reg sub(Reg a, Reg b) { return a - b; }
+    static Reg mul(Reg a, Reg b) { return a * b; }
+    static Reg div(Reg a, Reg b) { return a / b; }
+    static Reg max(Reg a, Reg b) { return b > a ? b : a; }
+    static Reg min(Reg a, Reg b) { return b < a ? b : a; }
+    static Reg sqrt(Reg a) { return std::sqrt(a); }
+    static Reg abs(Reg a) { return std::fabs(a); }
+    static Mask gt(Reg a, Reg b) { return a > b; }
+    static Mask lt(Reg a, Reg b) { return a < b; }
+    static Mask eq(Reg a, Reg b) { return a == b; }
+    static Reg select(Mask m, Reg a, Reg b) { return m ? a : b; }
+};
+
+#ifdef INDICATOR_SSE2
+struct Sse2Lane {
+    static constexpr size_t WIDTH = 2;
+    using Reg = __m128d;
+    using Mask = __m128d;
+
+    static Reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, Reg v) { _mm_storeu_pd(p, v); }
+    static Reg set(double v) { return _mm_set1_pd(v); }
+    static Reg add(Reg a, Reg b) { return _mm_add_pd(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_pd(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_pd(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm_div_pd(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_pd(a, b); }
+    static Reg min(Reg a, Reg b) { return _mm_min_pd(a, b); }
+    static Reg sqrt(Reg a) { return _mm_sqrt_pd(a); }
+    static Reg abs(Reg a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static Mask gt(Reg a, Reg b) { return _mm_cmpgt_pd(a, b); }
+    static Mask lt(Reg a, Reg b) { return _mm_cmplt_pd(a, b); }
+    static Mask eq(Reg a, Reg b) { return _mm_cmpeq_pd(a, b); }
+    static Reg select(Mask m, Reg a, Reg b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+};
+#endif
+
+#ifdef INDICATOR_AVX
+struct AvxLane {
+    static constexpr size_t WIDTH = 4;
+    using Reg = __m256d;
+    using Mask = __m256d;
+
+    static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, Reg v) { _mm256_storeu_pd(p, v); }
+    static Reg set(double v) { return _mm256_set1_pd(v); }
+    static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm256_sub_pd(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm256_mul_pd(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm256_div_pd(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+    static Reg sqrt(Reg a) { return _mm256_sqrt_pd(a); }
+    static Reg abs(Reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static Mask gt(Reg a, Reg b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static Mask lt(Reg a, Reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static Mask eq(Reg a, Reg b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static Reg select(Mask m, Reg a, Reg b) { return _mm256_blendv_pd(b, a, m); }
+};
+
+bool cpuHasAvx() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    return osxsave && avx && (_xgetbv(0) & 6) == 6;
+#else
+    return true;
+#endif
+}
+
+const bool USE_AVX = cpuHasAvx();
+#endif
+
+std::atomic<bool> scalarOnly{ false };
+
+// Runs body(Lane, i) for lanes starting at i in [first, n): full vectors first, scalar tail.
+template <class Lane, class Body>
+void forEachIndex(size_t first, size_t n, Body&& body) {
+    size_t i = first;
+    for (; i + Lane::WIDTH <= n; i += Lane::WIDTH) body(Lane(), i);
+    for (; i < n; ++i) body(ScalarLane(), i);
+}
+
+void fill(double* out, size_t from, size_t to, double value) {
+    for (size_t i = from; i < to; ++i) out[i] = value;
+}
+
+template <class Lane>
+void smaImpl(const double* close, size_t n, int period, double* out) {
+    size_t first = static_cast<size_t>(period - 1);
+    fill(out, 0, first < n ? first : n, 0.0);
+
+    forEachIndex<Lane>(first, n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg sum = L::set(0.0);
+        for (int k = 0; k < period; ++k) sum = L::add(sum, L::load(close + i - k));
+        L::store(out + i, L::div(sum, L::set(static_cast<double>(period))));
+        });
+}
+
+template <class Lane>
+void rsiImpl(const double* close, size_t n, int period, double* out) {
+    size_t first = static_cast<size_t>(period);
+    fill(out, 0, first < n ? first : n, 50.0);
+
+    forEachIndex<Lane>(first, n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg zero = L::set(0.0);
+        typename L::Reg gains = zero;
+        typename L::Reg losses = zero;
+        for (int k = 1; k <= period; ++k) {
+            typename L::Reg change = L::sub(L::load(close + i - k + 1), L::load(close + i - k));
+            typename L::Mask up = L::gt(change, zero);
+            gains = L::add(gains, L::select(up, change, zero));
+            losses = L::sub(losses, L::select(up, zero, change));
+        }
+        typename L::Reg p = L::set(static_cast<double>(period));
+        typename L::Reg avgGain = L::div(gains, p);
+        typename L::Reg avgLoss = L::div(losses, p);
+        typename L::Reg hundred = L::set(100.0);
+        typename L::Reg rsi = L::sub(hundred, L::div(hundred, L::add(L::set(1.0), L::div(avgGain, avgLoss))));
+        L::store(out + i, L::select(L::eq(avgLoss, zero), hundred, rsi));
+        });
+}
+
+template <class Lane>
+void bollingerImpl(const double* close, size_t n, int period, double multiplier,
+    double* upper, double* middle, double* lower) {
+    size_t first = static_cast<size_t>(period - 1);
+    size_t warmup = first < n ? first : n;
+    fill(upper, 0, warmup, 0.0);
+    fill(middle, 0, warmup, 0.0);
+    fill(lower, 0, warmup, 0.0);
+
+    forEachIndex<Lane>(first, n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg p = L::set(static_cast<double>(period));
+        typename L::Reg sum = L::set(0.0);
+        for (int k = 0; k < period; ++k) sum = L::add(sum, L::load(close + i - k));
+        typename L::Reg sma = L::div(sum, p);
+
+        typename L::Reg squared = L::set(0.0);
+        for (int k = 0; k < period; ++k) {
+            typename L::Reg diff = L::sub(L::load(close + i - k), sma);
+            squared = L::add(squared, L::mul(diff, diff));
+        }
+        typename L::Reg band = L::mul(L::sqrt(L::div(squared, p)), L::set(multiplier));
+
+        L::store(upper + i, L::add(sma, band));
+        L::store(middle + i, sma);
+        L::store(lower + i, L::sub(sma, band));
+        });
+}
+
+template <class Lane>
+void stochasticImpl(const double* high, const double* low, const double* close, size_t n,
+    int kPeriod, int dPeriod, double* k, double* d) {
+    size_t first = static_cast<size_t>(kPeriod - 1);
+    fill(k, 0, first < n ? first : n, 50.0);
+    fill(d, 0, n, 50.0);
+
+    forEachIndex<Lane>(first, n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg highest = L::load(high + i);
+        typename L::Reg lowest = L::load(low + i);
+        for (int j = 1; j < kPeriod; ++j) {
+            highest = L::max(highest, L::load(high + i - j));
+            lowest = L::min(lowest, L::load(low + i - j));
+        }
+        typename L::Reg value = L::mul(L::div(L::sub(L::load(close + i), lowest), L::sub(highest, lowest)), L::set(100.0));
+        L::store(k + i, L::select(L::eq(highest, lowest), L::set(50.0), value));
+        });
+
+    // %D is the SMA of %K, summed newest first like the node.
+    forEachIndex<Lane>(static_cast<size_t>(kPeriod + dPeriod - 2), n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg sum = L::set(0.0);
+        for (int j = 0; j < dPeriod; ++j) sum = L::add(sum, L::load(k + i - j));
+        L::store(d + i, L::div(sum, L::set(static_cast<double>(dPeriod))));
+        });
+}
+
+template <class Lane>
+void cciImpl(const double* typical, size_t n, int period, double* out) {
+    size_t first = static_cast<size_t>(period - 1);
+    fill(out, 0, first < n ? first : n, 0.0);
+
+    forEachIndex<Lane>(first, n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg p = L::set(static_cast<double>(period));
+        typename L::Reg sum = L::set(0.0);
+        for (int k = 0; k < period; ++k) sum = L::add(sum, L::load(typical + i - k));
+        typename L::Reg sma = L::div(sum, p);
+
+        typename L::Reg deviation = L::set(0.0);
+        for (int k = 0; k < period; ++k) deviation = L::add(deviation, L::abs(L::sub(L::load(typical + i - k), sma)));
+        typename L::Reg meanDeviation = L::div(deviation, p);
+
+        typename L::Reg zero = L::set(0.0);
+        typename L::Reg cci = L::div(L::sub(L::load(typical + i), sma), L::mul(L::set(0.015), meanDeviation));
+        L::store(out + i, L::select(L::eq(meanDeviation, zero), zero, cci));
+        });
+}
+
+template <class Lane>
+void mfiImpl(const double* typical, const double* volume, size_t n, int period, double* out) {
+    size_t first = static_cast<size_t>(period);
+    fill(out, 0, first < n ? first : n, 50.0);
+
+    forEachIndex<Lane>(first, n, [&](auto lane, size_t i) {
+        using L = decltype(lane);
+        typename L::Reg zero = L::set(0.0);
+        typename L::Reg positive = zero;
+        typename L::Reg negative = zero;
+        for (int k = 1; k <= period; ++k) {
+            size_t curr = i - k + 1;
+            typename L::Reg tp = L::load(typical + curr);
+            typename L::Reg prev = L::load(typical + curr - 1);
+            typename L::Reg flow = L::mul(tp, L::load(volume + curr));
+            positive = L::add(positive, L::select(L::gt(tp, prev), flow, zero));
+            negative = L::add(negative, L::select(L::lt(tp, prev), flow, zero));
+        }
+        typename L::Reg hundred = L::set(100.0);
+        typename L::Reg mfi = L::sub(hundred, L::div(hundred, L::add(L::set(1.0), L::div(positive, negative))));
+        L::store(out + i, L::select(L::eq(negative, zero), hundred, mfi));
+        });
+}
+
+// Calls kernel<Lane> with the widest lane available on this CPU.
+#if defined(INDICATOR_AVX) && defined(INDICATOR_SSE2)
+#define DISPATCH(kernel, ...) \
+    (scalarOnly.load(std::memory_order_relaxed) ? kernel<ScalarLane>(__VA_ARGS__) : \
+     USE_AVX ? kernel<AvxLane>(__VA_ARGS__) : kernel<Sse2Lane>(__VA_ARGS__))
+#elif defined(INDICATOR_AVX)
+#define DISPATCH(kernel, ...) \
+    (USE_AVX && !scalarOnly.load(std::memory_order_relaxed) ? kernel<AvxLane>(__VA_ARGS__) : kernel<ScalarLane>(__VA_ARGS__))
+#elif defined(INDICATOR_SSE2)
+#define DISPATCH(kernel, ...) \
+    (scalarOnly.load(std::memory_order_relaxed) ? kernel<ScalarLane>(__VA_ARGS__) : kernel<Sse2Lane>(__VA_ARGS__))
+#else
+#define DISPATCH(kernel, ...) kernel<ScalarLane>(__VA_ARGS__)
+#endif
+
+}
+
+void IndicatorKernels::extract(CandleSeriesView candles, Series& out) {
+    size_t n = candles.size();
+    out.high.resize(n);
+    out.low.resize(n);
+    out.close.resize(n);
+    out.volume.resize(n);
+    out.typical.resize(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        const MarketData& candle = candles[i];
+        out.high[i] = static_cast<double>(candle.high);
+        out.low[i] = static_cast<double>(candle.low);
+        out.close[i] = static_cast<double>(candle.close);
+        out.volume[i] = candle.volume;
+        out.typical[i] = (out.high[i] + out.low[i] + out.close[i]) / 3.0;
+    }
+}
+
+void IndicatorKernels::sma(const double* close, size_t n, int period, double* out) {
+    if (period <= 0) return fill(out, 0, n, 0.0);
+    DISPATCH(smaImpl, close, n, period, out);
+}
+
+void IndicatorKernels::rsi(const double* close, size_t n, int period, double* out) {
+    if (period <= 0) return fill(out, 0, n, 50.0);
+    DISPATCH(rsiImpl, close, n, period, out);
+}
+
+void IndicatorKernels::bollinger(const double* close, size_t n, int period, double multiplier,
+    double* upper, double* middle, double* lower) {
+    if (period <= 0) {
+        fill(upper, 0, n, 0.0);
+        fill(middle, 0, n, 0.0);
+        fill(lower, 0, n, 0.0);
+        return;
+    }
+    DISPATCH(bollingerImpl, close, n, period, multiplier, upper, middle, lower);
+}
+
+void IndicatorKernels::stochastic(const double* high, const double* low, const double* close, size_t n,
+    int kPeriod, int dPeriod, double* k, double* d) {
+    if (kPeriod <= 0 || dPeriod <= 0) {
+        fill(k, 0, n, 50.0);
+        fill(d, 0, n, 50.0);
+        return;
+    }
+    DISPATCH(stochasticImpl, high, low, close, n, kPeriod, dPeriod, k, d);
+}
+
+void IndicatorKernels::cci(const double* typical, size_t n, int period, double* out) {
+    if (period <= 0) return fill(out, 0, n, 0.0);
+    DISPATCH(cciImpl, typical, n, period, out);
+}
+
+void IndicatorKernels::mfi(const double* typical, const double* volume, size_t n, int period, double* out) {
+    if (period <= 0) return fill(out, 0, n, 50.0);
+    DISPATCH(mfiImpl, typical, volume, n, period, out);
+}
+
+const char* IndicatorKernels::instructionSet() {
+#ifdef INDICATOR_AVX
+    if (USE_AVX) return "AVX";
+#endif
+#ifdef INDICATOR_SSE2
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+void IndicatorKernels::setScalarOnly(bool value) {
+    scalarOnly = value;
+}
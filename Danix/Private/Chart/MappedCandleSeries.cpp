@@ -0,0 +1,211 @@
+#include "../../Public/Chart/MappedCandleSeries.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char MAPPED_SERIES_MAGIC[4] = { 'D', 'X', 'C', 'S' };
+
+MappedCandleSeries::MappedCandleSeries()
+    : m_candles(nullptr), m_count(0), m_view(nullptr), m_viewSize(0)
+#ifdef _WIN32
+    , m_fileHandle(INVALID_HANDLE_VALUE), m_mappingHandle(nullptr)
+#else
+    , m_fd(-1)
+#endif
+{
+}
+
+MappedCandleSeries::~MappedCandleSeries() {
+    close();
+}
+
+bool MappedCandleSeries::open(const std::string& filename) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "[MappedCandleSeries] Failed to open " << filename << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(MappedSeriesHeader)) {
+        std::cerr << "[MappedCandleSeries] File too small: " << filename << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        std::cerr << "[MappedCandleSeries] CreateFileMapping failed: " << GetLastError() << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        std::cerr << "[MappedCandleSeries] MapViewOfFile failed: " << GetLastError() << std::endl;
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_view = view;
+    m_viewSize = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[MappedCandleSeries] Failed to open " << filename << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(MappedSeriesHeader)) {
+        std::cerr << "[MappedCandleSeries] File too small: " << filename << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        std::cerr << "[MappedCandleSeries] mmap failed for " << filename << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    m_fd = fd;
+    m_view = view;
+    m_viewSize = (size_t)st.st_size;
+#endif
+
+    // Only the header is touched here; candle pages are faulted in on demand.
+    const MappedSeriesHeader* header = static_cast<const MappedSeriesHeader*>(m_view);
+    if (std::memcmp(header->magic, MAPPED_SERIES_MAGIC, 4) != 0 || header->version != FORMAT_VERSION) {
+        std::cerr << "[MappedCandleSeries] Unsupported file format: " << filename << std::endl;
+        close();
+        return false;
+    }
+    if (header->recordSize != sizeof(MarketData)) {
+        std::cerr << "[MappedCandleSeries] Record size mismatch (file " << header->recordSize
+            << ", expected " << sizeof(MarketData) << "): " << filename << std::endl;
+        close();
+        return false;
+    }
+    if (header->dataOffset < sizeof(MappedSeriesHeader) || header->dataOffset > m_viewSize ||
+        header->count > (m_viewSize - header->dataOffset) / sizeof(MarketData)) {
+        std::cerr << "[MappedCandleSeries] Truncated file: " << filename << std::endl;
+        close();
+        return false;
+    }
+
+    m_filename = filename;
+    m_symbol.assign(header->symbol, strnlen(header->symbol, sizeof(header->symbol)));
+    m_count = (size_t)header->count;
+    m_candles = reinterpret_cast<const MarketData*>(static_cast<const char*>(m_view) + header->dataOffset);
+    return true;
+}
+
+void MappedCandleSeries::close() {
+#ifdef _WIN32
+    if (m_view) UnmapViewOfFile(m_view);
+    if (m_mappingHandle) CloseHandle(m_mappingHandle);
+    if (m_fileHandle != INVALID_HANDLE_VALUE) CloseHandle(m_fileHandle);
+    m_mappingHandle = nullptr;
+    m_fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (m_view) munmap(m_view, m_viewSize);
+    if (m_fd >= 0) ::close(m_fd);
+    m_fd = -1;
+#endif
+    m_view = nullptr;
+    m_viewSize = 0;
+    m_candles = nullptr;
+    m_count = 0;
+    m_filename.clear();
+    m_symbol.clear();
+}
+
+CandleSeriesView MappedCandleSeries::view(size_t count) const {
+    return CandleSeriesView(m_candles, count < m_count ? count : m_count);
+}
+
+void MappedCandleSeries::adviseSequential() {
+    if (!m_view) return;
+#ifdef _WIN32
+    // FILE_FLAG_SEQUENTIAL_SCAN on open already enables aggressive read-ahead.
+    prefetch(0, PREFETCH_WINDOW);
+#else
+    madvise(m_view, m_viewSize, MADV_SEQUENTIAL);
+#endif
+}
+
+void MappedCandleSeries::prefetch(size_t start, size_t count) {
+    if (!m_view || start >= m_count) return;
+    if (count > m_count - start) count = m_count - start;
+
+    const char* begin = reinterpret_cast<const char*>(m_candles + start);
+    size_t length = count * sizeof(MarketData);
+
+#ifdef _WIN32
+#if _WIN32_WINNT >= 0x0602
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<char*>(begin);
+    range.NumberOfBytes = length;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    (void)begin;
+    (void)length;
+#endif
+#else
+    // madvise requires a page-aligned start address.
+    const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    uintptr_t alignedBegin = reinterpret_cast<uintptr_t>(begin) & ~(uintptr_t)(pageSize - 1);
+    length += reinterpret_cast<uintptr_t>(begin) - alignedBegin;
+    madvise(reinterpret_cast<void*>(alignedBegin), length, MADV_WILLNEED);
+#endif
+}
+
+bool MappedCandleSeries::writeFile(const std::string& filename, const std::string& symbol, const std::vector<MarketData>& candles) {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "[MappedCandleSeries] Failed to create " << filename << std::endl;
+        return false;
+    }
+
+    MappedSeriesHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAPPED_SERIES_MAGIC, 4);
+    header.version = FORMAT_VERSION;
+    header.recordSize = sizeof(MarketData);
+    header.count = candles.size();
+    header.dataOffset = sizeof(MappedSeriesHeader);
+    std::strncpy(header.symbol, symbol.c_str(), sizeof(header.symbol) - 1);
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!candles.empty()) {
+        out.write(reinterpret_cast<const char*>(candles.data()), candles.size() * sizeof(MarketData));
+    }
+    out.close();
+
+    if (!out) {
+        std::cerr << "[MappedCandleSeries] Write failed for " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -1,4 +1,5 @@
 #include "../../../Public/Exchanges/Bybit/BybitAPI.h"
+#include "../../../Public/Exchanges/Bybit/CurlHandlePool.h"
 #include <iostream>
 #include <sstream>
 #include <chrono>
@@ -11,15 +12,11 @@ namespace Bybit {
 BybitAPI::BybitAPI() 
     : m_baseUrl("https://api-demo.bybit.com")
     , m_timeout(10)
-    , m_curl(nullptr)
 {
-    initCurl();
+    CurlHandlePool::getInstance().prewarm(m_baseUrl);
 }
 
 BybitAPI::~BybitAPI() {
-    if (m_curl) {
-        curl_easy_cleanup(m_curl);
-    }
 }
 
 void BybitAPI::setApiKeys(const std::string& apiKey, const std::string& apiSecret) {
@@ -33,16 +30,13 @@ void BybitAPI::setTestnet(bool isTestnet) {
     } else {
         m_baseUrl = "https://api.bybit.com";
     }
+    CurlHandlePool::getInstance().prewarm(m_baseUrl);
 }
 
 void BybitAPI::setTimeout(long timeout) {
     m_timeout = timeout;
 }
 
-void BybitAPI::initCurl() {
-    m_curl = curl_easy_init();
-}
-
 size_t BybitAPI::writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
     ((std::string*)userp)->append((char*)contents, size * nmemb);
     return size * nmemb;
@@ -131,7 +125,9 @@ int curlDebugCallback(CURL* handle, curl_infotype type, char* data, size_t size,
 }
 
 std::string BybitAPI::get(const std::string& endpoint, const std::map<std::string, std::string>& params, bool needAuth) {
-    if (!m_curl) return "{\"error\":\"CURL not initialized\"}";
+    PooledCurlHandle handle = CurlHandlePool::getInstance().acquire();
+    CURL* curl = handle.get();
+    if (!curl) return "{\"error\":\"CURL not initialized\"}";
     
     std::string response;
     std::string url = buildUrl(endpoint, params);
@@ -161,20 +157,18 @@ std::string BybitAPI::get(const std::string& endpoint, const std::map<std::strin
     
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
-    curl_easy_setopt(m_curl, CURLOPT_HTTPGET, 1L);
-    curl_easy_setopt(m_curl, CURLOPT_POST, 0L);
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(curl, CURLOPT_POST, 0L);
 
-    curl_easy_setopt(m_curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(m_curl, CURLOPT_HTTPHEADER, headers);
-    curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, &response);
-    //curl_easy_setopt(m_curl, CURLOPT_VERBOSE, 1L);
-    //curl_easy_setopt(m_curl, CURLOPT_DEBUGFUNCTION, curlDebugCallback);
-    curl_easy_setopt(m_curl, CURLOPT_TIMEOUT, m_timeout);
-    curl_easy_setopt(m_curl, CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(m_curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+    //curl_easy_setopt(curl, CURLOPT_VERBOSE, 1L);
+    //curl_easy_setopt(curl, CURLOPT_DEBUGFUNCTION, curlDebugCallback);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, m_timeout);
     
-    CURLcode res = curl_easy_perform(m_curl);
+    CURLcode res = curl_easy_perform(curl);
     
     if (headers) {
         curl_slist_free_all(headers);
@@ -188,7 +182,9 @@ std::string BybitAPI::get(const std::string& endpoint, const std::map<std::strin
 }
 
 std::string BybitAPI::post(const std::string& endpoint, const std::string& body, bool needAuth) {
-    if (!m_curl) return "{\"error\":\"CURL not initialized\"}";
+    PooledCurlHandle handle = CurlHandlePool::getInstance().acquire();
+    CURL* curl = handle.get();
+    if (!curl) return "{\"error\":\"CURL not initialized\"}";
     
     std::string response;
     std::string url = m_baseUrl + endpoint;
@@ -207,20 +203,18 @@ std::string BybitAPI::post(const std::string& endpoint, const std::string& body,
     
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
-    curl_easy_setopt(m_curl, CURLOPT_HTTPGET, 0L);
-    curl_easy_setopt(m_curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 0L);
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
 
-    curl_easy_setopt(m_curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(m_curl, CURLOPT_POST, 1L);
-    curl_easy_setopt(m_curl, CURLOPT_POSTFIELDS, body.c_str());
-    curl_easy_setopt(m_curl, CURLOPT_HTTPHEADER, headers);
-    curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(m_curl, CURLOPT_TIMEOUT, m_timeout);
-    curl_easy_setopt(m_curl, CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(m_curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, m_timeout);
     
-    CURLcode res = curl_easy_perform(m_curl);
+    CURLcode res = curl_easy_perform(curl);
     
     if (headers) {
         curl_slist_free_all(headers);
@@ -0,0 +1,383 @@
+#include "../../../Public/Exchanges/Bybit/BybitAccountState.h"
+#include <iostream>
+#include <climits>
+
+using json = nlohmann::json;
+
+namespace Bybit {
+
+static double jsonToDouble(const json& obj, const char* key) {
+    auto it = obj.find(key);
+    if (it == obj.end() || it->is_null()) return 0.0;
+    if (it->is_number()) return it->get<double>();
+    if (it->is_string()) {
+        const std::string& s = it->get_ref<const std::string&>();
+        if (s.empty()) return 0.0;
+        try { return std::stod(s); }
+        catch (...) { return 0.0; }
+    }
+    return 0.0;
+}
+
+static uint64_t jsonToUint64(const json& obj, const char* key) {
+    auto it = obj.find(key);
+    if (it == obj.end() || it->is_null()) return 0;
+    if (it->is_number_unsigned()) return it->get<uint64_t>();
+    if (it->is_number_integer()) return (uint64_t)it->get<int64_t>();
+    if (it->is_string() && !it->get_ref<const std::string&>().empty()) {
+        try { return std::stoull(it->get_ref<const std::string&>()); }
+        catch (...) { return 0; }
+    }
+    return 0;
+}
+
+static std::string jsonToString(const json& obj, const char* key) {
+    auto it = obj.find(key);
+    if (it == obj.end() || it->is_null()) return "";
+    if (it->is_string()) return it->get<std::string>();
+    return it->dump();
+}
+
+// Bybit sends order timestamps as millisecond strings.
+static uint64_t timeField(const std::string& value) {
+    if (value.empty()) return 0;
+    try { return std::stoull(value); }
+    catch (...) { return 0; }
+}
+
+BybitAccountState& BybitAccountState::getInstance() {
+    static BybitAccountState instance;
+    return instance;
+}
+
+BybitAccountState::BybitAccountState()
+    : m_live(false)
+    , m_totalEquity(0.0)
+    , m_availableBalance(0.0)
+{
+}
+
+void BybitAccountState::setLive(bool live) {
+    m_live = live;
+    m_orderCv.notify_all();
+}
+
+void BybitAccountState::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_positions.clear();
+    m_orders.clear();
+    m_orderIdByLinkId.clear();
+    m_finishedOrders.clear();
+    m_executions.clear();
+    m_balances.clear();
+    m_totalEquity = 0.0;
+    m_availableBalance = 0.0;
+}
+
+bool BybitAccountState::isFinalStatus(const std::string& status) {
+    return status == "Filled" || status == "Cancelled" || status == "Rejected" ||
+        status == "Deactivated" || status == "PartiallyFilledCanceled";
+}
+
+void BybitAccountState::applyMessage(const json& message) {
+    if (!message.contains("topic") || !message.contains("data")) return;
+
+    const std::string topic = message["topic"].get<std::string>();
+    const json& data = message["data"];
+    if (!data.is_array()) return;
+
+    // Topics may carry a category suffix, e.g. "order.linear".
+    if (topic.compare(0, 8, "position") == 0) applyPositions(data);
+    else if (topic.compare(0, 9, "execution") == 0) applyExecutions(data);
+    else if (topic.compare(0, 5, "order") == 0) applyOrders(data);
+    else if (topic.compare(0, 6, "wallet") == 0) applyWallet(data);
+}
+
+void BybitAccountState::applyPositions(const json& data) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& item : data) {
+        PositionInfo pos;
+        pos.symbol = jsonToString(item, "symbol");
+        pos.side = jsonToString(item, "side");
+        pos.size = jsonToDouble(item, "size");
+        pos.positionValue = jsonToDouble(item, "positionValue");
+        pos.avgPrice = item.contains("avgPrice") ? jsonToDouble(item, "avgPrice") : jsonToDouble(item, "entryPrice");
+        pos.markPrice = jsonToDouble(item, "markPrice");
+        pos.liqPrice = jsonToDouble(item, "liqPrice");
+        pos.bustPrice = jsonToDouble(item, "bustPrice");
+        pos.leverage = jsonToDouble(item, "leverage");
+        pos.positionIM = jsonToDouble(item, "positionIM");
+        pos.positionMM = jsonToDouble(item, "positionMM");
+        pos.unrealisedPnl = jsonToDouble(item, "unrealisedPnl");
+        pos.cumRealisedPnl = jsonToDouble(item, "cumRealisedPnl");
+        pos.curRealisedPnl = jsonToDouble(item, "curRealisedPnl");
+        pos.positionBalance = jsonToDouble(item, "positionBalance");
+        pos.stopLoss = jsonToDouble(item, "stopLoss");
+        pos.takeProfit = jsonToDouble(item, "takeProfit");
+        pos.trailingStop = jsonToDouble(item, "trailingStop");
+        pos.positionStatus = jsonToString(item, "positionStatus");
+        pos.tpslMode = jsonToString(item, "tpslMode");
+        pos.tradeMode = (int)jsonToDouble(item, "tradeMode");
+        pos.positionIdx = (int)jsonToDouble(item, "positionIdx");
+        pos.createdTime = jsonToUint64(item, "createdTime");
+        pos.updatedTime = jsonToUint64(item, "updatedTime");
+        pos.seq = (long long)jsonToUint64(item, "seq");
+
+        if (pos.symbol.empty()) continue;
+
+        auto key = std::make_pair(pos.symbol, pos.positionIdx);
+        auto it = m_positions.find(key);
+        if (it != m_positions.end() && it->second.seq > pos.seq && pos.seq > 0) continue;
+        m_positions[key] = pos;
+    }
+}
+
+void BybitAccountState::applyOrders(const json& data) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& item : data) {
+            OpenOrder order;
+            order.orderId = jsonToString(item, "orderId");
+            order.orderLinkId = jsonToString(item, "orderLinkId");
+            order.symbol = jsonToString(item, "symbol");
+            order.side = jsonToString(item, "side");
+            order.orderType = jsonToString(item, "orderType");
+            order.price = jsonToDouble(item, "price");
+            order.qty = jsonToDouble(item, "qty");
+            order.cumExecQty = jsonToDouble(item, "cumExecQty");
+            order.cumExecValue = jsonToDouble(item, "cumExecValue");
+            order.cumExecFee = jsonToDouble(item, "cumExecFee");
+            order.timeInForce = jsonToString(item, "timeInForce");
+            order.orderStatus = jsonToString(item, "orderStatus");
+            order.avgPrice = jsonToDouble(item, "avgPrice");
+            order.leavesQty = jsonToDouble(item, "leavesQty");
+            order.leavesValue = jsonToDouble(item, "leavesValue");
+            order.stopOrderType = jsonToString(item, "stopOrderType");
+            order.triggerPrice = jsonToDouble(item, "triggerPrice");
+            order.takeProfit = jsonToDouble(item, "takeProfit");
+            order.stopLoss = jsonToDouble(item, "stopLoss");
+            order.reduceOnly = item.value("reduceOnly", false);
+            order.closeOnTrigger = item.value("closeOnTrigger", false);
+            order.positionIdx = (int)jsonToDouble(item, "positionIdx");
+            order.createdTime = jsonToString(item, "createdTime");
+            order.updatedTime = jsonToString(item, "updatedTime");
+
+            if (order.orderId.empty()) continue;
+            storeOrder(order);
+        }
+    }
+    m_orderCv.notify_all();
+}
+
+void BybitAccountState::storeOrder(const OpenOrder& order) {
+    bool wasFinal = false;
+    auto existing = m_orders.find(order.orderId);
+    if (existing != m_orders.end()) wasFinal = isFinalStatus(existing->second.orderStatus);
+
+    m_orders[order.orderId] = order;
+    if (!order.orderLinkId.empty()) m_orderIdByLinkId[order.orderLinkId] = order.orderId;
+
+    if (!wasFinal && isFinalStatus(order.orderStatus)) {
+        m_finishedOrders.push_back(order.orderId);
+    }
+
+    // Keep a bounded history of finished orders for waitForOrderFinal lookups.
+    while (m_finishedOrders.size() > MAX_FINISHED_ORDERS) {
+        auto it = m_orders.find(m_finishedOrders.front());
+        if (it != m_orders.end()) {
+            m_orderIdByLinkId.erase(it->second.orderLinkId);
+            m_orders.erase(it);
+        }
+        m_finishedOrders.pop_front();
+    }
+}
+
+void BybitAccountState::seed(const std::vector<PositionInfo>& positions, const std::vector<OpenOrder>& orders, uint64_t requestedAt) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // The snapshot only lists open positions: anything else the mirror still holds
+        // closed while the stream was down, unless the stream reported it after the request.
+        std::map<std::pair<std::string, int>, PositionInfo> snapshot;
+        for (const auto& pos : positions) {
+            if (pos.symbol.empty()) continue;
+            snapshot[std::make_pair(pos.symbol, pos.positionIdx)] = pos;
+        }
+        for (const auto& item : m_positions) {
+            auto it = snapshot.find(item.first);
+            if (it == snapshot.end()) {
+                if (item.second.updatedTime >= requestedAt) snapshot.insert(item);
+            }
+            else if (item.second.seq > it->second.seq && it->second.seq > 0) {
+                it->second = item.second;
+            }
+        }
+        m_positions.swap(snapshot);
+
+        std::map<std::string, bool> listed;
+        for (const auto& order : orders) {
+            if (order.orderId.empty()) continue;
+            listed[order.orderId] = true;
+
+            auto existing = m_orders.find(order.orderId);
+            if (existing != m_orders.end() && timeField(existing->second.updatedTime) > timeField(order.updatedTime)) continue;
+            storeOrder(order);
+        }
+
+        // Open orders missing from the snapshot finished while the stream was down; their
+        // final state is unknown, so they are dropped rather than reported as still open.
+        for (auto it = m_orders.begin(); it != m_orders.end();) {
+            const OpenOrder& order = it->second;
+            if (!isFinalStatus(order.orderStatus) && !listed.count(it->first) && timeField(order.updatedTime) < requestedAt) {
+                m_orderIdByLinkId.erase(order.orderLinkId);
+                it = m_orders.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    m_orderCv.notify_all();
+}
+
+void BybitAccountState::applyExecutions(const json& data) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& item : data) {
+        Execution exec;
+        exec.symbol = jsonToString(item, "symbol");
+        exec.orderId = jsonToString(item, "orderId");
+        exec.orderLinkId = jsonToString(item, "orderLinkId");
+        exec.side = jsonToString(item, "side");
+        exec.orderType = jsonToString(item, "orderType");
+        exec.execPrice = jsonToDouble(item, "execPrice");
+        exec.execQty = jsonToDouble(item, "execQty");
+        exec.execValue = jsonToDouble(item, "execValue");
+        exec.execFee = jsonToDouble(item, "execFee");
+        exec.feeRate = jsonToString(item, "feeRate");
+        exec.execTime = jsonToString(item, "execTime");
+        exec.isMaker = item.value("isMaker", false);
+        exec.execType = jsonToString(item, "execType");
+        exec.execId = jsonToString(item, "execId");
+        exec.seq = (long long)jsonToUint64(item, "seq");
+
+        m_executions.push_back(exec);
+    }
+    while (m_executions.size() > MAX_EXECUTIONS) {
+        m_executions.pop_front();
+    }
+}
+
+void BybitAccountState::applyWallet(const json& data) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& account : data) {
+        m_totalEquity = jsonToDouble(account, "totalEquity");
+        m_availableBalance = jsonToDouble(account, "totalAvailableBalance");
+
+        if (!account.contains("coin") || !account["coin"].is_array()) continue;
+
+        m_balances.clear();
+        for (const auto& coin : account["coin"]) {
+            Balance balance;
+            balance.coin = jsonToString(coin, "coin");
+            balance.total = jsonToDouble(coin, "walletBalance");
+            balance.locked = jsonToDouble(coin, "locked");
+            balance.available = balance.total - balance.locked;
+            m_balances.push_back(balance);
+        }
+    }
+}
+
+bool BybitAccountState::getPosition(const std::string& symbol, PositionInfo& position) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const PositionInfo* best = nullptr;
+    for (auto it = m_positions.lower_bound(std::make_pair(symbol, INT_MIN)); it != m_positions.end() && it->first.first == symbol; ++it) {
+        const PositionInfo& candidate = it->second;
+        if (!best) { best = &candidate; continue; }
+
+        bool open = candidate.size > 0.0, bestOpen = best->size > 0.0;
+        if (open != bestOpen ? open : candidate.updatedTime > best->updatedTime) best = &candidate;
+    }
+    if (!best) return false;
+    position = *best;
+    return true;
+}
+
+bool BybitAccountState::getPosition(const std::string& symbol, int positionIdx, PositionInfo& position) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_positions.find(std::make_pair(symbol, positionIdx));
+    if (it == m_positions.end()) return false;
+    position = it->second;
+    return true;
+}
+
+std::vector<PositionInfo> BybitAccountState::getPositions() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<PositionInfo> result;
+    for (const auto& item : m_positions) {
+        if (item.second.size > 0.0) result.push_back(item.second);
+    }
+    return result;
+}
+
+bool BybitAccountState::getOrderByLinkId(const std::string& orderLinkId, OpenOrder& order) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto link = m_orderIdByLinkId.find(orderLinkId);
+    if (link == m_orderIdByLinkId.end()) return false;
+    auto it = m_orders.find(link->second);
+    if (it == m_orders.end()) return false;
+    order = it->second;
+    return true;
+}
+
+std::vector<OpenOrder> BybitAccountState::getOpenOrders(const std::string& symbol) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<OpenOrder> result;
+    for (const auto& item : m_orders) {
+        const OpenOrder& order = item.second;
+        if (isFinalStatus(order.orderStatus)) continue;
+        if (!symbol.empty() && order.symbol != symbol) continue;
+        result.push_back(order);
+    }
+    return result;
+}
+
+std::vector<Execution> BybitAccountState::getExecutions(const std::string& symbol, size_t limit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<Execution> result;
+    for (auto it = m_executions.rbegin(); it != m_executions.rend() && result.size() < limit; ++it) {
+        if (!symbol.empty() && it->symbol != symbol) continue;
+        result.push_back(*it);
+    }
+    return result;
+}
+
+std::vector<Balance> BybitAccountState::getBalances() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_balances;
+}
+
+double BybitAccountState::getTotalEquity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_totalEquity;
+}
+
+double BybitAccountState::getAvailableBalance() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_availableBalance;
+}
+
+bool BybitAccountState::waitForOrderFinal(const std::string& orderLinkId, std::chrono::milliseconds timeout, OpenOrder& order) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool found = m_orderCv.wait_for(lock, timeout, [this, &orderLinkId, &order]() {
+        if (!m_live.load()) return true;
+        auto link = m_orderIdByLinkId.find(orderLinkId);
+        if (link == m_orderIdByLinkId.end()) return false;
+        auto it = m_orders.find(link->second);
+        if (it == m_orders.end() || !isFinalStatus(it->second.orderStatus)) return false;
+        order = it->second;
+        return true;
+        });
+    return found && m_live.load() && isFinalStatus(order.orderStatus);
+}
+
+}
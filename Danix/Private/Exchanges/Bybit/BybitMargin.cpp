@@ -27,7 +27,9 @@ bool BybitMargin::setLeverage(const std::string& symbol, double leverage) {
     j["sellLeverage"] = leverageStr;
     
     std::string response = post("/v5/position/set-leverage", j.dump(), true);
-    return response.find("\"retCode\":0") != std::string::npos;
+    // 110043: leverage not modified, i.e. it is already at the requested value.
+    return response.find("\"retCode\":0") != std::string::npos ||
+        response.find("\"retCode\":110043") != std::string::npos;
 }
 
 bool BybitMargin::setMarginMode(const std::string& symbol, TradeMode mode) {
@@ -40,19 +42,23 @@ bool BybitMargin::setMarginMode(const std::string& symbol, TradeMode mode) {
     return response.find("\"retCode\":0") != std::string::npos;
 }
 
-OrderResult BybitMargin::openLong(const std::string& symbol, double quantity, double price, bool reduceOnly) {
+OrderResult BybitMargin::openLong(const std::string& symbol, double quantity, double price, bool reduceOnly, const std::string& orderLinkId) {
     OrderType type = (price > 0.0) ? OrderType::LIMIT : OrderType::MARKET;
-    return placeOrder(symbol, OrderSide::BUY, type, quantity, price, reduceOnly);
+    return placeOrder(symbol, OrderSide::BUY, type, quantity, price, reduceOnly, orderLinkId);
 }
 
-OrderResult BybitMargin::openShort(const std::string& symbol, double quantity, double price, bool reduceOnly) {
+OrderResult BybitMargin::openShort(const std::string& symbol, double quantity, double price, bool reduceOnly, const std::string& orderLinkId) {
     OrderType type = (price > 0.0) ? OrderType::LIMIT : OrderType::MARKET;
-    return placeOrder(symbol, OrderSide::SELL, type, quantity, price, reduceOnly);
+    return placeOrder(symbol, OrderSide::SELL, type, quantity, price, reduceOnly, orderLinkId);
 }
 
-OrderResult BybitMargin::closePosition(const std::string& symbol, double quantity) {
+OrderResult BybitMargin::closePosition(const std::string& symbol, double quantity, const std::string& orderLinkId) {
     PositionInfo pos = getPosition(symbol);
-    
+    if (pos.symbol.empty()) pos.symbol = symbol;
+    return closePosition(pos, quantity, orderLinkId);
+}
+
+OrderResult BybitMargin::closePosition(const PositionInfo& pos, double quantity, const std::string& orderLinkId) {
     if (pos.size == 0.0) {
         OrderResult result;
         result.success = false;
@@ -63,7 +69,7 @@ OrderResult BybitMargin::closePosition(const std::string& symbol, double quantit
     OrderSide closeSide = (pos.side == "Buy") ? OrderSide::SELL : OrderSide::BUY;
     double closeQty = (quantity > 0.0) ? quantity : pos.size;
     
-    return placeOrder(symbol, closeSide, OrderType::MARKET, closeQty, 0.0, true);
+    return placeOrder(pos.symbol, closeSide, OrderType::MARKET, closeQty, 0.0, true, orderLinkId);
 }
 
 bool BybitMargin::setStopLoss(const std::string& symbol, double stopLoss, double quantity) {
@@ -113,9 +119,13 @@ PositionInfo BybitMargin::getPosition(const std::string& symbol) {
     return parsePosition(response);
 }
 
-std::vector<PositionInfo> BybitMargin::getAllPositions() {
+std::vector<PositionInfo> BybitMargin::getAllPositions(const std::string& settleCoin) {
     std::map<std::string, std::string> params;
     params["category"] = "linear";
+    if (!settleCoin.empty()) {
+        params["settleCoin"] = settleCoin;
+        params["limit"] = "200";
+    }
     
     std::string response = get("/v5/position/list", params, true);
     return parsePositions(response);
@@ -204,7 +214,8 @@ OrderResult BybitMargin::placeOrder(
     OrderType orderType,
     double quantity,
     double price,
-    bool reduceOnly
+    bool reduceOnly,
+    const std::string& orderLinkId
 ) {
     json j;
     j["category"] = "linear";
@@ -224,6 +235,9 @@ OrderResult BybitMargin::placeOrder(
     
     j["timeInForce"] = "GTC";
     j["reduceOnly"] = reduceOnly;
+    if (!orderLinkId.empty()) {
+        j["orderLinkId"] = orderLinkId;
+    }
     
     std::string response = post("/v5/order/create", j.dump(), true);
     return parseOrderResult(response);
@@ -493,6 +507,7 @@ OpenOrdersResult BybitMargin::parseOpenOrders(const std::string& jsonResponse)
                     order.reduceOnly = orderJson.value("reduceOnly", false);
                     order.closeOnTrigger = orderJson.value("closeOnTrigger", false);
                     order.placeType = orderJson.value("placeType", "");
+                    order.positionIdx = orderJson.value("positionIdx", 0);
                     order.createdTime = orderJson.value("createdTime", "");
                     order.updatedTime = orderJson.value("updatedTime", "");
                     result.orders.push_back(order);
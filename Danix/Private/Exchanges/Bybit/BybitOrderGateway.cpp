@@ -0,0 +1,278 @@
+#include "../../../Public/Exchanges/Bybit/BybitOrderGateway.h"
+#include "../../../Public/Exchanges/Bybit/BybitMargin.h"
+#include "../../../Public/Exchanges/Bybit/BybitAccountState.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+
+namespace Bybit {
+
+static uint64_t nowMs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+BybitOrderGateway& BybitOrderGateway::getInstance() {
+    static BybitOrderGateway instance;
+    return instance;
+}
+
+BybitOrderGateway::BybitOrderGateway()
+    : m_running(false)
+    , m_pendingCount(0)
+    , m_isTestnet(true)
+    , m_orderCounter(0)
+{
+}
+
+BybitOrderGateway::~BybitOrderGateway() {
+    shutdown();
+}
+
+void BybitOrderGateway::setCredentials(const std::string& apiKey, const std::string& apiSecret, bool isTestnet) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_apiKey = apiKey;
+    m_apiSecret = apiSecret;
+    m_isTestnet = isTestnet;
+}
+
+std::string BybitOrderGateway::nextClientOrderId() {
+    // orderLinkId is limited to 36 characters on Bybit.
+    return "dx-" + std::to_string(nowMs()) + "-" + std::to_string(++m_orderCounter);
+}
+
+void BybitOrderGateway::startWorkers() {
+    m_running = true;
+    for (size_t i = 0; i < WORKER_COUNT; ++i) {
+        m_workers.emplace_back(&BybitOrderGateway::workerLoop, this);
+    }
+}
+
+OrderTicket BybitOrderGateway::submit(const OrderRequest& request, OrderCallback callback) {
+    Job job;
+    job.clientOrderId = nextClientOrderId();
+    job.request = request;
+    job.callback = std::move(callback);
+    job.promise = std::make_shared<std::promise<OrderUpdate>>();
+
+    OrderTicket ticket;
+    ticket.clientOrderId = job.clientOrderId;
+    ticket.result = job.promise->get_future().share();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) startWorkers();
+
+        m_pending[request.symbol].push_back(std::move(job));
+        ++m_pendingCount;
+        if (m_scheduledSymbols.insert(request.symbol).second) {
+            m_readySymbols.push_back(request.symbol);
+        }
+    }
+    m_cv.notify_one();
+
+    return ticket;
+}
+
+void BybitOrderGateway::workerLoop() {
+    while (true) {
+        Job job;
+        std::string symbol;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return !m_running || !m_readySymbols.empty(); });
+            if (!m_running && m_readySymbols.empty()) return;
+
+            // A symbol sits in m_readySymbols at most once and is not re-queued until
+            // its current job finishes, which keeps per-symbol ordering.
+            symbol = m_readySymbols.front();
+            m_readySymbols.pop_front();
+            auto& queue = m_pending[symbol];
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        OrderUpdate update = execute(job);
+        job.promise->set_value(update);
+
+        if (job.callback) {
+            std::lock_guard<std::mutex> lock(m_completedMutex);
+            m_completed.emplace_back(job.callback, update);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_pendingCount;
+            auto it = m_pending.find(symbol);
+            if (it != m_pending.end() && !it->second.empty()) {
+                m_readySymbols.push_back(symbol);
+            }
+            else {
+                if (it != m_pending.end()) m_pending.erase(it);
+                m_scheduledSymbols.erase(symbol);
+            }
+        }
+        m_cv.notify_one();
+    }
+}
+
+OrderUpdate BybitOrderGateway::execute(const Job& job) {
+    const OrderRequest& request = job.request;
+
+    OrderUpdate update;
+    update.clientOrderId = job.clientOrderId;
+    update.symbol = request.symbol;
+    update.action = request.action;
+
+    BybitMargin margin;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        margin.setApiKeys(m_apiKey, m_apiSecret);
+        margin.setTestnet(m_isTestnet);
+    }
+
+    if (request.action != OrderAction::CLOSE_POSITION && request.leverage != 0.0) {
+        bool leverageKnown = false;
+        {
+            std::lock_guard<std::mutex> lock(m_cacheMutex);
+            auto it = m_leverage.find(request.symbol);
+            leverageKnown = it != m_leverage.end() && std::fabs(it->second - request.leverage) < 1e-9;
+        }
+        if (!leverageKnown) {
+            if (margin.setLeverage(request.symbol, request.leverage)) {
+                std::lock_guard<std::mutex> lock(m_cacheMutex);
+                m_leverage[request.symbol] = request.leverage;
+            }
+            else {
+                std::cerr << "[OrderGateway] setLeverage failed for " << request.symbol << std::endl;
+            }
+        }
+    }
+
+    switch (request.action) {
+    case OrderAction::OPEN_LONG:
+        update.result = margin.openLong(request.symbol, request.quantity, 0.0, false, job.clientOrderId);
+        break;
+    case OrderAction::OPEN_SHORT:
+        update.result = margin.openShort(request.symbol, request.quantity, 0.0, false, job.clientOrderId);
+        break;
+    case OrderAction::CLOSE_POSITION: {
+        PositionInfo cached;
+        if (getCachedPosition(request.symbol, cached) && cached.size > 0.0) {
+            update.result = margin.closePosition(cached, request.quantity, job.clientOrderId);
+        }
+        else {
+            update.result = margin.closePosition(request.symbol, request.quantity, job.clientOrderId);
+        }
+        break;
+    }
+    }
+
+    if (!update.result.success) {
+        std::cerr << "[OrderGateway] Order " << job.clientOrderId << " on " << request.symbol
+            << " failed: " << update.result.errorMessage << std::endl;
+        // A rejected order may come from a leverage changed outside of Danix; re-apply it next time.
+        invalidateLeverage(request.symbol);
+        update.timestamp = nowMs();
+        return update;
+    }
+
+    // With the private stream up, fill price and resulting position come from the
+    // pushed order/position updates; REST is only the fallback.
+    BybitAccountState& account = BybitAccountState::getInstance();
+    OpenOrder streamed;
+    if (account.isLive() &&
+        account.waitForOrderFinal(job.clientOrderId, std::chrono::milliseconds(STREAM_FILL_TIMEOUT_MS), streamed) &&
+        streamed.orderStatus == "Filled") {
+        PositionInfo position;
+        uint64_t filledAt = 0;
+        try { filledAt = std::stoull(streamed.updatedTime); }
+        catch (...) {}
+
+        if (account.getPosition(request.symbol, streamed.positionIdx, position) && position.updatedTime >= filledAt) {
+            update.position = position;
+            update.fillPrice = streamed.avgPrice > 0.0 ? streamed.avgPrice : streamed.price;
+            update.timestamp = nowMs();
+            updateCachedPosition(update.position);
+            return update;
+        }
+    }
+
+    update.position = margin.getPosition(request.symbol);
+    if (update.position.symbol.empty()) update.position.symbol = request.symbol;
+    updateCachedPosition(update.position);
+
+    if (request.action == OrderAction::CLOSE_POSITION) {
+        OrderHistoryResult history = margin.getOrderHistory("linear", request.symbol, update.result.orderId);
+        if (!history.orders.empty()) {
+            update.fillPrice = history.orders[0].avgPrice > 0.0 ? history.orders[0].avgPrice : history.orders[0].price;
+        }
+    }
+    else {
+        update.fillPrice = update.position.avgPrice;
+    }
+    update.timestamp = nowMs();
+
+    return update;
+}
+
+size_t BybitOrderGateway::dispatchCompleted() {
+    std::deque<std::pair<OrderCallback, OrderUpdate>> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        completed.swap(m_completed);
+    }
+
+    for (auto& entry : completed) {
+        entry.first(entry.second);
+    }
+    return completed.size();
+}
+
+bool BybitOrderGateway::getCachedPosition(const std::string& symbol, PositionInfo& position) const {
+    BybitAccountState& account = BybitAccountState::getInstance();
+    if (account.isLive() && account.getPosition(symbol, position)) return true;
+
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto it = m_positions.find(symbol);
+    if (it == m_positions.end()) return false;
+    position = it->second;
+    return true;
+}
+
+void BybitOrderGateway::updateCachedPosition(const PositionInfo& position) {
+    if (position.symbol.empty()) return;
+
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_positions[position.symbol] = position;
+    if (position.size > 0.0 && position.leverage > 0.0) {
+        m_leverage[position.symbol] = position.leverage;
+    }
+}
+
+void BybitOrderGateway::invalidateLeverage(const std::string& symbol) {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_leverage.erase(symbol);
+}
+
+size_t BybitOrderGateway::pendingCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pendingCount;
+}
+
+void BybitOrderGateway::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) return;
+        m_running = false;
+    }
+    m_cv.notify_all();
+
+    // Workers drain what is already queued before exiting.
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) worker.join();
+    }
+    m_workers.clear();
+}
+
+}
@@ -1,10 +1,16 @@
 #include "../../../Public/Exchanges/Bybit/BybitPriceCollector.h"
 #include "../../../Public/Exchanges/Bybit/BybitWebSocketManager.h"
+#include "../../../Public/Exchanges/Bybit/CurlHandlePool.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
 #include "../../../Public/Chart/CandleChartManager.h"
 
+static int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 
 BybitPriceCollector::BybitPriceCollector()
     : m_symbol("")
@@ -13,24 +19,15 @@ BybitPriceCollector::BybitPriceCollector()
     , m_dataManager(nullptr)
     , m_isLoading(false)
     , m_isStreaming(false)
-    , m_curl(nullptr)
+    , m_lastConfirmedTime(0)
+    , m_backfilling(false)
+    , m_lastBackfillMs(0)
 {
-    curl_global_init(CURL_GLOBAL_DEFAULT);
-    m_curl = curl_easy_init();
-
-    if (!m_curl) {
-        throw std::runtime_error("Failed to initialize CURL");
-    }
+    Bybit::CurlHandlePool::getInstance().prewarm(REST_API_URL, 1);
 }
 
 BybitPriceCollector::~BybitPriceCollector() {
     stopRealtimeStream();
-
-    if (m_curl) {
-        curl_easy_cleanup(m_curl);
-    }
-
-    curl_global_cleanup();
 }
 
 void BybitPriceCollector::setSymbol(const std::string& symbol, BybitCategory category) {
@@ -202,6 +199,12 @@ bool BybitPriceCollector::loadHistoricalData(size_t limit) {
             m_candles = allCandles;
         }
 
+        {
+            // The newest kline is the one still forming.
+            std::lock_guard<std::mutex> lock(m_streamMutex);
+            m_lastConfirmedTime = allCandles.size() >= 2 ? allCandles[allCandles.size() - 2].timestamp : 0;
+        }
+
         if (m_dataManager) {
             addCandlesToDataManager(allCandles);
         }
@@ -240,6 +243,12 @@ bool BybitPriceCollector::startRealtimeStream() {
 
     updateStatus("Starting real-time stream...");
 
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_backfilling = false;
+        m_deferred.clear();
+    }
+
     //    WebSocketManager
     bool success = BybitWebSocketManager::getInstance().subscribe(
         m_symbol,
@@ -324,6 +333,45 @@ void BybitPriceCollector::onCandleReceived(const CandleData& candleData) {
     candle.turnover = candleData.turnover;
     candle.confirmed = candleData.confirmed;
 
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+
+        // The next message belongs to the candle right after the last confirmed one; anything
+        // later means the stream dropped candles (reconnect, stalled socket, late subscribe).
+        if (!m_backfilling && m_lastConfirmedTime > 0 &&
+            candle.timestamp > m_lastConfirmedTime + intervalToMs(m_interval)) {
+            int64_t now = steadyNowMs();
+            if (now - m_lastBackfillMs >= BACKFILL_RETRY_SEC * 1000 &&
+                BybitWebSocketManager::getInstance().requestBackfill(this)) {
+                std::cout << "[PriceCollector] " << m_symbol << " stream skipped from "
+                    << m_lastConfirmedTime << " to " << candle.timestamp << ", backfilling" << std::endl;
+                m_lastBackfillMs = now;
+                m_backfilling = true;
+            }
+        }
+
+        if (m_backfilling) {
+            m_deferred.push_back(candle);
+            return;
+        }
+    }
+
+    deliverCandle(candle);
+}
+
+void BybitPriceCollector::deliverCandle(const BybitCandle& candle) {
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+
+        // Already closed, either by the stream or by a backfill that replayed it.
+        if (m_lastConfirmedTime > 0 && candle.timestamp <= m_lastConfirmedTime) {
+            return;
+        }
+        if (candle.confirmed) {
+            m_lastConfirmedTime = candle.timestamp;
+        }
+    }
+
     if (candle.confirmed) {
         //   -  
         addCandle(candle);
@@ -350,6 +398,80 @@ void BybitPriceCollector::onCandleReceived(const CandleData& candleData) {
     }
 }
 
+void BybitPriceCollector::runBackfill() {
+    uint64_t lastConfirmed;
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        lastConfirmed = m_lastConfirmedTime;
+    }
+
+    std::vector<BybitCandle> missing = fetchMissingCandles(lastConfirmed);
+    std::cout << "[PriceCollector] Backfilled " << missing.size() << " candles of " << m_symbol << std::endl;
+
+    for (const auto& candle : missing) {
+        deliverCandle(candle);
+    }
+
+    // Messages keep arriving while deferred ones are replayed; stop once none are left.
+    while (true) {
+        std::vector<BybitCandle> deferred;
+        {
+            std::lock_guard<std::mutex> lock(m_streamMutex);
+            if (m_deferred.empty()) {
+                m_backfilling = false;
+                break;
+            }
+            deferred.swap(m_deferred);
+        }
+
+        for (const auto& candle : deferred) {
+            deliverCandle(candle);
+        }
+    }
+}
+
+std::vector<BybitCandle> BybitPriceCollector::fetchMissingCandles(uint64_t lastConfirmed) {
+    std::vector<BybitCandle> missing;
+    if (lastConfirmed == 0) {
+        return missing;
+    }
+
+    // Bybit returns the newest candles of the range first, so page backwards from now.
+    uint64_t endTime = 0;
+    for (size_t request = 0; request < MAX_BACKFILL_REQUESTS; ++request) {
+        std::vector<BybitCandle> chunk = fetchKlines(m_symbol, m_category, m_interval,
+            lastConfirmed + 1, endTime, 1000);
+        if (chunk.empty()) {
+            break;
+        }
+
+        missing.insert(missing.end(), chunk.begin(), chunk.end());
+        if (chunk.size() < 1000) {
+            break;
+        }
+
+        uint64_t oldestTimestamp = chunk[0].timestamp;
+        for (const auto& candle : chunk) {
+            oldestTimestamp = std::min(oldestTimestamp, candle.timestamp);
+        }
+        endTime = oldestTimestamp - 1;
+    }
+
+    std::sort(missing.begin(), missing.end(), [](const BybitCandle& a, const BybitCandle& b) {
+        return a.timestamp < b.timestamp;
+        });
+    missing.erase(std::unique(missing.begin(), missing.end(),
+        [](const BybitCandle& a, const BybitCandle& b) {
+            return a.timestamp == b.timestamp;
+        }), missing.end());
+
+    // The newest kline is still forming; the stream keeps updating it.
+    if (!missing.empty()) {
+        missing.pop_back();
+    }
+    return missing;
+}
+
 // === REST API  ===
 
 std::vector<BybitCandle> BybitPriceCollector::fetchKlines(
@@ -405,19 +527,20 @@ json BybitPriceCollector::getInstrumentInfo(const std::string& symbol, BybitCate
 }
 
 json BybitPriceCollector::makeHttpRequest(const std::string& endpoint, const std::string& params) {
-    if (!m_curl) {
+    Bybit::PooledCurlHandle handle = Bybit::CurlHandlePool::getInstance().acquire();
+    if (!handle) {
         throw std::runtime_error("CURL not initialized");
     }
 
     std::string url = std::string(REST_API_URL) + endpoint + params;
     std::string responseBuffer;
 
-    curl_easy_setopt(m_curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, &responseBuffer);
-    curl_easy_setopt(m_curl, CURLOPT_TIMEOUT, 10L);
+    curl_easy_setopt(handle.get(), CURLOPT_URL, url.c_str());
+    curl_easy_setopt(handle.get(), CURLOPT_WRITEFUNCTION, WriteCallback);
+    curl_easy_setopt(handle.get(), CURLOPT_WRITEDATA, &responseBuffer);
+    curl_easy_setopt(handle.get(), CURLOPT_TIMEOUT, 10L);
 
-    CURLcode res = curl_easy_perform(m_curl);
+    CURLcode res = curl_easy_perform(handle.get());
 
     if (res != CURLE_OK) {
         throw std::runtime_error("CURL request failed: " + std::string(curl_easy_strerror(res)));
@@ -503,6 +626,26 @@ std::string BybitPriceCollector::intervalToString(BybitInterval interval) const
     }
 }
 
+uint64_t BybitPriceCollector::intervalToMs(BybitInterval interval) const {
+    const uint64_t minute = 60 * 1000;
+    switch (interval) {
+    case BybitInterval::MIN_1: return minute;
+    case BybitInterval::MIN_3: return 3 * minute;
+    case BybitInterval::MIN_5: return 5 * minute;
+    case BybitInterval::MIN_15: return 15 * minute;
+    case BybitInterval::MIN_30: return 30 * minute;
+    case BybitInterval::HOUR_1: return 60 * minute;
+    case BybitInterval::HOUR_2: return 120 * minute;
+    case BybitInterval::HOUR_4: return 240 * minute;
+    case BybitInterval::HOUR_6: return 360 * minute;
+    case BybitInterval::HOUR_12: return 720 * minute;
+    case BybitInterval::DAY_1: return 1440 * minute;
+    case BybitInterval::WEEK_1: return 7 * 1440 * minute;
+    case BybitInterval::MONTH_1: return 31 * 1440 * minute;
+    default: return minute;
+    }
+}
+
 void BybitPriceCollector::updateStatus(const std::string& status) {
     if (m_onStatus) {
         m_onStatus(status);
@@ -0,0 +1,231 @@
+#include "../../../Public/Exchanges/Bybit/BybitTradeAggregator.h"
+#include "../../../Public/Exchanges/Bybit/Bybitwebsocketmanager.h"
+#include <iostream>
+#include <algorithm>
+
+BybitTradeAggregator::BybitTradeAggregator()
+    : m_symbol("")
+    , m_category(BybitCategory::SPOT)
+    , m_hasBar(false)
+    , m_barTrades(0)
+    , m_barCount(0)
+    , m_isStreaming(false)
+{
+}
+
+BybitTradeAggregator::~BybitTradeAggregator() {
+    stopRealtimeStream();
+}
+
+void BybitTradeAggregator::setSymbol(const std::string& symbol, BybitCategory category) {
+    bool wasStreaming = m_isStreaming.load();
+
+    if (wasStreaming) {
+        stopRealtimeStream();
+    }
+
+    m_symbol = symbol;
+    m_category = category;
+
+    if (wasStreaming) {
+        startRealtimeStream();
+    }
+}
+
+void BybitTradeAggregator::setBarSpec(const TradeBarSpec& spec) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_spec = spec;
+    if (m_spec.size <= 0.0) {
+        m_spec.size = 1.0;
+    }
+
+    // Bars built so far follow the old rule; start over with the next trade.
+    m_hasBar = false;
+    m_barTrades = 0;
+}
+
+TradeBarSpec BybitTradeAggregator::getBarSpec() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_spec;
+}
+
+bool BybitTradeAggregator::startRealtimeStream() {
+    if (m_isStreaming.load()) {
+        updateStatus("Already streaming");
+        return false;
+    }
+
+    if (m_symbol.empty()) {
+        updateStatus("Error: Symbol not set");
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hasBar = false;
+        m_barTrades = 0;
+        m_barCount = 0;
+    }
+
+    bool success = BybitWebSocketManager::getInstance().subscribeTrades(
+        m_symbol,
+        categoryToString(m_category),
+        this
+    );
+
+    if (!success) {
+        updateStatus("Error: Failed to subscribe to trades");
+        return false;
+    }
+
+    m_isStreaming = true;
+    updateStatus("Trade stream started for " + m_symbol);
+
+    return true;
+}
+
+void BybitTradeAggregator::stopRealtimeStream() {
+    if (!m_isStreaming.load()) {
+        return;
+    }
+
+    BybitWebSocketManager::getInstance().unsubscribeTrades(this);
+
+    m_isStreaming = false;
+    updateStatus("Trade stream stopped");
+}
+
+BybitCandle BybitTradeAggregator::getLastCandle() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hasBar ? m_bar : m_lastClosed;
+}
+
+double BybitTradeAggregator::getCurrentPrice() const {
+    return getLastCandle().close;
+}
+
+size_t BybitTradeAggregator::getBarCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<size_t>(m_barCount);
+}
+
+void BybitTradeAggregator::setOnNewCandleCallback(std::function<void(const BybitCandle&)> callback) {
+    m_onNewCandle = callback;
+}
+
+void BybitTradeAggregator::setOnCandleUpdateCallback(std::function<void(const BybitCandle&)> callback) {
+    m_onCandleUpdate = callback;
+}
+
+void BybitTradeAggregator::setOnStatusCallback(std::function<void(const std::string&)> callback) {
+    m_onStatus = callback;
+}
+
+// Called from WebSocketManager with every trade of one stream message.
+void BybitTradeAggregator::onTradesReceived(const std::vector<TradeData>& trades) {
+    std::vector<Event> events;
+    bool updated = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (const TradeData& trade : trades) {
+            if (m_spec.type == TradeBarType::TIME) {
+                uint64_t period = std::max<uint64_t>(1, static_cast<uint64_t>(m_spec.size * 1000.0));
+                uint64_t start = trade.timestamp / period * period;
+
+                if (m_hasBar && start > m_bar.timestamp) {
+                    closeBar(events);
+                }
+                if (!m_hasBar) {
+                    openBar(trade, start, events);
+                }
+            }
+            else if (!m_hasBar) {
+                openBar(trade, trade.timestamp, events);
+            }
+
+            m_bar.high = std::max(m_bar.high, trade.price);
+            m_bar.low = std::min(m_bar.low, trade.price);
+            m_bar.close = trade.price;
+            m_bar.volume += trade.size;
+            m_bar.turnover += trade.price * trade.size;
+            m_barTrades++;
+            updated = true;
+
+            if (m_spec.type != TradeBarType::TIME && isBarComplete()) {
+                closeBar(events);
+                updated = false;
+            }
+        }
+
+        // One update per message for the bar still forming.
+        if (m_hasBar && updated) {
+            events.push_back({ m_bar, false });
+        }
+    }
+
+    for (const Event& event : events) {
+        if (event.isNew) {
+            if (m_onNewCandle) m_onNewCandle(event.candle);
+        }
+        else if (m_onCandleUpdate) {
+            m_onCandleUpdate(event.candle);
+        }
+    }
+}
+
+void BybitTradeAggregator::openBar(const TradeData& trade, uint64_t start, std::vector<Event>& events) {
+    m_bar = BybitCandle();
+    m_bar.index = m_barCount;
+    m_bar.timestamp = start;
+    m_bar.open = trade.price;
+    m_bar.high = trade.price;
+    m_bar.low = trade.price;
+    m_bar.close = trade.price;
+    m_hasBar = true;
+    m_barTrades = 0;
+
+    if (m_barCount == 0) {
+        events.push_back({ m_bar, true });
+    }
+}
+
+void BybitTradeAggregator::closeBar(std::vector<Event>& events) {
+    m_bar.confirmed = true;
+
+    // The update puts the final values into the forming candle, the new candle then
+    // appends the slot the next bar updates.
+    events.push_back({ m_bar, false });
+    events.push_back({ m_bar, true });
+
+    m_lastClosed = m_bar;
+    m_hasBar = false;
+    m_barTrades = 0;
+    m_barCount++;
+}
+
+bool BybitTradeAggregator::isBarComplete() const {
+    switch (m_spec.type) {
+    case TradeBarType::TICK: return static_cast<double>(m_barTrades) >= m_spec.size;
+    case TradeBarType::VOLUME: return m_bar.volume >= m_spec.size;
+    case TradeBarType::DOLLAR: return m_bar.turnover >= m_spec.size;
+    default: return false;
+    }
+}
+
+std::string BybitTradeAggregator::categoryToString(BybitCategory category) const {
+    switch (category) {
+    case BybitCategory::SPOT: return "spot";
+    case BybitCategory::LINEAR: return "linear";
+    case BybitCategory::INVERSE: return "inverse";
+    case BybitCategory::OPTION: return "option";
+    default: return "spot";
+    }
+}
+
+void BybitTradeAggregator::updateStatus(const std::string& status) {
+    if (m_onStatus) {
+        m_onStatus(status);
+    }
+}
@@ -1,41 +1,36 @@
 #include "../../../Public/Exchanges/Bybit/Bybitwebsocketclient.h"
 #include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <openssl/hmac.h>
+
+static int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
 BybitWebSocketClient::BybitWebSocketClient()
     : m_isConnected(false)
-    , m_shouldStop(false) {
+    , m_shouldStop(false)
+    , m_lastMessageMs(0) {
 
     //  
     m_client.clear_access_channels(websocketpp::log::alevel::all);
     m_client.clear_error_channels(websocketpp::log::elevel::all);
 
-    m_client.init_asio();
-    m_client.start_perpetual();
-
-    //  callback'
-    m_client.set_open_handler([this](websocketpp::connection_hdl hdl) {
-        onOpen(hdl);
-        });
-
-    m_client.set_close_handler([this](websocketpp::connection_hdl hdl) {
-        onClose(hdl);
-        });
-
-    m_client.set_fail_handler([this](websocketpp::connection_hdl hdl) {
-        onFail(hdl);
-        });
-
-    m_client.set_message_handler([this](websocketpp::connection_hdl hdl, WebSocketClient::message_ptr msg) {
-        onMessage(hdl, msg);
-        });
+    m_client.init_asio(&WebSocketIoService::getInstance().getIoService());
 
-    m_client.set_tls_init_handler([this](websocketpp::connection_hdl hdl) {
-        return onTlsInit(hdl);
+    m_client.set_tls_init_handler([](websocketpp::connection_hdl) {
+        return WebSocketIoService::getInstance().getTlsContext();
         });
 }
 
 BybitWebSocketClient::~BybitWebSocketClient() {
-    disconnect();
+    // The owner already disconnected; a timed out close must not be waited for twice.
+    if (!m_shouldStop.load()) {
+        disconnect();
+    }
 }
 
 bool BybitWebSocketClient::connect(const std::string& url) {
@@ -44,6 +39,14 @@ bool BybitWebSocketClient::connect(const std::string& url) {
         return false;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        if (m_active) {
+            std::cerr << "Connection already in progress" << std::endl;
+            return false;
+        }
+    }
+
     m_currentUrl = url;
     m_shouldStop = false;
 
@@ -58,12 +61,27 @@ bool BybitWebSocketClient::connect(const std::string& url) {
             return false;
         }
 
+        //  callback'
+        std::weak_ptr<BybitWebSocketClient> self = weak_from_this();
+        uint64_t generation = ++m_generation;
+
+        con->set_open_handler([self, generation](websocketpp::connection_hdl hdl) {
+            if (auto client = self.lock()) client->onOpen(hdl, generation);
+            });
+        con->set_close_handler([self, generation](websocketpp::connection_hdl hdl) {
+            if (auto client = self.lock()) client->onClose(hdl, generation);
+            });
+        con->set_fail_handler([self, generation](websocketpp::connection_hdl hdl) {
+            if (auto client = self.lock()) client->onFail(hdl, generation);
+            });
+        con->set_message_handler([self, generation](websocketpp::connection_hdl hdl, WebSocketClient::message_ptr msg) {
+            if (auto client = self.lock()) client->onMessage(hdl, msg, generation);
+            });
+
         m_hdl = con->get_handle();
+        setState(true);
         m_client.connect(con);
 
-        //    
-        m_thread = std::thread(&BybitWebSocketClient::runEventLoop, this);
-
         return true;
 
     }
@@ -78,7 +96,19 @@ bool BybitWebSocketClient::connect(const std::string& url) {
 void BybitWebSocketClient::disconnect() {
     m_shouldStop = true;
 
-    if (m_isConnected.load()) {
+    std::unique_lock<std::mutex> state(m_stateMutex);
+    if (!m_active) {
+        m_isConnected = false;
+        return;
+    }
+
+    // A handshake in flight finishes (open or fail) before it can be closed.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(CLOSE_TIMEOUT_SEC);
+    m_stateCv.wait_until(state, deadline, [this]() {
+        return !m_active || m_isConnected.load();
+        });
+
+    if (m_active && m_isConnected.load()) {
         try {
             websocketpp::lib::error_code ec;
             m_client.close(m_hdl, websocketpp::close::status::normal, "Closing connection", ec);
@@ -92,15 +122,35 @@ void BybitWebSocketClient::disconnect() {
         }
     }
 
-    m_client.stop_perpetual();
+    if (!m_stateCv.wait_until(state, deadline, [this]() { return !m_active; })) {
+        std::cerr << "WebSocket close timed out: " << m_currentUrl << std::endl;
+    }
+    state.unlock();
 
-    if (m_thread.joinable()) {
-        m_thread.join();
+    // Retire the connection: a handler running now finishes first, later ones return at once.
+    {
+        std::lock_guard<std::mutex> callbacks(m_callbackMutex);
+        ++m_generation;
     }
+    setState(false);
 
     m_isConnected = false;
 }
 
+void BybitWebSocketClient::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isConnected.load()) {
+        return;
+    }
+
+    websocketpp::lib::error_code ec;
+    m_client.close(m_hdl, websocketpp::close::status::going_away, "Closing connection", ec);
+
+    if (ec) {
+        std::cerr << "Error closing connection: " << ec.message() << std::endl;
+    }
+}
+
 bool BybitWebSocketClient::subscribeToKline(const std::string& symbol, const std::string& interval) {
     if (!m_isConnected.load()) {
         if (m_onError) {
@@ -150,6 +200,90 @@ bool BybitWebSocketClient::unsubscribe(const std::string& topic) {
     }
 }
 
+bool BybitWebSocketClient::authenticate(const std::string& apiKey, const std::string& apiSecret) {
+    if (!m_isConnected.load()) {
+        return false;
+    }
+
+    uint64_t expires = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count() + 10000;
+    std::string toSign = "GET/realtime" + std::to_string(expires);
+
+    unsigned char* digest = HMAC(EVP_sha256(),
+        apiSecret.c_str(),
+        (int)apiSecret.length(),
+        (unsigned char*)toSign.c_str(),
+        toSign.length(),
+        nullptr,
+        nullptr);
+
+    std::ostringstream oss;
+    for (int i = 0; i < SHA256_DIGEST_LENGTH; i++) {
+        oss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+    }
+
+    try {
+        json authMsg = {
+            {"op", "auth"},
+            {"args", {apiKey, expires, oss.str()}}
+        };
+
+        return sendMessage(authMsg.dump());
+    }
+    catch (const std::exception& e) {
+        if (m_onError) {
+            m_onError(std::string("Auth error: ") + e.what());
+        }
+        return false;
+    }
+}
+
+bool BybitWebSocketClient::subscribeTopics(const std::vector<std::string>& topics) {
+    if (!m_isConnected.load() || topics.empty()) {
+        return false;
+    }
+
+    try {
+        json subscribeMsg = {
+            {"op", "subscribe"},
+            {"args", topics}
+        };
+
+        return sendMessage(subscribeMsg.dump());
+    }
+    catch (const std::exception& e) {
+        if (m_onError) {
+            m_onError(std::string("Subscribe error: ") + e.what());
+        }
+        return false;
+    }
+}
+
+bool BybitWebSocketClient::unsubscribeTopics(const std::vector<std::string>& topics) {
+    if (!m_isConnected.load() || topics.empty()) {
+        return false;
+    }
+
+    try {
+        json unsubscribeMsg = {
+            {"op", "unsubscribe"},
+            {"args", topics}
+        };
+
+        return sendMessage(unsubscribeMsg.dump());
+    }
+    catch (const std::exception& e) {
+        if (m_onError) {
+            m_onError(std::string("Unsubscribe error: ") + e.what());
+        }
+        return false;
+    }
+}
+
+bool BybitWebSocketClient::ping() {
+    return sendMessage("{\"op\":\"ping\"}");
+}
+
 void BybitWebSocketClient::setOnMessageCallback(std::function<void(const std::string&)> callback) {
     m_onMessage = callback;
 }
@@ -166,20 +300,30 @@ void BybitWebSocketClient::setOnDisconnectedCallback(std::function<void()> callb
     m_onDisconnected = callback;
 }
 
-void BybitWebSocketClient::onOpen(websocketpp::connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_isConnected = true;
-    m_hdl = hdl;
+void BybitWebSocketClient::onOpen(websocketpp::connection_hdl hdl, uint64_t generation) {
+    std::lock_guard<std::mutex> callbacks(m_callbackMutex);
+    if (generation != m_generation.load()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isConnected = true;
+        m_hdl = hdl;
+        m_lastMessageMs = steadyNowMs();
+    }
 
     std::cout << "WebSocket connected!" << std::endl;
 
     if (m_onConnected) {
         m_onConnected();
     }
+
+    // Wakes a disconnect() that waited for the handshake to finish.
+    setState(true);
 }
 
-void BybitWebSocketClient::onClose(websocketpp::connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(m_mutex);
+void BybitWebSocketClient::onClose(websocketpp::connection_hdl hdl, uint64_t generation) {
+    std::lock_guard<std::mutex> callbacks(m_callbackMutex);
+    if (generation != m_generation.load()) return;
     m_isConnected = false;
 
     std::cout << "WebSocket disconnected" << std::endl;
@@ -187,10 +331,13 @@ void BybitWebSocketClient::onClose(websocketpp::connection_hdl hdl) {
     if (m_onDisconnected) {
         m_onDisconnected();
     }
+
+    setState(false);
 }
 
-void BybitWebSocketClient::onFail(websocketpp::connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(m_mutex);
+void BybitWebSocketClient::onFail(websocketpp::connection_hdl hdl, uint64_t generation) {
+    std::lock_guard<std::mutex> callbacks(m_callbackMutex);
+    if (generation != m_generation.load()) return;
     m_isConnected = false;
 
     std::cout << "WebSocket connection failed" << std::endl;
@@ -202,17 +349,24 @@ void BybitWebSocketClient::onFail(websocketpp::connection_hdl hdl) {
     if (m_onDisconnected) {
         m_onDisconnected();
     }
+
+    setState(false);
 }
 
-void BybitWebSocketClient::onMessage(websocketpp::connection_hdl hdl, WebSocketClient::message_ptr msg) {
+void BybitWebSocketClient::onMessage(websocketpp::connection_hdl hdl, WebSocketClient::message_ptr msg, uint64_t generation) {
+    std::lock_guard<std::mutex> callbacks(m_callbackMutex);
+    if (generation != m_generation.load()) return;
+
     const std::string& payload = msg->get_payload();
+    m_lastMessageMs = steadyNowMs();
 
     try {
-        //  JSON    
-        json data = json::parse(payload);
+        // Stream data never carries "op"; only service replies are parsed here, the topic
+        // handlers parse the rest once.
+        if (payload.find("\"op\"") != std::string::npos) {
+            //  JSON    
+            json data = json::parse(payload);
 
-        // ,      (ping/pong, subscribe confirmation)
-        if (data.contains("op")) {
             std::string op = data["op"];
 
             if (op == "subscribe") {
@@ -238,27 +392,6 @@ void BybitWebSocketClient::onMessage(websocketpp::connection_hdl hdl, WebSocketC
     }
 }
 
-ContextPtr BybitWebSocketClient::onTlsInit(websocketpp::connection_hdl hdl) {
-    ContextPtr ctx = websocketpp::lib::make_shared<boost::asio::ssl::context>(
-        boost::asio::ssl::context::tlsv12_client
-    );
-
-    try {
-        ctx->set_options(
-            boost::asio::ssl::context::default_workarounds |
-            boost::asio::ssl::context::no_sslv2 |
-            boost::asio::ssl::context::no_sslv3 |
-            boost::asio::ssl::context::single_dh_use
-        );
-
-    }
-    catch (const std::exception& e) {
-        std::cerr << "TLS init error: " << e.what() << std::endl;
-    }
-
-    return ctx;
-}
-
 bool BybitWebSocketClient::sendMessage(const std::string& message) {
     if (!m_isConnected.load()) {
         return false;
@@ -288,14 +421,10 @@ bool BybitWebSocketClient::sendMessage(const std::string& message) {
     }
 }
 
-void BybitWebSocketClient::runEventLoop() {
-    try {
-        m_client.run();
-    }
-    catch (const std::exception& e) {
-        std::cerr << "WebSocket event loop error: " << e.what() << std::endl;
-        if (m_onError) {
-            m_onError(std::string("Event loop error: ") + e.what());
-        }
+void BybitWebSocketClient::setState(bool active) {
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_active = active;
     }
+    m_stateCv.notify_all();
 }
\ No newline at end of file
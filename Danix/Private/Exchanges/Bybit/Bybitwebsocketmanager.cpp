@@ -1,8 +1,22 @@
 #include "../../../Public/Exchanges/Bybit/Bybitwebsocketmanager.h"
 #include "../../../Public/Exchanges/Bybit/BybitPriceCollector.h"
+#include "../../../Public/Exchanges/Bybit/BybitTradeAggregator.h"
+#include "../../../Public/Exchanges/Bybit/BybitAccountState.h"
+#include "../../../Public/Exchanges/Bybit/BybitMargin.h"
 #include <iostream>
 #include <algorithm>
 
+static int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void closeConnections(const std::vector<std::shared_ptr<WebSocketConnection>>& connections) {
+    for (const auto& conn : connections) {
+        conn->close();
+    }
+}
+
 // ============================================================================
 // WebSocketConnection Implementation
 // ============================================================================
@@ -11,8 +25,9 @@ WebSocketConnection::WebSocketConnection(const std::string& url, const std::stri
     : m_url(url)
     , m_category(category)
     , m_isFullyConnected(false)
+    , m_closing(false)
 {
-    m_client = std::make_unique<BybitWebSocketClient>();
+    m_client = std::make_shared<BybitWebSocketClient>();
 
     //  callbacks
     m_client->setOnMessageCallback([this](const std::string& msg) {
@@ -30,45 +45,42 @@ WebSocketConnection::WebSocketConnection(const std::string& url, const std::stri
     m_client->setOnDisconnectedCallback([this]() {
         onDisconnected();
         });
+}
 
-    // 
-    if (!m_client->connect(url)) {
-        std::cerr << "Failed to connect WebSocket: " << url << std::endl;
-        return;
-    }
-
-    // :    ( 5 )
-    for (int i = 0; i < 50; ++i) {
-        if (m_isFullyConnected.load()) {
-            std::cout << "[WebSocketConnection] Successfully connected after "
-                << (i * 100) << "ms" << std::endl;
-            break;
-        }
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-
-    if (!m_isFullyConnected.load()) {
-        std::cerr << "[WebSocketConnection] Warning: Connection timeout, may not be ready" << std::endl;
+bool WebSocketConnection::connect() {
+    if (!m_client->connect(m_url)) {
+        std::cerr << "Failed to connect WebSocket: " << m_url << std::endl;
+        return false;
     }
+    return true;
 }
 
 WebSocketConnection::~WebSocketConnection() {
-    std::cout << "[WebSocketConnection] Destroying connection to " << m_url << std::endl;
+    close();
+}
 
-    //    
-    if (!m_subscriptions.empty()) {
-        std::cout << "[WebSocketConnection] Unsubscribing from "
-            << m_subscriptions.size() << " channels..." << std::endl;
+void WebSocketConnection::close() {
+    {
+        std::lock_guard<std::mutex> maintainLock(m_maintainMutex);
+        if (m_closing.exchange(true)) {
+            return;
+        }
+    }
+    std::cout << "[WebSocketConnection] Destroying connection to " << m_url << std::endl;
 
+    std::vector<std::string> topics;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
         for (const auto& sub : m_subscriptions) {
-            std::string topic = "kline." + sub.interval + "." + sub.symbol;
-            if (m_client) {
-                m_client->unsubscribe(topic);
-            }
+            topics.push_back(sub.getTopic());
         }
+    }
 
-        //     unsubscribe
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    //    
+    if (!topics.empty() && m_isFullyConnected.load()) {
+        std::cout << "[WebSocketConnection] Unsubscribing from "
+            << topics.size() << " channels..." << std::endl;
+        sendInBatches(topics, false);
     }
 
     //  
@@ -82,26 +94,25 @@ WebSocketConnection::~WebSocketConnection() {
 bool WebSocketConnection::addSubscription(const Subscription& sub) {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    // ,   
-    if (!m_isFullyConnected.load()) {
-        std::cerr << "[WebSocketConnection] Cannot subscribe - not connected yet" << std::endl;
-        return false;
-    }
-
     // ,    
     if (m_subscriptions.find(sub) != m_subscriptions.end()) {
         return true; //  
     }
 
-    //   WebSocket
-    if (!m_client->subscribeToKline(sub.symbol, sub.interval)) {
-        std::cerr << "Failed to subscribe to " << sub.getKey() << std::endl;
-        return false;
-    }
-
     m_subscriptions.insert(sub);
 
-    std::cout << "[WebSocketConnection] Subscribed to " << sub.getKey()
+    std::string topic = sub.getTopic();
+    auto it = std::find(m_pendingUnsubscribe.begin(), m_pendingUnsubscribe.end(), topic);
+    if (it != m_pendingUnsubscribe.end()) {
+        // The unsubscribe was never sent, so the server still streams this topic.
+        m_pendingUnsubscribe.erase(it);
+    }
+    else {
+        m_pendingSubscribe.push_back(topic);
+        scheduleFlush();
+    }
+
+    std::cout << "[WebSocketConnection] Queued " << sub.getKey()
         << " (total: " << m_subscriptions.size() << ")" << std::endl;
 
     return true;
@@ -115,12 +126,18 @@ bool WebSocketConnection::removeSubscription(const Subscription& sub) {
         return false; //   
     }
 
-    //   WebSocket
-    std::string topic = "kline." + sub.interval + "." + sub.symbol;
-    m_client->unsubscribe(topic);
-
     m_subscriptions.erase(it);
 
+    std::string topic = sub.getTopic();
+    auto pending = std::find(m_pendingSubscribe.begin(), m_pendingSubscribe.end(), topic);
+    if (pending != m_pendingSubscribe.end()) {
+        m_pendingSubscribe.erase(pending);
+    }
+    else {
+        m_pendingUnsubscribe.push_back(topic);
+        scheduleFlush();
+    }
+
     std::cout << "[WebSocketConnection] Unsubscribed from " << sub.getKey()
         << " (remaining: " << m_subscriptions.size() << ")" << std::endl;
 
@@ -140,6 +157,14 @@ void WebSocketConnection::setOnCandleCallback(std::function<void(const CandleDat
     m_onCandle = callback;
 }
 
+void WebSocketConnection::setOnTradesCallback(std::function<void(const std::vector<TradeData>&)> callback) {
+    m_onTrades = callback;
+}
+
+void WebSocketConnection::setOnOrderBookCallback(std::function<bool(const OrderBookUpdate&)> callback) {
+    m_onOrderBook = callback;
+}
+
 void WebSocketConnection::onMessage(const std::string& message) {
     try {
         json data = json::parse(message);
@@ -150,6 +175,23 @@ void WebSocketConnection::onMessage(const std::string& message) {
 
         std::string topic = data["topic"];
 
+        if (topic.compare(0, 10, "orderbook.") == 0) {
+            OrderBookUpdate update;
+            if (m_onOrderBook && parseOrderBookFromJson(data, update) && !m_onOrderBook(update)) {
+                std::cerr << "[WebSocketConnection] Order book " << topic << " out of sync, resubscribing" << std::endl;
+                resync(topic);
+            }
+            return;
+        }
+
+        if (topic.compare(0, 12, "publicTrade.") == 0) {
+            std::vector<TradeData> trades = parseTradesFromJson(data["data"]);
+            if (!trades.empty() && m_onTrades) {
+                m_onTrades(trades);
+            }
+            return;
+        }
+
         // ,   kline
         if (topic.find("kline") == std::string::npos) {
             return;
@@ -180,13 +222,154 @@ void WebSocketConnection::onConnected() {
 
     std::cout << "[WebSocketConnection] Connected to " << m_url << std::endl;
 
+    m_reconnectPending = false;
+    m_reconnectAttempts = 0;
+    m_lastPingMs = steadyNowMs();
+
+    // A fresh socket has no topics on the server side: send every subscription at once.
+    m_pendingSubscribe.clear();
+    m_pendingUnsubscribe.clear();
+    for (const auto& sub : m_subscriptions) {
+        m_pendingSubscribe.push_back(sub.getTopic());
+    }
+    scheduleFlush();
+
     if (m_onConnected) {
         m_onConnected();
     }
 }
 
 void WebSocketConnection::onDisconnected() {
+    m_isFullyConnected = false;
     std::cout << "[WebSocketConnection] Disconnected from " << m_url << std::endl;
+
+    if (m_closing.load()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    scheduleReconnect();
+}
+
+void WebSocketConnection::scheduleReconnect() {
+    int shift = std::min(m_reconnectAttempts, 6);
+    int64_t delay = std::min(RECONNECT_BASE_MS << shift, RECONNECT_MAX_MS);
+    m_reconnectAttempts++;
+    m_nextReconnectMs = steadyNowMs() + delay;
+    m_reconnectPending = true;
+
+    std::cout << "[WebSocketConnection] Reconnecting to " << m_url << " in " << delay
+        << " ms (attempt " << m_reconnectAttempts << ")" << std::endl;
+}
+
+void WebSocketConnection::maintain() {
+    enum class Action { None, Ping, Close, Reconnect };
+    Action action = Action::None;
+    int64_t now = steadyNowMs();
+
+    // close() waits for this, so no reconnect starts once the connection is closing.
+    std::lock_guard<std::mutex> maintainLock(m_maintainMutex);
+    if (m_closing.load()) {
+        return;
+    }
+
+    // The client lock is taken after m_mutex is released: the socket handlers hold it
+    // while they call back into this connection.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_reconnectPending) {
+            if (now >= m_nextReconnectMs) {
+                m_reconnectPending = false;
+                action = Action::Reconnect;
+            }
+        }
+        else if (m_isFullyConnected.load()) {
+            if (now - m_client->getLastMessageTime() > STALE_TIMEOUT_SEC * 1000) {
+                action = Action::Close;
+            }
+            else if (now - m_lastPingMs >= PING_INTERVAL_SEC * 1000) {
+                m_lastPingMs = now;
+                action = Action::Ping;
+            }
+        }
+    }
+
+    switch (action) {
+    case Action::Ping:
+        m_client->ping();
+        break;
+    case Action::Close:
+        std::cerr << "[WebSocketConnection] No data from " << m_url << " for "
+            << STALE_TIMEOUT_SEC << "s, closing" << std::endl;
+        m_client->close();
+        break;
+    case Action::Reconnect:
+        if (!m_client->connect(m_url)) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            scheduleReconnect();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void WebSocketConnection::scheduleFlush() {
+    if (!m_isFullyConnected.load() || m_flushScheduled) {
+        return;
+    }
+    if (m_pendingSubscribe.empty() && m_pendingUnsubscribe.empty()) {
+        return;
+    }
+
+    // Runs after the caller returns, so subscriptions added meanwhile share the same ops.
+    // The socket's own handlers may hold the client lock here, so nothing is sent inline.
+    // A connection released before the flush runs is simply not flushed.
+    m_flushScheduled = true;
+    std::weak_ptr<WebSocketConnection> self = weak_from_this();
+    WebSocketIoService::getInstance().getIoService().post([self]() {
+        if (auto conn = self.lock()) {
+            conn->flushPending();
+        }
+        });
+}
+
+void WebSocketConnection::flushPending() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_isFullyConnected.load() && !m_closing.load() && (!m_pendingSubscribe.empty() || !m_pendingUnsubscribe.empty())) {
+        std::vector<std::string> subscribe;
+        std::vector<std::string> unsubscribe;
+        subscribe.swap(m_pendingSubscribe);
+        unsubscribe.swap(m_pendingUnsubscribe);
+
+        // Sending takes the client lock, which onOpen holds while it calls onConnected.
+        lock.unlock();
+        sendInBatches(unsubscribe, false);
+        sendInBatches(subscribe, true);
+        lock.lock();
+    }
+    m_flushScheduled = false;
+}
+
+void WebSocketConnection::sendInBatches(const std::vector<std::string>& topics, bool subscribe) {
+    for (size_t i = 0; i < topics.size(); i += MAX_TOPICS_PER_REQUEST) {
+        size_t end = std::min(topics.size(), i + MAX_TOPICS_PER_REQUEST);
+        std::vector<std::string> batch(topics.begin() + i, topics.begin() + end);
+
+        bool sent = subscribe ? m_client->subscribeTopics(batch) : m_client->unsubscribeTopics(batch);
+        if (!sent) {
+            // Whatever is left is sent again in full when the socket reopens.
+            std::cerr << "[WebSocketConnection] Failed to send " << (subscribe ? "subscribe" : "unsubscribe")
+                << " for " << batch.size() << " topics" << std::endl;
+            return;
+        }
+    }
+
+    if (!topics.empty()) {
+        std::cout << "[WebSocketConnection] " << (subscribe ? "Subscribed to " : "Unsubscribed from ")
+            << topics.size() << " topics in " << (topics.size() + MAX_TOPICS_PER_REQUEST - 1) / MAX_TOPICS_PER_REQUEST
+            << " requests" << std::endl;
+    }
 }
 
 CandleData WebSocketConnection::parseCandleFromJson(const json& data, const std::string& topic) {
@@ -220,6 +403,69 @@ CandleData WebSocketConnection::parseCandleFromJson(const json& data, const std:
     return candle;
 }
 
+std::vector<TradeData> WebSocketConnection::parseTradesFromJson(const json& data) {
+    std::vector<TradeData> trades;
+    if (!data.is_array()) {
+        return trades;
+    }
+
+    trades.reserve(data.size());
+    try {
+        for (const auto& item : data) {
+            TradeData trade;
+            trade.symbol = item["s"].get<std::string>();
+            trade.category = m_category;
+            trade.timestamp = item["T"].get<uint64_t>();
+            trade.price = std::stod(item["p"].get<std::string>());
+            trade.size = std::stod(item["v"].get<std::string>());
+            trade.buy = item["S"].get<std::string>() == "Buy";
+            trades.push_back(trade);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "[WebSocketConnection] Parse trade error: " << e.what() << std::endl;
+    }
+
+    return trades;
+}
+
+bool WebSocketConnection::parseOrderBookFromJson(const json& message, OrderBookUpdate& update) {
+    try {
+        const json& data = message.at("data");
+
+        update.topic = message.at("topic").get<std::string>();
+        update.category = m_category;
+        update.snapshot = message.at("type").get<std::string>() == "snapshot";
+        update.updateId = data.at("u").get<uint64_t>();
+        update.timestamp = message.at("ts").get<uint64_t>();
+
+        auto readSide = [](const json& side, std::vector<OrderBook::Level>& levels) {
+            levels.reserve(side.size());
+            for (const auto& item : side) {
+                const std::string& price = item[0].get_ref<const std::string&>();
+                const std::string& size = item[1].get_ref<const std::string&>();
+                levels.push_back({ std::strtod(price.c_str(), nullptr), std::strtod(size.c_str(), nullptr) });
+            }
+        };
+        readSide(data.at("b"), update.bids);
+        readSide(data.at("a"), update.asks);
+        return true;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "[WebSocketConnection] Parse order book error: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void WebSocketConnection::resync(const std::string& topic) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // The flush sends unsubscribes first, so the server answers with a new snapshot.
+    m_pendingUnsubscribe.push_back(topic);
+    m_pendingSubscribe.push_back(topic);
+    scheduleFlush();
+}
+
 // ============================================================================
 // BybitWebSocketManager Implementation ()
 // ============================================================================
@@ -231,6 +477,12 @@ BybitWebSocketManager& BybitWebSocketManager::getInstance() {
 
 BybitWebSocketManager::BybitWebSocketManager()
     : m_maxSubscriptionsPerConnection(10)  //   10   
+    , m_maintenanceRunning(false)
+    , m_privateRunning(false)
+    , m_privateGeneration(0)
+    , m_privateAuthed(false)
+    , m_privateAuthFailed(false)
+    , m_privateDemo(false)
 {
     std::cout << "[WebSocketManager] Initialized" << std::endl;
 }
@@ -249,15 +501,24 @@ void BybitWebSocketManager::shutdown() {
 
     std::cout << "[WebSocketManager] Shutting down..." << std::endl;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    stopPrivateStream();
+    stopMaintenance();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
 
     //   
     std::cout << "[WebSocketManager] Unsubscribing all collectors..." << std::endl;
     size_t collectorCount = m_collectorSubscriptions.size();
     size_t subscriptionCount = m_subscribers.size();
 
-    m_subscribers.clear();
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        m_subscribers.clear();
+        m_tradeSubscribers.clear();
+        m_orderBooks.clear();
+    }
     m_collectorSubscriptions.clear();
+    m_aggregatorSubscriptions.clear();
 
     std::cout << "[WebSocketManager] Unsubscribed " << collectorCount
         << " collectors from " << subscriptionCount << " subscriptions" << std::endl;
@@ -265,6 +526,7 @@ void BybitWebSocketManager::shutdown() {
     //   WebSocket 
     std::cout << "[WebSocketManager] Closing all WebSocket connections..." << std::endl;
     size_t totalConnections = 0;
+    std::vector<std::shared_ptr<WebSocketConnection>> closing;
 
     for (auto& item : m_connections) {
         auto& category = item.first;
@@ -274,12 +536,15 @@ void BybitWebSocketManager::shutdown() {
             << " connections in category: " << category << std::endl;
 
         totalConnections += connections.size();
-        connections.clear();  //  WebSocketConnection  
+        closing.insert(closing.end(), connections.begin(), connections.end());
     }
 
-
     m_connections.clear();
 
+    // Each close waits for the socket, so none of them holds the manager lock.
+    lock.unlock();
+    closeConnections(closing);
+
     std::cout << "[WebSocketManager] Closed " << totalConnections
         << " total connections" << std::endl;
     std::cout << "[WebSocketManager] Shutdown complete" << std::endl;
@@ -297,6 +562,7 @@ bool BybitWebSocketManager::subscribe(
     }
 
     std::lock_guard<std::mutex> lock(m_mutex);
+    startMaintenance();
 
     Subscription sub;
     sub.symbol = symbol;
@@ -306,14 +572,18 @@ bool BybitWebSocketManager::subscribe(
     std::string subKey = sub.getKey();
 
     // ,      
-    auto& subs = m_subscribers[subKey];
-    if (subs.find(collector) != subs.end()) {
+    std::set<BybitPriceCollector*>* subs;
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        subs = &m_subscribers[subKey];
+    }
+    if (subs->find(collector) != subs->end()) {
         std::cout << "[WebSocketManager] Collector already subscribed to " << subKey << std::endl;
         return true;
     }
 
     //        -   
-    if (subs.empty()) {
+    if (subs->empty()) {
         WebSocketConnection* conn = findOrCreateConnection(category);
 
         if (!conn) {
@@ -328,14 +598,17 @@ bool BybitWebSocketManager::subscribe(
     }
 
     //     
-    subs.insert(collector);
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        subs->insert(collector);
+    }
 
     //     (    )
     m_collectorSubscriptions[collector].insert(subKey);
 
     std::cout << "[WebSocketManager] Subscribed " << collector
         << " to " << subKey
-        << " (subscribers: " << subs.size() << ")" << std::endl;
+        << " (subscribers: " << subs->size() << ")" << std::endl;
 
     return true;
 }
@@ -350,7 +623,7 @@ bool BybitWebSocketManager::unsubscribe(
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_lock<std::mutex> lock(m_mutex);
 
     Subscription sub;
     sub.symbol = symbol;
@@ -365,9 +638,13 @@ bool BybitWebSocketManager::unsubscribe(
         return false;
     }
 
-    subIt->second.erase(collector);
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        subIt->second.erase(collector);
+    }
 
     //    
+    bool lastSubscription = false;
     auto collIt = m_collectorSubscriptions.find(collector);
     if (collIt != m_collectorSubscriptions.end()) {
         collIt->second.erase(subKey);
@@ -375,14 +652,19 @@ bool BybitWebSocketManager::unsubscribe(
         //       -    
         if (collIt->second.empty()) {
             m_collectorSubscriptions.erase(collIt);
+            lastSubscription = true;
         }
     }
 
     std::cout << "[WebSocketManager] Unsubscribed " << collector << " from " << subKey << std::endl;
 
     //        -    
+    std::vector<std::shared_ptr<WebSocketConnection>> removed;
     if (subIt->second.empty()) {
-        m_subscribers.erase(subIt);
+        {
+            std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+            m_subscribers.erase(subIt);
+        }
 
         //     
         auto connIt = m_connections.find(category);
@@ -393,7 +675,14 @@ bool BybitWebSocketManager::unsubscribe(
         }
 
         //   
-        cleanupEmptyConnections();
+        removed = cleanupEmptyConnections();
+    }
+
+    // The collector has no subscriptions left; a running backfill is waited for unlocked.
+    lock.unlock();
+    closeConnections(removed);
+    if (lastSubscription) {
+        cancelBackfill(collector);
     }
 
     return true;
@@ -404,7 +693,7 @@ void BybitWebSocketManager::unsubscribeAll(BybitPriceCollector* collector) {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_lock<std::mutex> lock(m_mutex);
 
     auto collIt = m_collectorSubscriptions.find(collector);
     if (collIt == m_collectorSubscriptions.end()) {
@@ -422,12 +711,16 @@ void BybitWebSocketManager::unsubscribeAll(BybitPriceCollector* collector) {
         //    
         auto subIt = m_subscribers.find(subKey);
         if (subIt != m_subscribers.end()) {
-            subIt->second.erase(collector);
+            bool last;
+            {
+                std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+                subIt->second.erase(collector);
+                last = subIt->second.empty();
+                if (last) m_subscribers.erase(subIt);
+            }
 
             //     -  
-            if (subIt->second.empty()) {
-                m_subscribers.erase(subIt);
-
+            if (last) {
                 //  subKey   Subscription
                 // : "category:symbol.interval"
                 size_t colonPos = subKey.find(':');
@@ -455,7 +748,189 @@ void BybitWebSocketManager::unsubscribeAll(BybitPriceCollector* collector) {
     m_collectorSubscriptions.erase(collIt);
 
     //   
-    cleanupEmptyConnections();
+    auto removed = cleanupEmptyConnections();
+
+    // Nothing dispatches to the collector any more, so no new backfill can be queued;
+    // one may still be fetching over REST, which is waited for without the manager lock.
+    lock.unlock();
+    closeConnections(removed);
+    cancelBackfill(collector);
+}
+
+bool BybitWebSocketManager::subscribeTrades(
+    const std::string& symbol,
+    const std::string& category,
+    BybitTradeAggregator* aggregator)
+{
+    if (!aggregator) {
+        std::cerr << "[WebSocketManager] Aggregator is null" << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    startMaintenance();
+
+    Subscription sub;
+    sub.symbol = symbol;
+    sub.category = category;
+    sub.channel = "publicTrade";
+
+    std::string subKey = sub.getKey();
+
+    std::set<BybitTradeAggregator*>* subs;
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        subs = &m_tradeSubscribers[subKey];
+    }
+    if (subs->find(aggregator) != subs->end()) {
+        return true;
+    }
+
+    if (subs->empty()) {
+        WebSocketConnection* conn = findOrCreateConnection(category);
+
+        if (!conn || !conn->addSubscription(sub)) {
+            std::cerr << "[WebSocketManager] Failed to add subscription to connection" << std::endl;
+            return false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        subs->insert(aggregator);
+    }
+    m_aggregatorSubscriptions[aggregator].insert(sub);
+
+    std::cout << "[WebSocketManager] Subscribed " << aggregator
+        << " to " << subKey
+        << " (subscribers: " << subs->size() << ")" << std::endl;
+
+    return true;
+}
+
+void BybitWebSocketManager::unsubscribeTrades(BybitTradeAggregator* aggregator) {
+    if (!aggregator) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto aggIt = m_aggregatorSubscriptions.find(aggregator);
+    if (aggIt == m_aggregatorSubscriptions.end()) {
+        return;
+    }
+
+    for (const auto& sub : aggIt->second) {
+        auto subIt = m_tradeSubscribers.find(sub.getKey());
+        if (subIt == m_tradeSubscribers.end()) {
+            continue;
+        }
+
+        bool last;
+        {
+            std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+            subIt->second.erase(aggregator);
+            last = subIt->second.empty();
+            if (last) m_tradeSubscribers.erase(subIt);
+        }
+
+        if (last) {
+            auto connIt = m_connections.find(sub.category);
+            if (connIt != m_connections.end()) {
+                for (auto& conn : connIt->second) {
+                    conn->removeSubscription(sub);
+                }
+            }
+        }
+
+        std::cout << "[WebSocketManager] Unsubscribed " << aggregator << " from " << sub.getKey() << std::endl;
+    }
+
+    m_aggregatorSubscriptions.erase(aggIt);
+    auto removed = cleanupEmptyConnections();
+
+    lock.unlock();
+    closeConnections(removed);
+}
+
+std::shared_ptr<const OrderBook> BybitWebSocketManager::subscribeOrderBook(
+    const std::string& symbol,
+    const std::string& category,
+    int depth)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    startMaintenance();
+
+    Subscription sub;
+    sub.symbol = symbol;
+    sub.category = category;
+    sub.channel = "orderbook." + std::to_string(depth);
+
+    std::string subKey = sub.getKey();
+
+    auto it = m_orderBooks.find(subKey);
+    if (it != m_orderBooks.end()) {
+        it->second.refs++;
+        return it->second.book;
+    }
+
+    WebSocketConnection* conn = findOrCreateConnection(category);
+    if (!conn || !conn->addSubscription(sub)) {
+        std::cerr << "[WebSocketManager] Failed to add subscription to connection" << std::endl;
+        return nullptr;
+    }
+
+    OrderBookEntry entry;
+    entry.book = std::make_shared<OrderBook>(static_cast<size_t>(depth));
+    entry.sub = sub;
+    entry.refs = 1;
+
+    std::shared_ptr<const OrderBook> book = entry.book;
+    {
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        m_orderBooks[subKey] = std::move(entry);
+    }
+
+    std::cout << "[WebSocketManager] Subscribed to " << subKey << std::endl;
+    return book;
+}
+
+void BybitWebSocketManager::unsubscribeOrderBook(
+    const std::string& symbol,
+    const std::string& category,
+    int depth)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    Subscription sub;
+    sub.symbol = symbol;
+    sub.category = category;
+    sub.channel = "orderbook." + std::to_string(depth);
+
+    auto it = m_orderBooks.find(sub.getKey());
+    if (it == m_orderBooks.end() || --it->second.refs > 0) {
+        return;
+    }
+
+    {
+        // Readers keep their shared_ptr; the book just stops updating.
+        std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+        it->second.book->invalidate();
+        m_orderBooks.erase(it);
+    }
+
+    auto connIt = m_connections.find(category);
+    if (connIt != m_connections.end()) {
+        for (auto& conn : connIt->second) {
+            conn->removeSubscription(sub);
+        }
+    }
+
+    std::cout << "[WebSocketManager] Unsubscribed from " << sub.getKey() << std::endl;
+    auto removed = cleanupEmptyConnections();
+
+    lock.unlock();
+    closeConnections(removed);
 }
 
 size_t BybitWebSocketManager::getConnectionCount() const {
@@ -473,7 +948,7 @@ size_t BybitWebSocketManager::getConnectionCount() const {
 
 size_t BybitWebSocketManager::getTotalSubscriptions() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_subscribers.size();
+    return m_subscribers.size() + m_tradeSubscribers.size() + m_orderBooks.size();
 }
 
 void BybitWebSocketManager::setMaxSubscriptionsPerConnection(size_t max) {
@@ -504,18 +979,24 @@ WebSocketConnection* BybitWebSocketManager::findOrCreateConnection(const std::st
     std::cout << "[WebSocketManager] All connections full, creating new one..." << std::endl;
 
     std::string url = getWebSocketUrl(category);
-    auto newConn = std::make_unique<WebSocketConnection>(url, category);
-
-    //     
-    if (!newConn->isConnected()) {
-        std::cerr << "[WebSocketManager] Failed to create new connection" << std::endl;
-        return nullptr;
-    }
+    auto newConn = std::make_shared<WebSocketConnection>(url, category);
 
     //  callback   
     newConn->setOnCandleCallback([this](const CandleData& candle) {
         onCandleReceived(candle);
         });
+    newConn->setOnTradesCallback([this](const std::vector<TradeData>& trades) {
+        onTradesReceived(trades);
+        });
+    newConn->setOnOrderBookCallback([this](const OrderBookUpdate& update) {
+        return onOrderBookReceived(update);
+        });
+
+    // The handshake finishes on the I/O threads; subscriptions queue until it does.
+    if (!newConn->connect()) {
+        std::cerr << "[WebSocketManager] Failed to create new connection" << std::endl;
+        return nullptr;
+    }
 
     WebSocketConnection* ptr = newConn.get();
     connections.push_back(std::move(newConn));
@@ -526,8 +1007,9 @@ WebSocketConnection* BybitWebSocketManager::findOrCreateConnection(const std::st
     return ptr;
 }
 
-void BybitWebSocketManager::cleanupEmptyConnections() {
+std::vector<std::shared_ptr<WebSocketConnection>> BybitWebSocketManager::cleanupEmptyConnections() {
     std::vector<std::string> categoriesToRemove;
+    std::vector<std::shared_ptr<WebSocketConnection>> removed;
 
     for (auto& item : m_connections) {
         auto& category = item.first;
@@ -536,17 +1018,15 @@ void BybitWebSocketManager::cleanupEmptyConnections() {
         //      
         auto initialSize = connections.size();
 
-        connections.erase(
-            std::remove_if(connections.begin(), connections.end(),
-                [](const std::unique_ptr<WebSocketConnection>& conn) {
-                    bool empty = conn->getSubscriptionCount() == 0;
-                    if (empty) {
-                        std::cout << "[WebSocketManager] Removing empty connection" << std::endl;
-                    }
-                    return empty;
-                }),
-            connections.end()
-        );
+        auto emptyBegin = std::stable_partition(connections.begin(), connections.end(),
+            [](const std::shared_ptr<WebSocketConnection>& conn) {
+                return conn->getSubscriptionCount() != 0;
+            });
+        for (auto it = emptyBegin; it != connections.end(); ++it) {
+            std::cout << "[WebSocketManager] Removing empty connection" << std::endl;
+            removed.push_back(std::move(*it));
+        }
+        connections.erase(emptyBegin, connections.end());
 
         if (connections.size() < initialSize) {
             std::cout << "[WebSocketManager] Cleaned up "
@@ -566,6 +1046,8 @@ void BybitWebSocketManager::cleanupEmptyConnections() {
         m_connections.erase(category);
         std::cout << "[WebSocketManager] Removed empty category: " << category << std::endl;
     }
+
+    return removed;
 }
 
 std::string BybitWebSocketManager::getWebSocketUrl(const std::string& category) const {
@@ -577,7 +1059,7 @@ std::string BybitWebSocketManager::getWebSocketUrl(const std::string& category)
 }
 
 void BybitWebSocketManager::onCandleReceived(const CandleData& candle) {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_dispatchMutex);
 
     //   
     std::string subKey = candle.category + ":" + candle.symbol + "." + candle.interval;
@@ -594,4 +1076,332 @@ void BybitWebSocketManager::onCandleReceived(const CandleData& candle) {
             collector->onCandleReceived(candle);
         }
     }
-}
\ No newline at end of file
+}
+
+void BybitWebSocketManager::onTradesReceived(const std::vector<TradeData>& trades) {
+    std::lock_guard<std::mutex> lock(m_dispatchMutex);
+
+    std::string subKey = trades.front().category + ":publicTrade." + trades.front().symbol;
+
+    auto it = m_tradeSubscribers.find(subKey);
+    if (it == m_tradeSubscribers.end()) {
+        return;
+    }
+
+    for (BybitTradeAggregator* aggregator : it->second) {
+        if (aggregator) {
+            aggregator->onTradesReceived(trades);
+        }
+    }
+}
+
+bool BybitWebSocketManager::onOrderBookReceived(const OrderBookUpdate& update) {
+    std::lock_guard<std::mutex> lock(m_dispatchMutex);
+
+    auto it = m_orderBooks.find(update.category + ":" + update.topic);
+    if (it == m_orderBooks.end()) {
+        return true;
+    }
+
+    OrderBook& book = *it->second.book;
+    bool wasValid = book.isValid();
+    bool applied = update.snapshot
+        ? book.applySnapshot(update.bids, update.asks, update.updateId, update.timestamp)
+        : book.applyDelta(update.bids, update.asks, update.updateId, update.timestamp);
+
+    // Deltas after a rejected one are dropped until the requested snapshot arrives.
+    return applied || (!update.snapshot && !wasValid);
+}
+
+// ============================================================================
+// Heartbeat and backfill
+// ============================================================================
+
+void BybitWebSocketManager::startMaintenance() {
+    if (m_maintenanceRunning.exchange(true)) {
+        return;
+    }
+
+    m_heartbeatThread = std::thread(&BybitWebSocketManager::heartbeatLoop, this);
+    for (size_t i = 0; i < BACKFILL_THREADS; ++i) {
+        m_backfillThreads.emplace_back(&BybitWebSocketManager::backfillLoop, this);
+    }
+}
+
+void BybitWebSocketManager::stopMaintenance() {
+    {
+        std::lock_guard<std::mutex> lock(m_backfillMutex);
+        m_maintenanceRunning = false;
+        m_backfillQueue.clear();
+    }
+    m_backfillCv.notify_all();
+    m_heartbeatCv.notify_all();
+
+    if (m_heartbeatThread.joinable()) {
+        m_heartbeatThread.join();
+    }
+    for (auto& thread : m_backfillThreads) {
+        thread.join();
+    }
+    m_backfillThreads.clear();
+}
+
+void BybitWebSocketManager::heartbeatLoop() {
+    while (m_maintenanceRunning.load()) {
+        {
+            std::unique_lock<std::mutex> lock(m_heartbeatMutex);
+            m_heartbeatCv.wait_for(lock, std::chrono::seconds(HEARTBEAT_TICK_SEC), [this]() {
+                return !m_maintenanceRunning.load();
+                });
+        }
+        if (!m_maintenanceRunning.load()) {
+            break;
+        }
+
+        // Reconnects run without the manager lock; a connection removed meanwhile is
+        // already closed and maintain() leaves it alone.
+        std::vector<std::shared_ptr<WebSocketConnection>> connections;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& item : m_connections) {
+                connections.insert(connections.end(), item.second.begin(), item.second.end());
+            }
+        }
+        for (auto& conn : connections) {
+            conn->maintain();
+        }
+    }
+}
+
+bool BybitWebSocketManager::requestBackfill(BybitPriceCollector* collector) {
+    {
+        std::lock_guard<std::mutex> lock(m_backfillMutex);
+        if (!m_maintenanceRunning.load()) {
+            return false;
+        }
+        if (std::find(m_backfillQueue.begin(), m_backfillQueue.end(), collector) == m_backfillQueue.end()) {
+            m_backfillQueue.push_back(collector);
+        }
+    }
+    m_backfillCv.notify_all();
+    return true;
+}
+
+void BybitWebSocketManager::cancelBackfill(BybitPriceCollector* collector) {
+    std::unique_lock<std::mutex> lock(m_backfillMutex);
+    m_backfillQueue.erase(std::remove(m_backfillQueue.begin(), m_backfillQueue.end(), collector),
+        m_backfillQueue.end());
+    m_backfillCv.wait(lock, [this, collector]() {
+        return m_backfillActive.count(collector) == 0;
+        });
+}
+
+void BybitWebSocketManager::backfillLoop() {
+    while (true) {
+        BybitPriceCollector* collector = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_backfillMutex);
+            m_backfillCv.wait(lock, [this]() {
+                return !m_maintenanceRunning.load() || !m_backfillQueue.empty();
+                });
+            if (!m_maintenanceRunning.load()) {
+                return;
+            }
+            collector = m_backfillQueue.front();
+            m_backfillQueue.pop_front();
+            m_backfillActive.insert(collector);
+        }
+
+        collector->runBackfill();
+
+        {
+            std::lock_guard<std::mutex> lock(m_backfillMutex);
+            m_backfillActive.erase(collector);
+        }
+        m_backfillCv.notify_all();
+    }
+}
+
+// ============================================================================
+// Private stream
+// ============================================================================
+
+void BybitWebSocketManager::startPrivateStream(const std::string& apiKey, const std::string& apiSecret, bool isDemo) {
+    if (apiKey.empty() || apiSecret.empty()) {
+        std::cerr << "[WebSocketManager] Private stream needs API credentials" << std::endl;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_privateMutex);
+        if (m_privateRunning.load() && m_privateApiKey == apiKey &&
+            m_privateApiSecret == apiSecret && m_privateDemo == isDemo) {
+            return;
+        }
+
+        m_privateApiKey = apiKey;
+        m_privateApiSecret = apiSecret;
+        m_privateDemo = isDemo;
+        m_privateGeneration++;
+        m_privateRunning = true;
+        if (!m_privateThread.joinable()) {
+            m_privateThread = std::thread(&BybitWebSocketManager::privateStreamLoop, this);
+        }
+    }
+    m_privateCv.notify_all();
+}
+
+void BybitWebSocketManager::stopPrivateStream() {
+    {
+        std::lock_guard<std::mutex> lock(m_privateMutex);
+        m_privateRunning = false;
+    }
+    m_privateCv.notify_all();
+
+    if (m_privateThread.joinable()) {
+        m_privateThread.join();
+    }
+
+    Bybit::BybitAccountState::getInstance().setLive(false);
+}
+
+bool BybitWebSocketManager::isPrivateStreamLive() const {
+    return Bybit::BybitAccountState::getInstance().isLive();
+}
+
+void BybitWebSocketManager::privateStreamLoop() {
+    Bybit::BybitAccountState& account = Bybit::BybitAccountState::getInstance();
+
+    std::string apiKey, apiSecret;
+    bool isDemo = false;
+    uint64_t generation = 0;
+
+    while (m_privateRunning.load()) {
+        {
+            std::lock_guard<std::mutex> lock(m_privateMutex);
+            if (generation != m_privateGeneration.load()) {
+                // New credentials: the previous account's mirror must not leak into this one.
+                generation = m_privateGeneration.load();
+                apiKey = m_privateApiKey;
+                apiSecret = m_privateApiSecret;
+                isDemo = m_privateDemo;
+                account.clear();
+            }
+        }
+        const std::string url = isDemo ? WS_PRIVATE_DEMO_URL : WS_PRIVATE_URL;
+        auto current = [this, generation]() {
+            return m_privateRunning.load() && m_privateGeneration.load() == generation;
+        };
+
+        m_privateAuthed = false;
+        m_privateAuthFailed = false;
+
+        auto client = std::make_shared<BybitWebSocketClient>();
+
+        // Callbacks run on a shared I/O thread with the client's lock held: only touch atomics here.
+        client->setOnMessageCallback([this](const std::string& msg) {
+            onPrivateMessage(msg);
+            });
+        client->setOnErrorCallback([](const std::string& error) {
+            std::cerr << "[WebSocketManager] Private stream error: " << error << std::endl;
+            });
+        client->setOnConnectedCallback([this]() {
+            m_privateCv.notify_all();
+            });
+        client->setOnDisconnectedCallback([this]() {
+            Bybit::BybitAccountState::getInstance().setLive(false);
+            m_privateCv.notify_all();
+            });
+
+        if (client->connect(url)) {
+            std::unique_lock<std::mutex> lock(m_privateMutex);
+            m_privateCv.wait_for(lock, std::chrono::seconds(5), [&current, &client]() {
+                return !current() || client->isConnected();
+                });
+        }
+
+        if (current() && client->isConnected() && client->authenticate(apiKey, apiSecret)) {
+            std::unique_lock<std::mutex> lock(m_privateMutex);
+            m_privateCv.wait_for(lock, std::chrono::seconds(5), [this, &current]() {
+                return !current() || m_privateAuthed.load() || m_privateAuthFailed.load();
+                });
+        }
+
+        // Subscribe first so nothing between the snapshot and the stream is lost.
+        if (current() && m_privateAuthed.load() && client->subscribeTopics({ "order", "execution", "position", "wallet" })) {
+            if (!seedAccountState(apiKey, apiSecret, isDemo)) {
+                std::cerr << "[WebSocketManager] Account snapshot failed, mirror starts from the stream only" << std::endl;
+            }
+            account.setLive(true);
+            std::cout << "[WebSocketManager] Private stream live: " << url << std::endl;
+
+            while (current() && client->isConnected()) {
+                {
+                    std::unique_lock<std::mutex> lock(m_privateMutex);
+                    m_privateCv.wait_for(lock, std::chrono::seconds(PRIVATE_PING_INTERVAL_SEC), [&current, &client]() {
+                        return !current() || !client->isConnected();
+                        });
+                }
+                if (current() && client->isConnected()) {
+                    client->ping();
+                }
+            }
+        }
+        else if (m_privateAuthFailed.load()) {
+            std::cerr << "[WebSocketManager] Private stream authentication rejected" << std::endl;
+        }
+
+        account.setLive(false);
+        client->disconnect();
+
+        if (current()) {
+            std::unique_lock<std::mutex> lock(m_privateMutex);
+            m_privateCv.wait_for(lock, std::chrono::seconds(PRIVATE_RECONNECT_DELAY_SEC), [&current]() {
+                return !current();
+                });
+        }
+    }
+}
+
+bool BybitWebSocketManager::seedAccountState(const std::string& apiKey, const std::string& apiSecret, bool isDemo) {
+    Bybit::BybitMargin margin;
+    margin.setApiKeys(apiKey, apiSecret);
+    margin.setTestnet(isDemo);
+
+    uint64_t requestedAt = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::vector<Bybit::OpenOrder> orders;
+    std::string cursor;
+    do {
+        Bybit::OpenOrdersResult page = margin.getOpenOrders("", "", "USDT", "", "", 0, "", 50, cursor);
+        if (!page.success) return false;
+        orders.insert(orders.end(), page.orders.begin(), page.orders.end());
+        cursor = page.nextPageCursor;
+    } while (!cursor.empty() && m_privateRunning.load());
+
+    std::vector<Bybit::PositionInfo> positions = margin.getAllPositions("USDT");
+
+    Bybit::BybitAccountState::getInstance().seed(positions, orders, requestedAt);
+    std::cout << "[WebSocketManager] Account snapshot: " << positions.size() << " positions, "
+        << orders.size() << " open orders" << std::endl;
+    return true;
+}
+
+void BybitWebSocketManager::onPrivateMessage(const std::string& message) {
+    try {
+        json data = json::parse(message);
+
+        if (data.contains("op") && data["op"] == "auth") {
+            if (data.value("success", false)) m_privateAuthed = true;
+            else m_privateAuthFailed = true;
+            m_privateCv.notify_all();
+            return;
+        }
+
+        Bybit::BybitAccountState::getInstance().applyMessage(data);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "[WebSocketManager] Private stream parse error: " << e.what() << std::endl;
+    }
+}
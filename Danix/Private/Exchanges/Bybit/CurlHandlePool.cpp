@@ -0,0 +1,172 @@
+#include "../../../Public/Exchanges/Bybit/CurlHandlePool.h"
+#include <iostream>
+
+namespace Bybit {
+
+PooledCurlHandle::~PooledCurlHandle() {
+    if (m_pool && m_handle) {
+        m_pool->release(m_handle);
+    }
+}
+
+PooledCurlHandle::PooledCurlHandle(PooledCurlHandle&& other) noexcept
+    : m_pool(other.m_pool)
+    , m_handle(other.m_handle)
+{
+    other.m_pool = nullptr;
+    other.m_handle = nullptr;
+}
+
+PooledCurlHandle& PooledCurlHandle::operator=(PooledCurlHandle&& other) noexcept {
+    if (this != &other) {
+        if (m_pool && m_handle) {
+            m_pool->release(m_handle);
+        }
+        m_pool = other.m_pool;
+        m_handle = other.m_handle;
+        other.m_pool = nullptr;
+        other.m_handle = nullptr;
+    }
+    return *this;
+}
+
+CurlHandlePool& CurlHandlePool::getInstance() {
+    static CurlHandlePool instance;
+    return instance;
+}
+
+CurlHandlePool::CurlHandlePool()
+    : m_share(nullptr)
+{
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    m_share = curl_share_init();
+    if (m_share) {
+        curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, lockShare);
+        curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, unlockShare);
+        curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+        curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    }
+    else {
+        std::cerr << "[CurlHandlePool] curl_share_init failed, connections will not be shared" << std::endl;
+    }
+}
+
+CurlHandlePool::~CurlHandlePool() {
+    for (auto& worker : m_prewarmThreads) {
+        if (worker.joinable()) worker.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (CURL* handle : m_idle) {
+            curl_easy_cleanup(handle);
+        }
+        m_idle.clear();
+    }
+
+    if (m_share) {
+        curl_share_cleanup(m_share);
+    }
+    curl_global_cleanup();
+}
+
+void CurlHandlePool::lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr) {
+    auto* pool = static_cast<CurlHandlePool*>(userptr);
+    pool->m_shareLocks[data].lock();
+}
+
+void CurlHandlePool::unlockShare(CURL* handle, curl_lock_data data, void* userptr) {
+    auto* pool = static_cast<CurlHandlePool*>(userptr);
+    pool->m_shareLocks[data].unlock();
+}
+
+void CurlHandlePool::applyDefaults(CURL* handle) {
+    if (m_share) {
+        curl_easy_setopt(handle, CURLOPT_SHARE, m_share);
+    }
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPIDLE, 30L);
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPINTVL, 15L);
+    curl_easy_setopt(handle, CURLOPT_TCP_NODELAY, 1L);
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, "");
+}
+
+CURL* CurlHandlePool::createHandle() {
+    CURL* handle = curl_easy_init();
+    if (handle) {
+        applyDefaults(handle);
+    }
+    return handle;
+}
+
+PooledCurlHandle CurlHandlePool::acquire() {
+    CURL* handle = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_idle.empty()) {
+            handle = m_idle.back();
+            m_idle.pop_back();
+        }
+    }
+
+    if (!handle) {
+        handle = createHandle();
+        if (!handle) {
+            std::cerr << "[CurlHandlePool] curl_easy_init failed" << std::endl;
+            return PooledCurlHandle();
+        }
+    }
+    return PooledCurlHandle(this, handle);
+}
+
+void CurlHandlePool::release(CURL* handle) {
+    // curl_easy_reset drops per-request options but keeps live connections and
+    // the session cache, so the defaults only need to be reapplied.
+    curl_easy_reset(handle);
+    applyDefaults(handle);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_idle.size() < MAX_IDLE_HANDLES) {
+        m_idle.push_back(handle);
+        return;
+    }
+    curl_easy_cleanup(handle);
+}
+
+size_t CurlHandlePool::idleCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle.size();
+}
+
+void CurlHandlePool::prewarm(const std::string& baseUrl, size_t connections) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_prewarmed.insert(baseUrl).second) return;
+
+    m_prewarmThreads.emplace_back([this, baseUrl, connections]() {
+        std::vector<PooledCurlHandle> handles;
+        for (size_t i = 0; i < connections; ++i) {
+            PooledCurlHandle handle = acquire();
+            if (!handle) break;
+
+            std::string url = baseUrl + "/v5/market/time";
+            curl_easy_setopt(handle.get(), CURLOPT_URL, url.c_str());
+            curl_easy_setopt(handle.get(), CURLOPT_NOBODY, 1L);
+            curl_easy_setopt(handle.get(), CURLOPT_TIMEOUT, 10L);
+            CURLcode res = curl_easy_perform(handle.get());
+            if (res != CURLE_OK) {
+                std::cerr << "[CurlHandlePool] Prewarm " << baseUrl << " failed: " << curl_easy_strerror(res) << std::endl;
+                break;
+            }
+            // Hold the lease so the next iteration opens a second connection.
+            handles.push_back(std::move(handle));
+        }
+        });
+}
+
+}
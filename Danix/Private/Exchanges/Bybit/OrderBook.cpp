@@ -0,0 +1,150 @@
+#include "../../../Public/Exchanges/Bybit/OrderBook.h"
+#include <algorithm>
+
+OrderBook::OrderBook(size_t depth)
+    : m_depth(depth > 0 ? depth : 1)
+    , m_updateId(0)
+    , m_timestamp(0)
+    , m_valid(false)
+{
+    m_bids.reserve(m_depth + 1);
+    m_asks.reserve(m_depth + 1);
+}
+
+bool OrderBook::applySnapshot(const std::vector<Level>& bids, const std::vector<Level>& asks,
+    uint64_t updateId, uint64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_bids.clear();
+    m_asks.clear();
+    applyLevels(m_bids, bids, true);
+    applyLevels(m_asks, asks, false);
+    trim(m_bids);
+    trim(m_asks);
+
+    m_updateId = updateId;
+    m_timestamp = timestamp;
+    m_valid = !isCrossed();
+    return m_valid;
+}
+
+bool OrderBook::applyDelta(const std::vector<Level>& bids, const std::vector<Level>& asks,
+    uint64_t updateId, uint64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_valid || updateId != m_updateId + 1) {
+        m_valid = false;
+        return false;
+    }
+
+    applyLevels(m_bids, bids, true);
+    applyLevels(m_asks, asks, false);
+    trim(m_bids);
+    trim(m_asks);
+
+    m_updateId = updateId;
+    m_timestamp = timestamp;
+    m_valid = !isCrossed();
+    return m_valid;
+}
+
+void OrderBook::invalidate() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_valid = false;
+}
+
+OrderBook::Top OrderBook::getTop() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Top top;
+    if (!m_bids.empty()) {
+        top.bid = m_bids.back().price;
+        top.bidSize = m_bids.back().size;
+    }
+    if (!m_asks.empty()) {
+        top.ask = m_asks.back().price;
+        top.askSize = m_asks.back().size;
+    }
+    top.updateId = m_updateId;
+    top.timestamp = m_timestamp;
+    top.valid = m_valid && !m_bids.empty() && !m_asks.empty();
+    return top;
+}
+
+double OrderBook::getMid() const {
+    Top top = getTop();
+    return top.valid ? (top.bid + top.ask) * 0.5 : 0.0;
+}
+
+double OrderBook::getSpread() const {
+    Top top = getTop();
+    return top.valid ? top.ask - top.bid : 0.0;
+}
+
+double OrderBook::getDepth(Side side, size_t levels) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const std::vector<Level>& book = side == Side::BID ? m_bids : m_asks;
+    size_t count = std::min(levels, book.size());
+
+    double depth = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        depth += book[book.size() - 1 - i].size;
+    }
+    return depth;
+}
+
+bool OrderBook::getLevel(Side side, size_t index, Level& level) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const std::vector<Level>& book = side == Side::BID ? m_bids : m_asks;
+    if (index >= book.size()) {
+        return false;
+    }
+    level = book[book.size() - 1 - index];
+    return true;
+}
+
+size_t OrderBook::getLevelCount(Side side) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return side == Side::BID ? m_bids.size() : m_asks.size();
+}
+
+bool OrderBook::isValid() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_valid;
+}
+
+void OrderBook::applyLevels(std::vector<Level>& levels, const std::vector<Level>& updates, bool ascending) {
+    for (const Level& update : updates) {
+        auto it = std::lower_bound(levels.begin(), levels.end(), update.price,
+            [ascending](const Level& level, double price) {
+                return ascending ? level.price < price : level.price > price;
+            });
+
+        if (it != levels.end() && it->price == update.price) {
+            if (update.size > 0.0) {
+                it->size = update.size;
+            }
+            else {
+                levels.erase(it);
+            }
+        }
+        else if (update.size > 0.0) {
+            levels.insert(it, update);
+        }
+    }
+}
+
+void OrderBook::trim(std::vector<Level>& levels) const {
+    // The worst levels sit at the front.
+    if (levels.size() > m_depth) {
+        levels.erase(levels.begin(), levels.end() - m_depth);
+    }
+}
+
+bool OrderBook::isCrossed() const {
+    return !m_bids.empty() && !m_asks.empty() && m_bids.back().price >= m_asks.back().price;
+}
@@ -0,0 +1,108 @@
+#include "../../../Public/Exchanges/Bybit/WebSocketIoService.h"
+#include "../../../Public/Systems/Config/PlatformConfig.h"
+#include <iostream>
+#include <string>
+
+WebSocketIoService& WebSocketIoService::getInstance() {
+    static WebSocketIoService instance;
+    return instance;
+}
+
+WebSocketIoService::WebSocketIoService()
+    : m_threadCount(DEFAULT_THREADS)
+    , m_started(false)
+    , m_stopped(false)
+{
+    std::string configured = Config::getInstance().getValue("network", "websocket_io_threads");
+    if (!configured.empty()) {
+        try {
+            int count = std::stoi(configured);
+            if (count > 0) m_threadCount = (size_t)count;
+        }
+        catch (const std::exception&) {
+            std::cerr << "[WebSocketIo] Invalid websocket_io_threads: " << configured << std::endl;
+        }
+    }
+}
+
+WebSocketIoService::~WebSocketIoService() {
+    shutdown();
+}
+
+IoService& WebSocketIoService::getIoService() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_started && !m_stopped) start();
+    return m_ioService;
+}
+
+ContextPtr WebSocketIoService::getTlsContext() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tlsContext) return m_tlsContext;
+
+    m_tlsContext = websocketpp::lib::make_shared<websocketpp::lib::asio::ssl::context>(
+        websocketpp::lib::asio::ssl::context::tlsv12_client
+    );
+
+    try {
+        m_tlsContext->set_options(
+            websocketpp::lib::asio::ssl::context::default_workarounds |
+            websocketpp::lib::asio::ssl::context::no_sslv2 |
+            websocketpp::lib::asio::ssl::context::no_sslv3 |
+            websocketpp::lib::asio::ssl::context::single_dh_use
+        );
+    }
+    catch (const std::exception& e) {
+        std::cerr << "[WebSocketIo] TLS init error: " << e.what() << std::endl;
+    }
+
+    return m_tlsContext;
+}
+
+void WebSocketIoService::setThreadCount(size_t count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_started || count == 0) return;
+    m_threadCount = count;
+}
+
+size_t WebSocketIoService::getThreadCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_threadCount;
+}
+
+void WebSocketIoService::start() {
+    m_work = std::make_unique<IoService::work>(m_ioService);
+    for (size_t i = 0; i < m_threadCount; ++i) {
+        m_threads.emplace_back(&WebSocketIoService::run, this);
+    }
+    m_started = true;
+    std::cout << "[WebSocketIo] Started " << m_threadCount << " I/O threads" << std::endl;
+}
+
+void WebSocketIoService::run() {
+    // A throwing handler must not take the whole pool down with it.
+    while (true) {
+        try {
+            m_ioService.run();
+            return;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "[WebSocketIo] Handler error: " << e.what() << std::endl;
+        }
+    }
+}
+
+void WebSocketIoService::shutdown() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopped) return;
+        m_stopped = true;
+        m_work.reset();
+        threads.swap(m_threads);
+    }
+
+    m_ioService.stop();
+    for (auto& thread : threads) {
+        if (thread.joinable()) thread.join();
+    }
+}
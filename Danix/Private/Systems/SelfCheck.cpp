@@ -0,0 +1,466 @@
+#include "../../Public/Systems/SelfCheck.h"
+#include "../../Public/Chart/CandleCsvImporter.h"
+#include "../../Public/Chart/IndicatorKernels.h"
+#include "../../Public/Chart/CandleChartManager.h"
+#include "../../Public/Systems/Config/Numeric.h"
+#include "../../Public/Blueprints/BlueprintManager.h"
+#include "../../Public/Blueprints/Node/NodeRegistry.h"
+#include "../../Public/Systems/GuidGenerator.h"
+#include "../../Public/Blueprints/BacktestSession.h"
+#include "../../Public/StatsManager/TradingStatsManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string format(const char* fmt, double a, double b = 0.0, double c = 0.0) {
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), fmt, a, b, c);
+    return buffer;
+}
+
+// Half "+" nodes (2 int in, int out) and half MACD nodes (3 int in): every input is
+// fed by a "+" output, which gives exactly GRAPH_LINKS links without converters.
+bool buildGraph(BlueprintManager& source) {
+    const size_t adders = SelfCheck::GRAPH_NODES / 2;
+    std::vector<BasicNode*> adderNodes, macdNodes;
+    for (size_t i = 0; i < SelfCheck::GRAPH_NODES; ++i) {
+        std::unique_ptr<BasicNode> node = NodeRegistry::getInstance().create(i < adders ? "IntPlusIntNode" : "MACDNode", GUIDGenerator::generate(), &source);
+        if (!node) return false;
+        node->position = ImVec2(static_cast<float>(i % 50) * 200.0f, static_cast<float>(i / 50) * 150.0f);
+        (i < adders ? adderNodes : macdNodes).push_back(node.get());
+        source.addNode(std::move(node));
+    }
+
+    auto feed = [&](BasicNode* target, size_t input, size_t from) {
+        source.createConnection(adderNodes[from % adders]->outputs[0].get(), target->inputs[input].get());
+    };
+    for (size_t i = 0; i < adders; ++i) {
+        feed(adderNodes[i], 0, i + 1);
+        feed(adderNodes[i], 1, i + 7);
+    }
+    for (size_t i = 0; i < macdNodes.size(); ++i) {
+        feed(macdNodes[i], 0, i);
+        feed(macdNodes[i], 1, i + 3);
+        feed(macdNodes[i], 2, i + 11);
+    }
+    return true;
+}
+
+// Seeded random walk with a flat stretch every few thousand candles, where CCI and
+// Bollinger work on deviations at rounding level.
+std::vector<MarketData> syntheticCandles(size_t count) {
+    std::mt19937_64 gen(42);
+    std::normal_distribution<double> step(0.0, 15.0);
+    std::uniform_real_distribution<double> wick(0.0, 20.0);
+
+    std::vector<MarketData> candles(count);
+    double price = 30000.0;
+    for (size_t i = 0; i < count; ++i) {
+        bool flat = i % 5000 < 100;
+        double open = price;
+        if (!flat) price = std::max(1.0, price + step(gen));
+
+        MarketData& candle = candles[i];
+        candle.index = static_cast<int>(i);
+        candle.timestamp = 1600000000000ULL + i * 60000ULL;
+        candle.open = open;
+        candle.close = price;
+        candle.high = std::max(open, price) + (flat ? 0.0 : wick(gen));
+        candle.low = std::min(open, price) - (flat ? 0.0 : wick(gen));
+        candle.volume = flat ? 0.0f : static_cast<float>(10.0 + wick(gen));
+        candle.mcap = 0.0f;
+    }
+    return candles;
+}
+
+// Runs the indicator nodes with their default inputs the way a backtest does: the public
+// series grows one candle at a time and every node evaluates the last one. With `batch`
+// the nodes read IndicatorBatch columns, without it they take execute()'s per-candle path.
+// One column per node output: SMA, RSI, BB upper/middle/lower, %K, %D, CCI, MFI.
+std::vector<std::vector<double>> runNodes(const std::vector<MarketData>& candles, bool batch) {
+    static const char* types[] = { "SMANode", "RSINode", "BollingerBandsNode", "StochasticNode", "CCINode", "MFINode" };
+
+    CandlestickDataManager dataManager;
+    BlueprintManager blueprint;
+    blueprint.SetDataManager(&dataManager);
+    dataManager.SetBlueprintManager(&blueprint);
+    dataManager.addData(candles);
+
+    std::vector<BasicNode*> nodes;
+    size_t columns = 0;
+    for (const char* type : types) {
+        std::unique_ptr<BasicNode> node = NodeRegistry::getInstance().create(type, GUIDGenerator::generate(), &blueprint);
+        if (!node) return {};
+        columns += node->outputs.size();
+        nodes.push_back(node.get());
+        blueprint.addNode(std::move(node));
+    }
+    std::vector<std::vector<double>> out(columns, std::vector<double>(candles.size()));
+
+    if (batch) dataManager.beginIndicatorBatch();
+    std::vector<MarketData>* visible = dataManager.getPublicDataPtr();
+    visible->clear();
+    for (size_t i = 0; i < candles.size(); ++i) {
+        visible->push_back(candles[i]);
+        size_t column = 0;
+        for (BasicNode* node : nodes) {
+            node->execute();
+            for (auto& pin : node->outputs) out[column++][i] = static_cast<double>(pin->getValue<Real>());
+        }
+    }
+    if (batch) dataManager.endIndicatorBatch();
+    return out;
+}
+
+// The SMA, Bollinger, RSI and %K node formulas with every intermediate in long double, as
+// the reference for the nodes. Columns: SMA, BB upper, BB lower, RSI, %K.
+std::vector<std::vector<long double>> referenceFormulas(const std::vector<MarketData>& candles) {
+    using T = long double;
+    const int n = static_cast<int>(candles.size());
+    const int period = 20, rsiPeriod = 14, kPeriod = 14;
+    std::vector<std::vector<T>> out(5, std::vector<T>(n, T(0)));
+    auto close = [&](int i) { return static_cast<T>(candles[i].close); };
+
+    for (int index = period - 1; index < n; ++index) {
+        T sum = 0.0;
+        for (int i = 0; i < period; i++) sum += close(index - i);
+        T sma = sum / static_cast<T>(period);
+
+        T sumSquaredDiff = 0.0;
+        for (int i = 0; i < period; i++) {
+            T diff = close(index - i) - sma;
+            sumSquaredDiff += diff * diff;
+        }
+        T stdDev = std::sqrt(sumSquaredDiff / static_cast<T>(period));
+        out[0][index] = sma;
+        out[1][index] = sma + stdDev * 2.0;
+        out[2][index] = sma - stdDev * 2.0;
+    }
+
+    for (int index = 0; index < n; ++index) {
+        if (index < rsiPeriod) {
+            out[3][index] = 50.0;
+            continue;
+        }
+        T gains = 0.0, losses = 0.0;
+        for (int i = 1; i <= rsiPeriod; i++) {
+            T change = close(index - i + 1) - close(index - i);
+            if (change > 0) gains += change;
+            else losses -= change;
+        }
+        T avgLoss = losses / static_cast<T>(rsiPeriod);
+        out[3][index] = avgLoss != 0.0 ? 100.0 - (100.0 / (1.0 + (gains / static_cast<T>(rsiPeriod)) / avgLoss)) : 100.0;
+    }
+
+    for (int index = 0; index < n; ++index) {
+        if (index < kPeriod - 1) {
+            out[4][index] = 50.0;
+            continue;
+        }
+        T highestHigh = candles[index].high, lowestLow = candles[index].low;
+        for (int i = 1; i < kPeriod; i++) {
+            if (candles[index - i].high > highestHigh) highestHigh = candles[index - i].high;
+            if (candles[index - i].low < lowestLow) lowestLow = candles[index - i].low;
+        }
+        out[4][index] = highestHigh == lowestLow ? T(50.0) : ((close(index) - lowestLow) / (highestHigh - lowestLow)) * 100.0;
+    }
+    return out;
+}
+
+// Runs PRECISION_BLUEPRINT through a BacktestSession; realized P&L, balance and order count.
+bool runBacktest(const std::vector<MarketData>& candles, std::vector<double>& figures) {
+    CandlestickDataManager dataManager;
+    BlueprintManager blueprint;
+    TradingStatsManager stats;
+    blueprint.SetDataManager(&dataManager);
+    dataManager.SetBlueprintManager(&blueprint);
+    dataManager.SetBacktestTradingStats(&stats);
+    dataManager.addData(candles);
+
+    BacktestSession session(&dataManager);
+    if (!session.start(SelfCheck::PRECISION_BLUEPRINT)) return false;
+    figures = { stats.GetRealizedPnL(), stats.GetCurrentBalance(), static_cast<double>(stats.GetTotalOrdersCount()) };
+    return true;
+}
+
+std::string fingerprintPath(const char* realName) {
+    std::string name = realName;
+    std::replace(name.begin(), name.end(), ' ', '-');
+    return std::string(SelfCheck::PRECISION_DIR) + "/precision-" + name + ".bin";
+}
+
+void saveFingerprint(const std::string& filename, const std::vector<double>& values) {
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(filename).parent_path(), error);
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    uint64_t count = values.size();
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(count * sizeof(double)));
+}
+
+bool loadFingerprint(const std::string& filename, size_t expected, std::vector<double>& values) {
+    std::ifstream file(filename, std::ios::binary);
+    uint64_t count = 0;
+    if (!file.read(reinterpret_cast<char*>(&count), sizeof(count)) || count != expected) return false;
+    values.resize(expected);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(double))));
+}
+}
+
+std::vector<SelfCheck::Result> SelfCheck::runAll() {
+    std::vector<Result> results;
+    results.push_back(csvImport());
+    results.push_back(graphLoad());
+    results.push_back(binaryLoad());
+    results.push_back(indicatorSimd());
+    results.push_back(realPrecision());
+    return results;
+}
+
+int SelfCheck::run() {
+    int failed = 0;
+    for (const Result& result : runAll()) {
+        std::cout << "[SelfCheck] " << (result.passed ? "PASS " : "FAIL ") << result.name
+            << ": " << result.detail << std::endl;
+        if (!result.passed) failed++;
+    }
+    return failed > 0 ? 1 : 0;
+}
+
+SelfCheck::Result SelfCheck::csvImport() {
+    Result result;
+    result.name = "csv import";
+
+    // Binance-style kline rows, ms timestamps, already ordered.
+    std::string csv = "open_time,open,high,low,close,volume\n";
+    csv.reserve(IMPORT_ROWS * 64);
+    char line[128];
+    uint64_t time = 1600000000000ULL;
+    for (size_t i = 0; i < IMPORT_ROWS; ++i) {
+        double open = 20000.0 + static_cast<double>(i % 5000) * 0.25;
+        int length = snprintf(line, sizeof(line), "%llu,%.2f,%.2f,%.2f,%.2f,%.4f\n",
+            static_cast<unsigned long long>(time + i * 60000ULL), open, open + 5.5, open - 4.25, open + 1.75, 12.5 + (i % 100));
+        csv.append(line, static_cast<size_t>(length));
+    }
+
+    std::vector<MarketData> candles;
+    CsvImportStats stats;
+    Clock::time_point start = Clock::now();
+    bool parsed = CandleCsvImporter::parse(csv.data(), csv.data() + csv.size(), candles, &stats);
+    double ms = elapsedMs(start);
+    double throughput = ms > 0.0 ? (csv.size() / (1024.0 * 1024.0)) / (ms / 1000.0) : 0.0;
+
+    bool values = parsed && candles.size() == IMPORT_ROWS;
+    for (size_t i = 0; values && i < IMPORT_ROWS; i += 9973) {
+        double open = 20000.0 + static_cast<double>(i % 5000) * 0.25;
+        values = candles[i].timestamp == time + i * 60000ULL
+            && std::fabs(static_cast<double>(candles[i].open) - open) < 1e-9
+            && std::fabs(static_cast<double>(candles[i].close) - (open + 1.75)) < 1e-9;
+    }
+
+    result.passed = values && throughput >= IMPORT_TARGET_MBS;
+    result.detail = format("%.0f MB/s (target %.0f MB/s)", throughput, IMPORT_TARGET_MBS)
+        + " on " + std::to_string(stats.threads) + " threads, values " + (values ? "ok" : "WRONG");
+    return result;
+}
+
+SelfCheck::Result SelfCheck::graphLoad() {
+    Result result;
+    result.name = "graph load";
+
+    BlueprintManager source;
+    if (!buildGraph(source)) {
+        result.detail = "node types missing from the registry";
+        return result;
+    }
+    nlohmann::json blueprint = source.serializeToJson();
+
+    BlueprintManager loaded;
+    Clock::time_point start = Clock::now();
+    bool ok = loaded.deserializeFromJson(blueprint);
+    double loadMs = elapsedMs(start);
+
+    // What the editor does per link when it needs the endpoints by GUID.
+    start = Clock::now();
+    size_t resolved = 0;
+    for (const auto& conn : blueprint["connections"]) {
+        Pin* from = loaded.getPinByGuid(conn["from_pin"].get<std::string>());
+        Pin* to = loaded.getPinByGuid(conn["to_pin"].get<std::string>());
+        if (from && to && from->owner && to->owner) resolved++;
+    }
+    double lookupMs = elapsedMs(start);
+
+    nlohmann::json reloaded = loaded.serializeToJson();
+    size_t nodes = reloaded["nodes"].size();
+    size_t links = reloaded["connections"].size();
+    bool shape = ok && nodes == GRAPH_NODES && links == GRAPH_LINKS && resolved == GRAPH_LINKS;
+
+    result.passed = shape && loadMs <= GRAPH_LOAD_TARGET_MS;
+    result.detail = format("%.1f ms load (target %.0f ms), %.2f ms to resolve all link endpoints", loadMs, GRAPH_LOAD_TARGET_MS, lookupMs)
+        + ", " + std::to_string(nodes) + " nodes / " + std::to_string(links) + " links" + (shape ? "" : " WRONG")
+        + "; frame rate is not measured here";
+    return result;
+}
+
+SelfCheck::Result SelfCheck::binaryLoad() {
+    Result result;
+    result.name = "binary blueprint load";
+
+    BlueprintManager source;
+    std::vector<uint8_t> binary;
+    if (!buildGraph(source) || !source.serializeToBinary(binary)) {
+        result.detail = "could not build the test graph";
+        return result;
+    }
+    std::string text = source.serializeToJson().dump();
+
+    // Best of a few runs, so a cold allocator does not decide the ratio.
+    const int runs = 3;
+    double jsonMs = 0.0, binaryMs = 0.0;
+    bool ok = true;
+    for (int run = 0; run < runs; ++run) {
+        BlueprintManager fromJson;
+        Clock::time_point start = Clock::now();
+        ok = fromJson.deserializeFromJson(nlohmann::json::parse(text)) && ok;
+        double ms = elapsedMs(start);
+        jsonMs = run == 0 ? ms : std::min(jsonMs, ms);
+
+        BlueprintManager fromBinary;
+        start = Clock::now();
+        ok = fromBinary.deserializeFromBinary(binary.data(), binary.size()) && ok;
+        ms = elapsedMs(start);
+        binaryMs = run == 0 ? ms : std::min(binaryMs, ms);
+
+        if (run == 0) {
+            ok = ok && fromBinary.serializeToJson()["connections"].size() == GRAPH_LINKS;
+        }
+    }
+
+    double speedup = binaryMs > 0.0 ? jsonMs / binaryMs : 0.0;
+    result.passed = ok && speedup >= BINARY_SPEEDUP_TARGET;
+    result.detail = format("%.1fx faster (target %.0fx): JSON %.1f ms", speedup, BINARY_SPEEDUP_TARGET, jsonMs)
+        + format(", binary %.1f ms, %.0f KB vs ", binaryMs, binary.size() / 1024.0) + format("%.0f KB JSON", text.size() / 1024.0)
+        + (ok ? "" : ", load WRONG");
+    return result;
+}
+
+SelfCheck::Result SelfCheck::indicatorSimd() {
+    Result result;
+    result.name = std::string("indicator batch ") + IndicatorKernels::instructionSet() + " vs node execute()";
+
+    std::vector<MarketData> candles = syntheticCandles(INDICATOR_CANDLES);
+    std::vector<std::vector<double>> reference = runNodes(candles, false);
+    std::vector<std::vector<double>> simd = runNodes(candles, true);
+    IndicatorKernels::setScalarOnly(true);
+    std::vector<std::vector<double>> scalar = runNodes(candles, true);
+    IndicatorKernels::setScalarOnly(false);
+    if (reference.empty() || simd.empty() || scalar.empty()) {
+        result.detail = "indicator node types missing from the registry";
+        return result;
+    }
+
+    static const char* columns[] = { "SMA", "RSI", "BB upper", "BB middle", "BB lower", "%K", "%D", "CCI", "MFI" };
+    double worst = 0.0;
+    size_t worstColumn = 0, mismatches = 0;
+    for (const auto* batch : { &simd, &scalar }) {
+        for (size_t c = 0; c < reference.size(); ++c) {
+            for (size_t i = 0; i < reference[c].size(); ++i) {
+                // The tolerance the batch is held to, relative to max(1, |value|) as documented
+                // in IndicatorKernels.h; a NaN on one side only is always a mismatch.
+                double a = (*batch)[c][i], b = reference[c][i];
+                double error = (std::isnan(a) || std::isnan(b)) ? (std::isnan(a) == std::isnan(b) ? 0.0 : INFINITY)
+                    : std::fabs(a - b) / std::max(1.0, std::fabs(b));
+                if (error > IndicatorKernels::TOLERANCE) mismatches++;
+                if (error > worst) {
+                    worst = error;
+                    worstColumn = c;
+                }
+            }
+        }
+    }
+
+    result.passed = mismatches == 0;
+    result.detail = format("max relative error %.3g (tolerance %.0e) over %.0f candles, SIMD and scalar lanes", worst, IndicatorKernels::TOLERANCE, static_cast<double>(candles.size()))
+        + (worst > 0.0 ? std::string(", worst column ") + columns[worstColumn] : std::string())
+        + (mismatches ? ", " + std::to_string(mismatches) + " values out of tolerance" : std::string());
+    return result;
+}
+
+SelfCheck::Result SelfCheck::realPrecision() {
+    Result result;
+    result.name = std::string("indicator nodes and backtest in ") + DANIX_REAL_NAME;
+
+    std::vector<MarketData> candles = syntheticCandles(INDICATOR_CANDLES);
+    std::vector<std::vector<double>> nodes = runNodes(candles, false);
+    if (nodes.empty()) {
+        result.detail = "indicator node types missing from the registry";
+        return result;
+    }
+
+    // The nodes' per-candle path in this build's Real against the long double formulas.
+    std::vector<std::vector<long double>> reference = referenceFormulas(candles);
+    static const size_t nodeColumns[] = { 0, 2, 4, 1, 5 };
+    static const char* columns[] = { "SMA", "BB upper", "BB lower", "RSI", "%K" };
+    long double worst = 0.0;
+    size_t worstColumn = 0, mismatches = 0;
+    for (size_t c = 0; c < reference.size(); ++c) {
+        for (size_t i = 0; i < reference[c].size(); ++i) {
+            long double error = std::fabs(nodes[nodeColumns[c]][i] - reference[c][i]) / std::max(1.0L, std::fabs(reference[c][i]));
+            if (error > IndicatorKernels::TOLERANCE) mismatches++;
+            if (error > worst) {
+                worst = error;
+                worstColumn = c;
+            }
+        }
+    }
+
+    // Node outputs and backtest results of this build, compared with the other Real build's
+    // when `--self-check` already ran there: DANIX_LONG_DOUBLE_MATH on against off.
+    std::vector<double> fingerprint;
+    for (size_t i = 0; i < candles.size(); i += PRECISION_SAMPLE_STEP) {
+        for (const auto& column : nodes) fingerprint.push_back(column[i]);
+    }
+
+    std::vector<double> figures;
+    candles.resize(PRECISION_BACKTEST_CANDLES);
+    bool backtest = runBacktest(candles, figures);
+    std::string backtestDetail = backtest
+        ? format("; backtest P&L %.2f, balance %.2f, %.0f orders", figures[0], figures[1], figures[2])
+        : std::string("; backtest skipped, ") + PRECISION_BLUEPRINT + " did not load";
+    if (backtest) fingerprint.insert(fingerprint.end(), figures.begin(), figures.end());
+
+    saveFingerprint(fingerprintPath(DANIX_REAL_NAME), fingerprint);
+    const char* otherName = std::string(DANIX_REAL_NAME) == "double" ? "long double" : "double";
+    std::vector<double> other;
+    std::string otherDetail = std::string("; no ") + otherName + " build results yet";
+    if (loadFingerprint(fingerprintPath(otherName), fingerprint.size(), other)) {
+        double otherWorst = 0.0;
+        for (size_t i = 0; i < fingerprint.size(); ++i) {
+            double error = std::fabs(fingerprint[i] - other[i]) / std::max(1.0, std::fabs(other[i]));
+            if (error > IndicatorKernels::TOLERANCE) mismatches++;
+            otherWorst = std::max(otherWorst, error);
+        }
+        otherDetail = format("; max relative error %.3g against the ", otherWorst) + otherName + " build";
+    }
+
+    result.passed = mismatches == 0;
+    result.detail = format("nodes vs long double formulas max relative error %.3g (tolerance %.0e) over %.0f candles", static_cast<double>(worst), IndicatorKernels::TOLERANCE, static_cast<double>(INDICATOR_CANDLES))
+        + (worst > 0.0 ? std::string(", worst column ") + columns[worstColumn] : std::string())
+        + (mismatches ? ", " + std::to_string(mismatches) + " values out of tolerance" : std::string())
+        + backtestDetail + otherDetail
+        + (sizeof(long double) == sizeof(double) ? "; long double is double on this compiler" : "");
+    return result;
+}
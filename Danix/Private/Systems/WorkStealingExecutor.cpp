@@ -0,0 +1,225 @@
+#include "../../Public/Systems/WorkStealingExecutor.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+namespace {
+    // Set on pool threads so a strand posted from a worker lands in that worker's own deque.
+    thread_local const WorkStealingExecutor* t_executor = nullptr;
+    thread_local size_t t_workerIndex = 0;
+}
+
+WorkStealingExecutor& WorkStealingExecutor::getInstance() {
+    static WorkStealingExecutor instance;
+    return instance;
+}
+
+WorkStealingExecutor::WorkStealingExecutor() {
+    unsigned int hw = std::thread::hardware_concurrency();
+    size_t count = hw > 0 ? hw : 2;
+
+    latencyUs.reserve(LATENCY_WINDOW);
+    for (size_t i = 0; i < count; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&WorkStealingExecutor::workerLoop, this, i);
+    }
+    std::cout << "[Executor] Started " << count << " workers" << std::endl;
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    shutdown();
+}
+
+void WorkStealingExecutor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        if (stopping.exchange(true)) return;
+    }
+    sleepCv.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+size_t WorkStealingExecutor::Strand::pending() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size();
+}
+
+std::shared_ptr<WorkStealingExecutor::Strand> WorkStealingExecutor::createStrand(const std::string& name) {
+    auto strand = std::make_shared<Strand>();
+    strand->name = name;
+    return strand;
+}
+
+void WorkStealingExecutor::post(const std::shared_ptr<Strand>& strand, Task task) {
+    enqueue(strand, { std::move(task), Clock::time_point(), false });
+}
+
+void WorkStealingExecutor::post(const std::shared_ptr<Strand>& strand, Task task, Clock::time_point origin) {
+    enqueue(strand, { std::move(task), origin, true });
+}
+
+void WorkStealingExecutor::enqueue(const std::shared_ptr<Strand>& strand, Strand::Item item) {
+    if (!strand || stopping.load()) return;
+
+    bool needsSchedule = false;
+    {
+        std::lock_guard<std::mutex> lock(strand->mutex);
+        strand->queue.push_back(std::move(item));
+        if (!strand->scheduled) {
+            strand->scheduled = true;
+            needsSchedule = true;
+        }
+    }
+    if (needsSchedule) schedule(strand, false);
+}
+
+void WorkStealingExecutor::schedule(std::shared_ptr<Strand> strand, bool yielded) {
+    size_t index;
+    if (t_executor == this) {
+        index = t_workerIndex;
+    }
+    else {
+        index = nextQueue.fetch_add(1) % queues.size();
+    }
+
+    {
+        WorkerQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        // A strand that used up its turn goes to the cold end: taken last locally, first by thieves.
+        if (yielded) queue.strands.push_front(std::move(strand));
+        else queue.strands.push_back(std::move(strand));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queued++;
+    }
+    sleepCv.notify_one();
+}
+
+std::shared_ptr<WorkStealingExecutor::Strand> WorkStealingExecutor::popLocal(size_t index) {
+    WorkerQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.strands.empty()) return nullptr;
+
+    std::shared_ptr<Strand> strand = std::move(queue.strands.back());
+    queue.strands.pop_back();
+    return strand;
+}
+
+std::shared_ptr<WorkStealingExecutor::Strand> WorkStealingExecutor::steal(size_t index) {
+    for (size_t i = 1; i < queues.size(); ++i) {
+        WorkerQueue& victim = *queues[(index + i) % queues.size()];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.strands.empty()) continue;
+
+        std::shared_ptr<Strand> strand = std::move(victim.strands.front());
+        victim.strands.pop_front();
+        steals++;
+        return strand;
+    }
+    return nullptr;
+}
+
+void WorkStealingExecutor::runStrand(const std::shared_ptr<Strand>& strand) {
+    for (size_t i = 0; i < MAX_TASKS_PER_TURN; ++i) {
+        Strand::Item item;
+        {
+            std::lock_guard<std::mutex> lock(strand->mutex);
+            if (strand->queue.empty()) break;
+            item = std::move(strand->queue.front());
+            strand->queue.pop_front();
+        }
+
+        try {
+            item.task();
+        }
+        catch (const std::exception& e) {
+            std::cout << "[Executor] " << strand->name << " task error: " << e.what() << std::endl;
+        }
+
+        if (item.timed) recordLatency(item.origin);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(strand->mutex);
+        if (strand->queue.empty()) {
+            strand->scheduled = false;
+            strand->idleCv.notify_all();
+            return;
+        }
+    }
+    schedule(strand, true);
+}
+
+void WorkStealingExecutor::workerLoop(size_t index) {
+    t_executor = this;
+    t_workerIndex = index;
+
+    while (true) {
+        std::shared_ptr<Strand> strand = popLocal(index);
+        if (!strand) strand = steal(index);
+
+        if (!strand) {
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            if (stopping.load()) return;
+            // queued can be non-zero while the owner of the strand holds its deque lock; retry shortly.
+            sleepCv.wait_for(lock, std::chrono::milliseconds(10), [this] { return stopping.load() || queued.load() > 0; });
+            continue;
+        }
+
+        queued--;
+        runStrand(strand);
+    }
+}
+
+void WorkStealingExecutor::waitIdle(const std::shared_ptr<Strand>& strand) {
+    if (!strand) return;
+    std::unique_lock<std::mutex> lock(strand->mutex);
+    while (strand->scheduled && !stopping.load()) {
+        strand->idleCv.wait_for(lock, std::chrono::milliseconds(50));
+    }
+}
+
+void WorkStealingExecutor::recordLatency(Clock::time_point origin) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin).count();
+    uint32_t us = elapsed < 0 ? 0 : static_cast<uint32_t>(std::min<long long>(elapsed, UINT32_MAX));
+
+    std::lock_guard<std::mutex> lock(latencyMutex);
+    if (latencyUs.size() < LATENCY_WINDOW) latencyUs.push_back(us);
+    else latencyUs[latencySamples % LATENCY_WINDOW] = us;
+    latencySamples++;
+    latencyMaxUs = std::max(latencyMaxUs, us);
+}
+
+WorkStealingExecutor::LatencyStats WorkStealingExecutor::getLatencyStats() const {
+    std::vector<uint32_t> samples;
+    LatencyStats stats;
+    {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        samples = latencyUs;
+        stats.samples = latencySamples;
+        stats.maxUs = latencyMaxUs;
+    }
+    if (samples.empty()) return stats;
+
+    auto percentile = [&samples](double p) {
+        size_t k = static_cast<size_t>(p * (samples.size() - 1));
+        std::nth_element(samples.begin(), samples.begin() + k, samples.end());
+        return static_cast<double>(samples[k]);
+    };
+    stats.p50Us = percentile(0.50);
+    stats.p99Us = percentile(0.99);
+    return stats;
+}
+
+void WorkStealingExecutor::resetLatencyStats() {
+    std::lock_guard<std::mutex> lock(latencyMutex);
+    latencyUs.clear();
+    latencySamples = 0;
+    latencyMaxUs = 0;
+}
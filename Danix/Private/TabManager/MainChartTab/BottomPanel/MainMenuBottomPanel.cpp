@@ -7,12 +7,22 @@
 #include <cstdlib>
 #include <ctime>
 #include "../../../../Public/Blueprints/BlueprintManager.h"
+#include "../../../../Public/Blueprints/StrategyHost.h"
+#include "../../../../Public/Blueprints/BacktestSession.h"
+#include "../../../../Public/Blueprints/ParallelBacktest.h"
+#include "../../../../Public/Blueprints/StrategyTemplate.h"
 #include "../../../../Public/Chart/CandleChart.h"
 #include "../../../../Public/Chart/CandleChartManager.h"
+#include "../../../../Public/Chart/MappedCandleSeries.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cfloat>
 #include "../../../../Public/StatsManager/TradingStatsManager.h"
+#include "../../../../Public/Exchanges/Bybit/Bybitwebsocketmanager.h"
+#include "../../../../Public/Exchanges/Bybit/BybitAccountState.h"
+#include "../../../../Public/Systems/Config/PlatformConfig.h"
+#include "../../../../Public/Systems/WorkStealingExecutor.h"
 
 
 #ifdef _WIN32
@@ -25,11 +35,17 @@
 #endif
 
 BottomPanel::BottomPanel(CandlestickDataManager* dManager)
-    : dataManager(dManager), selectedFileIndex(-1), isVisible(true), activeTab(0), showStrategyPopup(false) {
+    : dataManager(dManager), selectedFileIndex(-1), isVisible(true), activeTab(0), showStrategyPopup(false),
+    backtestSession(std::make_unique<BacktestSession>(dManager)), autoContinueBacktest(false), resumeQueued(false),
+    shardCount(4), shardWarmup(1000), shardVerify(false),
+    hostBarType(0), hostBarSize(5.0f), hostOrderBook(false), hostSnapshots(false) {
+    memset(hostSymbols, 0, sizeof(hostSymbols));
     scanStrategyFiles();
 }
 
 BottomPanel::~BottomPanel() {
+    // A queued resume refers to the session.
+    if (strategyStrand) WorkStealingExecutor::getInstance().waitIdle(strategyStrand);
 }
 
 bool BottomPanel::fileExists(const std::string& filepath) {
@@ -135,6 +151,12 @@ void BottomPanel::render() {
                 ImGui::EndTabItem();
             }
 
+            if (ImGui::BeginTabItem("Robustness")) {
+                activeTab = 0;
+                renderRobustnessTab();
+                ImGui::EndTabItem();
+            }
+
             if (ImGui::BeginTabItem("Settings")) {
                 activeTab = 1;
                 renderSettingsTab();
@@ -149,6 +171,152 @@ void BottomPanel::render() {
     renderStrategySelectionPopup();
 }
 
+void BottomPanel::resumeBacktest() {
+    if (!strategyStrand) {
+        backtestSession->resume();
+        return;
+    }
+
+    // One pass in flight at a time; Auto would otherwise queue one per frame.
+    if (resumeQueued.exchange(true)) return;
+    WorkStealingExecutor::getInstance().post(strategyStrand, [this]() {
+        backtestSession->resume();
+        resumeQueued = false;
+        });
+}
+
+// Runs the task where candles are appended: on the strategy strand when the tab has one,
+// otherwise right here. With wait, returns once the task has run.
+void BottomPanel::onStrategyStrand(WorkStealingExecutor::Task task, bool wait) {
+    if (!strategyStrand) {
+        task();
+        return;
+    }
+    if (!wait) {
+        WorkStealingExecutor::getInstance().post(strategyStrand, std::move(task));
+        return;
+    }
+
+    std::promise<void> done;
+    WorkStealingExecutor::getInstance().post(strategyStrand, [&task, &done]() {
+        task();
+        done.set_value();
+        });
+    done.get_future().wait();
+}
+
+CandleSeriesView BottomPanel::SeriesSource::view() const {
+    return mapped ? mapped->view() : CandleSeriesView(candles);
+}
+
+// Called on the strategy strand, so live candles are copied in between two appends.
+BottomPanel::SeriesSource BottomPanel::captureSeries() {
+    SeriesSource source;
+    source.mapped = dataManager->shareMappedSeries();
+    if (!source.mapped) source.candles = dataManager->getData();
+    return source;
+}
+
+void BottomPanel::startShardedRun() {
+    std::shared_ptr<const StrategyTemplate> strategy = StrategyTemplate::compileFile("Data/" + selectedStrategy);
+    if (!strategy) {
+        shardReport = "Failed to compile " + selectedStrategy;
+        return;
+    }
+
+    ParallelBacktest::Settings settings;
+    settings.shards = static_cast<size_t>(shardCount);
+    settings.warmupCandles = static_cast<size_t>(shardWarmup);
+    settings.verify = shardVerify;
+
+    // Starting balance and commissions of the backtest stats; the result replaces them when
+    // done. Taken on the strand, where a queued resume also writes them.
+    TradingStatsManager config;
+    SeriesSource source;
+    onStrategyStrand([this, &config, &source]() {
+        config = *dataManager->GetBacktestTradingStats();
+        config.Reset();
+        backtestSession->end();
+        source = captureSeries();
+        }, true);
+    if (dataManager->GetChart()) dataManager->GetChart()->clearAllTradingElements();
+    shardReport.clear();
+
+    shardedRun = std::async(std::launch::async, [strategy, settings, config, source = std::move(source)]() {
+        ShardedRun run;
+        run.stats = config;
+        run.report = ParallelBacktest::run(*strategy, source.view(), settings, run.stats);
+        return run;
+        });
+}
+
+void BottomPanel::pollShardedRun() {
+    if (!shardedRun.valid() || shardedRun.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+
+    ShardedRun run = shardedRun.get();
+    const ParallelBacktest::Report& report = run.report;
+    if (report.ok) {
+        onStrategyStrand([this, stats = run.stats]() {
+            *dataManager->GetBacktestTradingStats() = stats;
+            }, false);
+    }
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "%zu candles, %zu shards, %.0f ms", report.candles,
+        report.shards.size(), report.elapsedMs);
+    shardReport = report.ok ? buffer : "Sharded backtest failed";
+    if (report.verified) {
+        snprintf(buffer, sizeof(buffer), " | serial %.0f ms (x%.1f), trades %zu/%zu, %zu differ, PnL %.2f/%.2f",
+            report.serialMs, report.elapsedMs > 0.0 ? report.serialMs / report.elapsedMs : 0.0,
+            report.shardedTrades, report.serialTrades, report.mismatchedTrades,
+            report.shardedPnL, report.serialPnL);
+        shardReport += buffer;
+    }
+    size_t notFlat = std::count_if(report.shards.begin(), report.shards.end(),
+        [](const ParallelBacktest::ShardReport& shard) { return !shard.flatAtStart; });
+    if (notFlat > 0) {
+        snprintf(buffer, sizeof(buffer), " | %zu shards not flat at start", notFlat);
+        shardReport += buffer;
+    }
+    std::cout << "[BottomPanel] " << shardReport << std::endl;
+}
+
+void BottomPanel::startWalkForward() {
+    std::shared_ptr<const StrategyTemplate> strategy = StrategyTemplate::compileFile("Data/" + selectedStrategy);
+    if (!strategy) {
+        walkForwardReport = RobustnessAnalysis::WalkForwardReport();
+        return;
+    }
+
+    TradingStatsManager config;
+    SeriesSource source;
+    onStrategyStrand([this, &config, &source]() {
+        config = *dataManager->GetBacktestTradingStats();
+        config.Reset();
+        source = captureSeries();
+        }, true);
+
+    walkForwardRun = std::async(std::launch::async,
+        [strategy, settings = walkForwardSettings, config, source = std::move(source)]() {
+            return RobustnessAnalysis::walkForward(*strategy, source.view(), settings, config);
+        });
+}
+
+void BottomPanel::startMonteCarlo() {
+    TradingStatsManager* stats = dataManager->GetBacktestTradingStats();
+    std::vector<Trade> trades;
+    double balance = 0.0;
+    onStrategyStrand([stats, &trades, &balance]() {
+        trades = stats->GetTrades();
+        balance = stats->GetStartingBalance();
+        }, true);
+
+    monteCarloRun = std::async(std::launch::async,
+        [settings = monteCarloSettings, trades = std::move(trades), balance]() {
+            return RobustnessAnalysis::monteCarlo(trades, balance, settings);
+        });
+}
+
 void BottomPanel::renderPerformanceTab() {
     if (!hasLoadedStrategy()) {
         ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "No strategy loaded");
@@ -164,17 +332,51 @@ void BottomPanel::renderPerformanceTab() {
     }
 
     if (ImGui::Button("Run backtest")) {
-        dataManager->GetChart()->clearAllTradingElements();
         std::cout << "back test started!!!!!" << std::endl;
-        dataManager->GetBlueprintManager()->clearAllBeforeLoad();
-        std::string fullPath = "Data/" + selectedStrategy;
-        bool success = dataManager->GetBlueprintManager()->loadBlueprint(fullPath);
-        std::vector<MarketData>* data = dataManager->getPublicDataPtr();
-        data->clear();
-        for (auto& Candle : dataManager->getData())
-        {
-            data->push_back(Candle);
-            dataManager->GetBlueprintManager()->executeFromEntry();
+        // Queued behind a resume in flight rather than running beside it.
+        onStrategyStrand([this, path = "Data/" + selectedStrategy]() {
+            backtestSession->start(path);
+            }, false);
+    }
+
+    // A live strategy evaluates new candles itself; the session only continues a backtest.
+    if (backtestSession->isActive() && !dataManager->RuntimeModeIsActive()) {
+        size_t pending = backtestSession->getPendingCount();
+
+        ImGui::SameLine();
+        if (ImGui::Button("Continue backtest")) {
+            resumeBacktest();
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Auto##AutoContinue", &autoContinueBacktest);
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%zu candles, %zu new",
+            backtestSession->getProcessedCount(), pending);
+
+        if (autoContinueBacktest && pending > 0) {
+            resumeBacktest();
+        }
+    }
+
+    if (!dataManager->RuntimeModeIsActive()) {
+        pollShardedRun();
+        if (shardedRun.valid()) {
+            ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "Sharded backtest running...");
+        }
+        else if (ImGui::Button("Run sharded")) {
+            startShardedRun();
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(80);
+        if (ImGui::InputInt("Shards", &shardCount)) shardCount = std::max(1, std::min(shardCount, 64));
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(100);
+        if (ImGui::InputInt("Warm-up", &shardWarmup)) shardWarmup = std::max(0, shardWarmup);
+        ImGui::SameLine();
+        ImGui::Checkbox("Verify##ShardVerify", &shardVerify);
+        if (!shardReport.empty()) {
+            ImGui::SameLine();
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%s", shardReport.c_str());
         }
     }
 
@@ -566,6 +768,127 @@ void BottomPanel::renderPerformanceTab() {
     }
 }
 
+void BottomPanel::renderRobustnessTab() {
+    if (!hasLoadedStrategy()) {
+        ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "No strategy loaded");
+        return;
+    }
+
+    TradingStatsManager* stats = dataManager->GetBacktestTradingStats();
+
+    ImGui::Columns(2, "RobustnessColumns", true);
+
+    ImGui::Text("Walk-forward");
+    int inSample = static_cast<int>(walkForwardSettings.inSampleCandles);
+    int outOfSample = static_cast<int>(walkForwardSettings.outOfSampleCandles);
+    int warmup = static_cast<int>(walkForwardSettings.warmupCandles);
+    ImGui::SetNextItemWidth(100);
+    if (ImGui::InputInt("In-sample", &inSample)) walkForwardSettings.inSampleCandles = std::max(1, inSample);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(100);
+    if (ImGui::InputInt("Out-of-sample", &outOfSample)) walkForwardSettings.outOfSampleCandles = std::max(1, outOfSample);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(100);
+    if (ImGui::InputInt("Warm-up##WalkForward", &warmup)) walkForwardSettings.warmupCandles = std::max(0, warmup);
+
+    if (walkForwardRun.valid() && walkForwardRun.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        walkForwardReport = walkForwardRun.get();
+    }
+    if (walkForwardRun.valid()) {
+        ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "Walk-forward running...");
+    }
+    else if (ImGui::Button("Run walk-forward")) {
+        startWalkForward();
+    }
+
+    if (walkForwardReport.ok) {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%zu windows, %.0f ms",
+            walkForwardReport.outOfSample.size(), walkForwardReport.elapsedMs);
+
+        ImVec4 color = walkForwardReport.outOfSamplePnL >= 0 ? ImVec4(0.0f, 0.8f, 0.0f, 1.0f) : ImVec4(1.0f, 0.2f, 0.0f, 1.0f);
+        ImGui::TextColored(color, "OOS PnL $%.2f", walkForwardReport.outOfSamplePnL);
+        ImGui::SameLine();
+        ImGui::Text("| %zu/%zu profitable | efficiency %.2f", walkForwardReport.profitableWindows,
+            walkForwardReport.outOfSample.size(), walkForwardReport.efficiency);
+
+        ImGui::BeginChild("WalkForwardWindows", ImVec2(0, 0), true);
+        ImGui::Columns(5, "WalkForwardTable", true);
+        ImGui::Text("Window"); ImGui::NextColumn();
+        ImGui::Text("IS PnL"); ImGui::NextColumn();
+        ImGui::Text("OOS PnL"); ImGui::NextColumn();
+        ImGui::Text("OOS Win %%"); ImGui::NextColumn();
+        ImGui::Text("OOS DD %%"); ImGui::NextColumn();
+        ImGui::Separator();
+        for (size_t i = 0; i < walkForwardReport.outOfSample.size(); ++i) {
+            const RobustnessAnalysis::SegmentResult& is = walkForwardReport.inSample[i];
+            const RobustnessAnalysis::SegmentResult& oos = walkForwardReport.outOfSample[i];
+            ImGui::Text("%zu-%zu", oos.begin, oos.end); ImGui::NextColumn();
+            ImGui::Text("%.2f (%zu)", is.pnl, is.trades); ImGui::NextColumn();
+            ImGui::TextColored(oos.pnl >= 0 ? ImVec4(0.0f, 0.8f, 0.0f, 1.0f) : ImVec4(1.0f, 0.2f, 0.0f, 1.0f),
+                "%.2f (%zu)", oos.pnl, oos.trades); ImGui::NextColumn();
+            ImGui::Text("%.1f", oos.winRate); ImGui::NextColumn();
+            ImGui::Text("%.1f", oos.maxDrawdown); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::EndChild();
+    }
+
+    ImGui::NextColumn();
+
+    ImGui::Text("Monte Carlo (%zu closed trades)", stats->GetTrades().size());
+    int permutations = static_cast<int>(monteCarloSettings.permutations);
+    ImGui::SetNextItemWidth(100);
+    if (ImGui::InputInt("Permutations", &permutations, 1000, 10000)) {
+        monteCarloSettings.permutations = std::max(1, std::min(permutations, 1000000));
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Resample", &monteCarloSettings.resample);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Draw trades with replacement. Off only reorders them, so the final equity stays fixed.");
+    }
+
+    if (monteCarloRun.valid() && monteCarloRun.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        monteCarloReport = monteCarloRun.get();
+    }
+    if (monteCarloRun.valid()) {
+        ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "Monte Carlo running...");
+    }
+    else if (ImGui::Button("Run Monte Carlo")) {
+        startMonteCarlo();
+    }
+
+    if (monteCarloReport.ok) {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%zu runs, %.0f ms",
+            monteCarloReport.permutations, monteCarloReport.elapsedMs);
+
+        ImGui::Text("Backtest: equity $%.2f, max DD %.1f%% | P(loss) %.1f%%", monteCarloReport.actualFinalEquity,
+            monteCarloReport.actualMaxDrawdown, monteCarloReport.lossProbability * 100.0);
+
+        ImGui::BeginChild("MonteCarloPercentiles", ImVec2(0, 130), true);
+        ImGui::Columns(3, "MonteCarloTable", true);
+        ImGui::Text("Percentile"); ImGui::NextColumn();
+        ImGui::Text("Final equity"); ImGui::NextColumn();
+        ImGui::Text("Max DD %%"); ImGui::NextColumn();
+        ImGui::Separator();
+        for (size_t i = 0; i < RobustnessAnalysis::PERCENTILE_COUNT; ++i) {
+            ImGui::Text("P%.0f", RobustnessAnalysis::PERCENTILES[i]); ImGui::NextColumn();
+            ImGui::Text("$%.2f", monteCarloReport.finalEquity[i]); ImGui::NextColumn();
+            ImGui::Text("%.1f", monteCarloReport.maxDrawdown[i]); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::EndChild();
+
+        char overlay[64];
+        snprintf(overlay, sizeof(overlay), "Max drawdown 0-%.1f%%", monteCarloReport.drawdownHistogramMax);
+        ImGui::PlotHistogram("##DrawdownDistribution", monteCarloReport.drawdownHistogram.data(),
+            static_cast<int>(monteCarloReport.drawdownHistogram.size()), 0, overlay, 0.0f, FLT_MAX, ImVec2(-1, 80));
+    }
+
+    ImGui::Columns(1);
+}
+
 void BottomPanel::renderRuntimePerformanceTab() {
     if (!hasLoadedStrategy()) {
         ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "No strategy loaded");
@@ -581,8 +904,11 @@ void BottomPanel::renderRuntimePerformanceTab() {
     }
 
     if (ImGui::Button("Run")) {
-        if (!dataManager->getData().empty())
+        if (!dataManager->getData().empty()) {
             dataManager->SetRuntimeMode(true);
+            BybitWebSocketManager::getInstance().startPrivateStream(Config::getInstance().getBybitAPIKey(),
+                Config::getInstance().getBybitSignature(), Config::getInstance().bybitIsDemoMode());
+        }
     }
     ImGui::SameLine();
     if (ImGui::Button("Pause")) {
@@ -598,6 +924,13 @@ void BottomPanel::renderRuntimePerformanceTab() {
     ImGui::TextColored(isActive ? activeColor : inactiveColor,
         isActive ? "Active" : "Inactive");
 
+    WorkStealingExecutor::LatencyStats latency = WorkStealingExecutor::getInstance().getLatencyStats();
+    if (latency.samples > 0) {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Candle to decision p50: %.2f ms  p99: %.2f ms",
+            latency.p50Us / 1000.0, latency.p99Us / 1000.0);
+    }
+
     ImGui::Text("Strategy Performance: %s", loadedStrategy.c_str());
     ImGui::SameLine();
     if (ImGui::Button("Change Strategy")) {
@@ -728,6 +1061,32 @@ void BottomPanel::renderRuntimePerformanceTab() {
     ImGui::Separator();
     ImGui::Spacing();
 
+    Bybit::BybitAccountState& account = Bybit::BybitAccountState::getInstance();
+    ImGui::Text("Exchange Account:");
+    ImGui::SameLine();
+    ImGui::TextColored(account.isLive() ? activeColor : inactiveColor,
+        account.isLive() ? "Private stream live" : "Private stream offline");
+    if (account.isLive()) {
+        ImGui::BulletText("Equity: $%.2f  Available: $%.2f", account.getTotalEquity(), account.getAvailableBalance());
+        for (const auto& position : account.getPositions()) {
+            ImGui::BulletText("%s %s %.4f @ %.4f  Mark: %.4f  Liq: %.4f  uPnL: %.2f",
+                position.symbol.c_str(), position.side.c_str(), position.size, position.avgPrice,
+                position.markPrice, position.liqPrice, position.unrealisedPnl);
+        }
+        size_t openOrders = account.getOpenOrders().size();
+        if (openOrders > 0) ImGui::BulletText("Open orders: %zu", openOrders);
+    }
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    renderStrategyHostSection();
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
     if (ImGui::BeginChild("OrdersScrolling", ImVec2(0, 200), true)) {
         auto& orders = dataManager->GetRuntimeTradingStats()->GetOrders();
         auto& positions = dataManager->GetRuntimeTradingStats()->GetPositions();
@@ -937,6 +1296,135 @@ void BottomPanel::renderRuntimePerformanceTab() {
     }
 }
 
+void BottomPanel::renderStrategyHostSection() {
+    ImVec4 activeColor = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
+    ImVec4 inactiveColor = ImVec4(1.0f, 0.2f, 0.2f, 1.0f);
+    bool hostRunning = strategyHost && strategyHost->isRunning();
+
+    ImGui::Text("Strategy Host:");
+    ImGui::SameLine();
+    ImGui::TextColored(hostRunning ? activeColor : inactiveColor, hostRunning ? "Running" : "Stopped");
+
+    if (hostStop.valid()) {
+        if (hostStop.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ImGui::SameLine();
+            ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.0f, 1.0f), "Stopping...");
+            return;
+        }
+        hostStop.get();
+    }
+
+    ImGui::SetNextItemWidth(300);
+    ImGui::InputText("Symbols##HostSymbols", hostSymbols, sizeof(hostSymbols));
+    ImGui::SameLine();
+    if (!hostRunning) {
+        const char* barTypes[] = { "Klines", "Time (s)", "Tick", "Volume", "Dollar" };
+        ImGui::SetNextItemWidth(100);
+        ImGui::Combo("##HostBars", &hostBarType, barTypes, IM_ARRAYSIZE(barTypes));
+        if (hostBarType > 0) {
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(100);
+            ImGui::InputFloat("##HostBarSize", &hostBarSize, 0.0f, 0.0f, "%.2f");
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Order book##HostBook", &hostOrderBook);
+        ImGui::SameLine();
+        ImGui::Checkbox("Warm restart##HostSnapshots", &hostSnapshots);
+        ImGui::SameLine();
+
+        if (ImGui::Button("Run on symbols")) {
+            std::vector<std::string> symbols;
+            std::string current;
+            for (const char* c = hostSymbols; ; ++c) {
+                if (*c == ',' || *c == ' ' || *c == '\0') {
+                    if (!current.empty()) symbols.push_back(current);
+                    current.clear();
+                    if (*c == '\0') break;
+                }
+                else {
+                    current += (char)toupper((unsigned char)*c);
+                }
+            }
+
+            auto compiled = StrategyTemplate::compile(*dataManager->GetBlueprintManager());
+            if (compiled && !symbols.empty()) {
+                StrategyHost::Settings settings;
+                if (hostBarType > 0 && hostBarSize > 0.0f) {
+                    settings.tradeBars = true;
+                    settings.bars.type = static_cast<TradeBarType>(hostBarType - 1);
+                    settings.bars.size = hostBarSize;
+                }
+                if (hostOrderBook) {
+                    settings.orderBookDepth = 50;
+                }
+                if (hostSnapshots) {
+                    settings.snapshotDir = "Data/Snapshots/" + loadedStrategy;
+                }
+                strategyHost = std::make_unique<StrategyHost>(compiled, settings);
+                if (strategyHost->start(symbols)) {
+                    BybitWebSocketManager::getInstance().startPrivateStream(Config::getInstance().getBybitAPIKey(),
+                        Config::getInstance().getBybitSignature(), Config::getInstance().bybitIsDemoMode());
+                }
+                else {
+                    strategyHost.reset();
+                }
+            }
+        }
+    }
+    else if (ImGui::Button("Stop host")) {
+        std::shared_ptr<StrategyHost> stopping(std::move(strategyHost));
+        hostStop = std::async(std::launch::async, [stopping]() mutable {
+            stopping->stop();
+            stopping.reset();
+            });
+        attachedSymbol.clear();
+        return;
+    }
+
+    if (!hostRunning) return;
+
+    StrategyHost::PortfolioStats portfolio = strategyHost->getPortfolioStats();
+    ImGui::BulletText("Portfolio: %zu/%zu streaming  P&L: $%.2f  uP&L: $%.2f  Win: %.1f%%  Orders: %zu  Open: %zu",
+        portfolio.streaming, portfolio.symbols, portfolio.realizedPnL, portfolio.unrealizedPnL,
+        portfolio.winRate, portfolio.orders, portfolio.openPositions);
+    if (strategyHost->loadingSymbols() > 0) {
+        ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "Loading history of %zu symbols...", strategyHost->loadingSymbols());
+    }
+
+    for (const auto& stats : strategyHost->getAllSymbolStats()) {
+        bool attached = stats.symbol == attachedSymbol;
+        ImGui::PushID(stats.symbol.c_str());
+        if (ImGui::SmallButton(attached ? "Detach" : "Attach")) {
+            attachedSymbol = attached ? std::string() : stats.symbol;
+        }
+        ImGui::PopID();
+        ImGui::SameLine();
+        ImGui::Text("%s  Close: %.4f  Candles: %llu  Runs: %llu  P&L: $%.2f  uP&L: $%.2f  Orders: %zu",
+            stats.symbol.c_str(), stats.lastClose, (unsigned long long)stats.candles,
+            (unsigned long long)stats.evaluations, stats.realizedPnL, stats.unrealizedPnL, stats.orders);
+    }
+
+    if (attachedSymbol.empty()) return;
+
+    StrategyHost::AttachedInstance instance = strategyHost->attach(attachedSymbol);
+    if (!instance) {
+        attachedSymbol.clear();
+        return;
+    }
+
+    ImGui::Text("Attached: %s", instance.getSymbol().c_str());
+    if (ImGui::BeginChild("HostInstanceOrders", ImVec2(0, 120), true)) {
+        const auto& orders = instance.getTradingStats().GetOrders();
+        if (orders.empty()) {
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "No orders yet");
+        }
+        for (auto it = orders.rbegin(); it != orders.rend(); ++it) {
+            ImGui::Text("#%d  %.4f @ %.4f  x%.1f", it->id, it->quantity, it->price, it->leverage);
+        }
+    }
+    ImGui::EndChild();
+}
+
 void BottomPanel::renderSettingsTab() {
     ImGui::Text("Settings & Configuration");
     ImGui::Separator();
@@ -1007,7 +1495,11 @@ void BottomPanel::renderStrategySelectionPopup() {
                 if (ImGui::Button("Load Strategy", ImVec2(120, 30))) {
                     if (dataManager->GetBlueprintManager()) {
                         std::string fullPath = "Data/" + selectedStrategy;
-                        bool success = dataManager->GetBlueprintManager()->loadBlueprint(fullPath);
+                        bool success = false;
+                        onStrategyStrand([this, &fullPath, &success]() {
+                            backtestSession->end();
+                            success = dataManager->GetBlueprintManager()->loadBlueprint(fullPath);
+                            }, true);
                         
 
                         if (success) {
@@ -22,6 +22,9 @@
 #endif
 
 #include "../../../Public/TabManager/MainChartTab/MainChartTab.h"
+#include "../../../Public/Exchanges/Bybit/BybitOrderGateway.h"
+#include "../../../Public/Exchanges/Bybit/Bybitwebsocketmanager.h"
+#include "../../../Public/Chart/MappedCandleSeries.h"
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
 float clampfff(float v, float lo, float hi) {
@@ -45,6 +48,16 @@ MainChartTab::MainChartTab(const std::string& name, int id)
     log_messages.push_back("Ready for input");
     log_messages.push_back("Strategy control panel loaded");
 
+    // Strategy evaluation runs on the executor instead of the websocket thread that delivered the candle.
+    strategyStrand = WorkStealingExecutor::getInstance().createStrand(name);
+    bottomPanel.setStrategyStrand(strategyStrand);
+
+    // Margin order fills continue the strategy on the same strand as the candles.
+    std::shared_ptr<WorkStealingExecutor::Strand> strand = strategyStrand;
+    dataManager.SetStrategyPoster([strand](std::function<void()> task) {
+        WorkStealingExecutor::getInstance().post(strand, std::move(task));
+        });
+
     bybit_priceCollector.setOnNewCandleCallback([&](const BybitCandle& candle) {
         MarketData data;
         data.index = candle.index;
@@ -55,7 +68,9 @@ MainChartTab::MainChartTab(const std::string& name, int id)
         data.close = candle.close;
         data.volume = candle.volume;
 
-        dataManager.addCandle(data);
+        WorkStealingExecutor::getInstance().post(strategyStrand, [this, data]() {
+            dataManager.addCandle(data);
+            }, WorkStealingExecutor::Clock::now());
         });
 
     bybit_priceCollector.setOnCandleUpdateCallback([&](const BybitCandle& candle) {
@@ -68,11 +83,42 @@ MainChartTab::MainChartTab(const std::string& name, int id)
         data.close = candle.close;
         data.volume = candle.volume;
 
-        dataManager.UpdateLastCandle(data);
+        WorkStealingExecutor::getInstance().post(strategyStrand, [this, data]() {
+            dataManager.UpdateLastCandle(data);
+            }, WorkStealingExecutor::Clock::now());
         });
 
 }
 
+MainChartTab::~MainChartTab() {
+    dataManager.DetachLiveOrders();
+    bybit_priceCollector.stopRealtimeStream();
+    setOrderBookSymbol("");
+    WorkStealingExecutor::getInstance().waitIdle(strategyStrand);
+}
+
+void MainChartTab::setOrderBookSymbol(const std::string& symbol) {
+    std::string category = bybit_priceCollector.getCurrentCategoryName();
+    if (symbol == orderBookSymbol && category == orderBookCategory) return;
+
+    BybitWebSocketManager& manager = BybitWebSocketManager::getInstance();
+    if (!orderBookSymbol.empty()) {
+        manager.unsubscribeOrderBook(orderBookSymbol, orderBookCategory, ORDER_BOOK_DEPTH);
+        dataManager.SetOrderBook(nullptr);
+    }
+
+    orderBookSymbol = symbol;
+    orderBookCategory = category;
+    if (!orderBookSymbol.empty()) {
+        std::shared_ptr<const OrderBook> book = manager.subscribeOrderBook(orderBookSymbol, orderBookCategory, ORDER_BOOK_DEPTH);
+        if (!book) {
+            AddLogMessage("Failed to subscribe order book of " + orderBookSymbol);
+            orderBookSymbol.clear();
+        }
+        dataManager.SetOrderBook(book);
+    }
+}
+
 void MainChartTab::generateTestData(int count)
 {
     std::vector<MarketData> testData;
@@ -247,18 +293,84 @@ void MainChartTab::Render() {
                 name = tokenInput;
             }
 
+            WorkStealingExecutor::getInstance().waitIdle(strategyStrand);
             dataManager.clear();
 
             bybit_priceCollector.loadHistoricalData(10000);
             dataManager.GetChart()->resetView();
             bybit_priceCollector.startRealtimeStream();
+            setOrderBookSymbol(tokenInput);
         }
     }
 
     ImGui::SameLine();
     if (ImGui::Button("Clear Data")) {
-        dataManager.clear();
         bybit_priceCollector.stopRealtimeStream();
+        setOrderBookSymbol("");
+        WorkStealingExecutor::getInstance().waitIdle(strategyStrand);
+        dataManager.clear();
+    }
+
+    ImGui::SameLine();
+    ImGui::Text("CSV:");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(250);
+    ImGui::InputText("##csvpath", csvPathInput, IM_ARRAYSIZE(csvPathInput));
+
+    ImGui::SameLine();
+    if (ImGui::Button("Import CSV")) {
+        if (strlen(csvPathInput) > 0) {
+            bybit_priceCollector.stopRealtimeStream();
+            dataManager.detachMappedSeries();
+            if (dataManager.LoadSelectedCSVFile(csvPathInput)) {
+                dataManager.GetChart()->resetView();
+                AddLogMessage("Imported " + std::to_string(dataManager.size()) + " candles from " + csvPathInput);
+            }
+            else {
+                AddLogMessage(std::string("Failed to import ") + csvPathInput);
+            }
+        }
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Export CSV")) {
+        if (strlen(csvPathInput) > 0 && !dataManager.empty()) {
+            dataManager.SaveCSVFile(csvPathInput);
+        }
+    }
+
+    // A mapped file replaces the loaded candles as the backtest source; it is not drawn.
+    ImGui::SameLine();
+    if (ImGui::Button("Map file")) {
+        if (strlen(csvPathInput) > 0) {
+            bybit_priceCollector.stopRealtimeStream();
+            setOrderBookSymbol("");
+            WorkStealingExecutor::getInstance().waitIdle(strategyStrand);
+            dataManager.clear();
+            if (dataManager.attachMappedSeries(csvPathInput)) {
+                AddLogMessage("Mapped " + std::to_string(dataManager.getMappedSeries()->size()) + " candles from " + csvPathInput + " for backtesting");
+            }
+            else {
+                AddLogMessage(std::string("Failed to map ") + csvPathInput);
+            }
+        }
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Export mapped")) {
+        if (strlen(csvPathInput) > 0 && !dataManager.empty()) {
+            if (dataManager.exportMappedSeries(csvPathInput)) {
+                AddLogMessage("Wrote " + std::to_string(dataManager.size()) + " candles to " + csvPathInput);
+            }
+            else {
+                AddLogMessage(std::string("Failed to write ") + csvPathInput);
+            }
+        }
+    }
+
+    if (dataManager.hasMappedSeries()) {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(0.5f, 0.8f, 1.0f, 1.0f), "Mapped: %zu", dataManager.getMappedSeries()->size());
     }
 
     if (bybit_priceCollector.isLoading()) {
@@ -285,4 +397,5 @@ void MainChartTab::AddLogMessage(const std::string& message) {
 }
 
 void MainChartTab::LightUpdate() {
+    Bybit::BybitOrderGateway::getInstance().dispatchCompleted();
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+class CandlestickDataManager;
+
+// A backtest that stays open after its first pass. The blueprint, its variables and
+// the backtest TradingStatsManager keep their state, so candles appended later (live
+// stream, data top-up) are evaluated with resume() instead of reloading the blueprint
+// and replaying the whole history.
+//
+// Only closed candles are evaluated: the newest candle of the in-memory series may still
+// be forming, so it runs once a later candle follows it, and every candle runs exactly
+// once. Each resumed candle sees the same public series a full replay would show it. If
+// the candles already evaluated change (series cleared, replaced or backfilled in the
+// middle) the session ends and the next run starts from candle zero. A memory-mapped
+// series is fixed once attached, so all of it is evaluated and there is nothing to resume.
+//
+// start(), resume() and end() run on the thread that appends the candles; the counters
+// can be read from any thread.
+class BacktestSession {
+public:
+    explicit BacktestSession(CandlestickDataManager* dataManager);
+
+    // Loads the blueprint and evaluates every closed candle; the session stays open on success.
+    bool start(const std::string& blueprintPath);
+
+    // Evaluates the candles closed since the last pass; returns how many ran.
+    size_t resume();
+
+    void end();
+    bool isActive() const { return active; }
+
+    size_t getProcessedCount() const { return processed; }
+    size_t getPendingCount() const;
+
+private:
+    bool isPrefixIntact() const;
+    size_t closedCount() const;
+
+    CandlestickDataManager* dataManager;
+    std::string blueprintPath;
+    std::atomic<bool> active{ false };
+    bool mapped = false;
+    std::atomic<size_t> processed{ 0 };
+    uint64_t lastTimestamp = 0;
+};
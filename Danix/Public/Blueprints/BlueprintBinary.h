@@ -0,0 +1,86 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+// Compact binary blueprint format (.dxbp).
+//
+// Layout (little-endian):
+//   header      "DXBP", u16 version, u16 flags, u32 counts (strings, variables, nodes, pins, connections)
+//   strings     u32 length + bytes; every GUID, type and name is stored once and referenced by index
+//   variables   guid, name, u8 type, u8 global, u8 hasValue, value by type
+//   nodes       guid, type, name, f32 x, y, w, h, u32 dataLength + CBOR data, u16 inputs, u16 outputs
+//   pins        guid, u8 type, name, i32 int, f32 float, f64 double, u8 bool, string  (inputs then outputs, node order)
+//   connections u32 fromPin, u32 toPin  (indices into the pin table)
+class BlueprintBinary {
+public:
+    static constexpr uint16_t VERSION = 1;
+
+    struct PinRecord {
+        uint32_t guid = 0;
+        uint8_t type = 0;
+        uint32_t name = 0;
+        int32_t storedInt = 0;
+        float storedFloat = 0.0f;
+        double storedDouble = 0.0;
+        uint8_t storedBool = 0;
+        uint32_t storedString = 0;
+    };
+
+    struct NodeRecord {
+        uint32_t guid = 0;
+        uint32_t type = 0;
+        uint32_t name = 0;
+        float x = 0.0f, y = 0.0f, width = 0.0f, height = 0.0f;
+        std::vector<uint8_t> data;      // CBOR, empty when the node has no extra data
+        uint32_t firstPin = 0;
+        uint16_t inputCount = 0;
+        uint16_t outputCount = 0;
+    };
+
+    struct VariableRecord {
+        uint32_t guid = 0;
+        uint32_t name = 0;
+        uint8_t type = 0;
+        uint8_t global = 0;
+        uint8_t hasValue = 0;
+        int32_t intValue = 0;
+        float floatValue = 0.0f;
+        double doubleValue = 0.0;
+        uint8_t boolValue = 0;
+        uint32_t stringValue = 0;
+    };
+
+    struct ConnectionRecord {
+        uint32_t fromPin = 0;
+        uint32_t toPin = 0;
+    };
+
+    struct Graph {
+        std::vector<std::string> strings;
+        std::vector<VariableRecord> variables;
+        std::vector<NodeRecord> nodes;
+        std::vector<PinRecord> pins;
+        std::vector<ConnectionRecord> connections;
+
+        const std::string& str(uint32_t index) const { return strings[index]; }
+    };
+
+    static bool isBinary(const uint8_t* data, size_t size);
+
+    static bool fromJson(const nlohmann::json& blueprint, Graph& graph);
+    static void toJson(const Graph& graph, nlohmann::json& blueprint);
+
+    static void write(const Graph& graph, std::vector<uint8_t>& out);
+    static bool read(const uint8_t* data, size_t size, Graph& graph);
+
+    static bool jsonToBinary(const nlohmann::json& blueprint, std::vector<uint8_t>& out);
+    static bool binaryToJson(const uint8_t* data, size_t size, nlohmann::json& blueprint);
+
+    static bool readFile(const std::string& filename, std::vector<uint8_t>& out);
+    static bool writeFile(const std::string& filename, const std::vector<uint8_t>& data);
+
+    // Converts between formats; direction is picked from the input file's header.
+    static bool convertFile(const std::string& inputPath, const std::string& outputPath);
+};
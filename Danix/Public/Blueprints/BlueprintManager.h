@@ -3,6 +3,7 @@
 #include <vector>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 #include <fstream>
 #include "Node/Node.h"
 #include <nlohmann/json.hpp>
@@ -17,8 +18,16 @@ struct Connection {
 };
 
 class BlueprintManager {
+    friend class StrategyTemplate;
 private:
     std::map<std::string, std::unique_ptr<BasicNode>> nodes;
+    // Pin GUID -> owning node GUID and pin. Entries are checked against the live node on
+    // lookup, so one left behind by a renamed pin or a deleted node is never dereferenced.
+    struct PinRef {
+        std::string node_guid;
+        Pin* pin;
+    };
+    std::unordered_map<std::string, PinRef> pin_index;
     std::vector<Connection> connections;
     std::map<std::string, std::unique_ptr<Variable>> variables;
     CandlestickDataManager* dataManager;
@@ -81,6 +90,8 @@ public:
     bool loadBlueprint(const std::string& filename);
     nlohmann::json serializeToJson();
     bool deserializeFromJson(const nlohmann::json& json);
+    bool serializeToBinary(std::vector<uint8_t>& out);
+    bool deserializeFromBinary(const uint8_t* data, size_t size);
     void handleSelectionInput();
     void drawSelectionBox();
     void selectNodesInBox(ImVec2 min_pos, ImVec2 max_pos);
@@ -138,6 +149,10 @@ private:
     ImVec2 worldToScreen(ImVec2 world_pos);
 
     void restoreConnections(const nlohmann::json& connections_json);
+    void linkPins(PinOut* from_pin, PinIn* to_pin);
+
+    void indexNodePins(BasicNode* node);
+    void unindexNodePins(BasicNode* node);
 
     BasicNode* createAutoConverter(PinType from_type, PinType to_type, ImVec2 position);
 };
\ No newline at end of file
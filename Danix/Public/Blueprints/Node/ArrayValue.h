@@ -0,0 +1,198 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+
+template<typename T>
+struct ArrayStorage {
+    std::vector<T> items;
+    size_t head = 0;                // oldest element once a windowed array has wrapped
+    size_t window = 0;              // 0 = unbounded
+    std::atomic<int> refs{ 0 };
+};
+
+// Recycles array buffers per element type. A released buffer keeps its capacity, so
+// strategies that rebuild or copy arrays every candle stop allocating once warmed up.
+template<typename T>
+class ArrayPool {
+public:
+    static constexpr size_t MAX_FREE = 256;
+
+    static ArrayPool& getInstance() {
+        // Never destroyed: arrays owned by other statics may be released during shutdown.
+        static ArrayPool* pool = new ArrayPool();
+        return *pool;
+    }
+
+    ArrayStorage<T>* acquire() {
+        ArrayStorage<T>* storage = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_free.empty()) {
+                storage = m_free.back();
+                m_free.pop_back();
+            }
+        }
+        if (!storage) storage = new ArrayStorage<T>();
+        storage->refs.store(1, std::memory_order_relaxed);
+        return storage;
+    }
+
+    void release(ArrayStorage<T>* storage) {
+        storage->items.clear();
+        storage->head = 0;
+        storage->window = 0;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free.size() < MAX_FREE) {
+            m_free.push_back(storage);
+            return;
+        }
+        delete storage;
+    }
+
+private:
+    ArrayPool() = default;
+
+    std::mutex m_mutex;
+    std::vector<ArrayStorage<T>*> m_free;
+};
+
+// Value type behind ARRAY_* pins and array variables. Copies share the buffer and the
+// first write through a shared copy detaches it (copy-on-write). With a window set the
+// array becomes a ring buffer: pushing past the window overwrites the oldest element,
+// and index 0 is always the oldest element still held.
+template<typename T>
+class ArrayValue {
+public:
+    using const_reference = typename std::vector<T>::const_reference;
+
+    ArrayValue() = default;
+
+    ArrayValue(const ArrayValue& other) : m_storage(other.m_storage) {
+        if (m_storage) m_storage->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ArrayValue(ArrayValue&& other) noexcept : m_storage(other.m_storage) {
+        other.m_storage = nullptr;
+    }
+
+    ArrayValue& operator=(const ArrayValue& other) {
+        if (m_storage == other.m_storage) return *this;
+        if (other.m_storage) other.m_storage->refs.fetch_add(1, std::memory_order_relaxed);
+        release();
+        m_storage = other.m_storage;
+        return *this;
+    }
+
+    ArrayValue& operator=(ArrayValue&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        m_storage = other.m_storage;
+        other.m_storage = nullptr;
+        return *this;
+    }
+
+    ~ArrayValue() { release(); }
+
+    size_t size() const { return m_storage ? m_storage->items.size() : 0; }
+    bool empty() const { return size() == 0; }
+    size_t window() const { return m_storage ? m_storage->window : 0; }
+
+    const_reference operator[](size_t index) const {
+        const std::vector<T>& items = m_storage->items;
+        size_t slot = m_storage->head + index;
+        if (slot >= items.size()) slot -= items.size();
+        return items[slot];
+    }
+
+    const_reference at(size_t index) const { return (*this)[index]; }
+
+    void push_back(const T& value) {
+        ArrayStorage<T>& storage = mutate();
+        if (storage.window == 0 || storage.items.size() < storage.window) {
+            storage.items.push_back(value);
+            return;
+        }
+        storage.items[storage.head] = value;
+        storage.head = (storage.head + 1) % storage.window;
+    }
+
+    void erase(size_t index) {
+        if (index >= size()) return;
+        ArrayStorage<T>& storage = mutate();
+        linearize(storage);
+        storage.items.erase(storage.items.begin() + index);
+    }
+
+    void clear() {
+        if (!m_storage) return;
+        if (m_storage->refs.load(std::memory_order_acquire) > 1) {
+            // Someone else still reads the old contents; start over with a pooled buffer.
+            size_t window = m_storage->window;
+            release();
+            if (window > 0) mutate().window = window;
+            return;
+        }
+        m_storage->items.clear();
+        m_storage->head = 0;
+    }
+
+    // Limits the array to the last `window` elements (0 removes the limit).
+    void setWindow(size_t window) {
+        if (!m_storage && window == 0) return;
+        ArrayStorage<T>& storage = mutate();
+        linearize(storage);
+        if (window > 0 && storage.items.size() > window) {
+            storage.items.erase(storage.items.begin(), storage.items.end() - window);
+        }
+        storage.window = window;
+    }
+
+    void assign(const std::vector<T>& values) {
+        clear();
+        for (const auto& value : values) push_back(value);
+    }
+
+    std::vector<T> toVector() const {
+        std::vector<T> out;
+        out.reserve(size());
+        for (size_t i = 0; i < size(); ++i) out.push_back((*this)[i]);
+        return out;
+    }
+
+private:
+    ArrayStorage<T>& mutate() {
+        if (!m_storage) {
+            m_storage = ArrayPool<T>::getInstance().acquire();
+        }
+        else if (m_storage->refs.load(std::memory_order_acquire) > 1) {
+            ArrayStorage<T>* copy = ArrayPool<T>::getInstance().acquire();
+            copy->items.reserve(m_storage->items.size());
+            for (size_t i = 0; i < m_storage->items.size(); ++i) copy->items.push_back((*this)[i]);
+            copy->window = m_storage->window;
+            release();
+            m_storage = copy;
+        }
+        return *m_storage;
+    }
+
+    static void linearize(ArrayStorage<T>& storage) {
+        if (storage.head == 0) return;
+        std::rotate(storage.items.begin(), storage.items.begin() + storage.head, storage.items.end());
+        storage.head = 0;
+    }
+
+    void release() {
+        if (!m_storage) return;
+        if (m_storage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ArrayPool<T>::getInstance().release(m_storage);
+        }
+        m_storage = nullptr;
+    }
+
+    ArrayStorage<T>* m_storage = nullptr;
+};
@@ -5,6 +5,8 @@
 #include <imgui.h>
 #include <nlohmann/json.hpp>
 #include "../../GUI/Color.h"
+#include "../../Systems/Config/Numeric.h"
+#include "ArrayValue.h"
 
 class BlueprintManager;
 class BasicNode;
@@ -65,27 +67,27 @@ public:
     bool stored_bool = false;
     int stored_int = 0;
     std::string stored_string = "";
-    long double stored_double = 0.0L;
+    Real stored_double = 0.0;
 
     float default_stored_float = 0.0f;
     bool default_stored_bool = false;
     int default_stored_int = 0;
     std::string default_stored_string = "";
-    long double default_stored_double = 0.0L;
-    std::vector<float>* array_default_stored_float;
-    std::vector<bool>* array_default_stored_bool;
-    std::vector<int>* array_default_stored_int;
-    std::vector<std::string>* array_default_stored_string;
-    std::vector<long double>* array_default_stored_double;
-
-    std::vector<float>* array_stored_float;
-    std::vector<bool>* array_stored_bool;
-    std::vector<int>* array_stored_int;
-    std::vector<std::string>* array_stored_string;
-    std::vector<long double>* array_stored_double;
+    Real default_stored_double = 0.0;
+    ArrayValue<float>* array_default_stored_float = nullptr;
+    ArrayValue<bool>* array_default_stored_bool = nullptr;
+    ArrayValue<int>* array_default_stored_int = nullptr;
+    ArrayValue<std::string>* array_default_stored_string = nullptr;
+    ArrayValue<Real>* array_default_stored_double = nullptr;
+
+    ArrayValue<float>* array_stored_float = nullptr;
+    ArrayValue<bool>* array_stored_bool = nullptr;
+    ArrayValue<int>* array_stored_int = nullptr;
+    ArrayValue<std::string>* array_stored_string = nullptr;
+    ArrayValue<Real>* array_stored_double = nullptr;
 
     PinIn(const std::string& guid, const std::string& og, PinType t, const std::string& n)
-        : Pin(guid, og, t, n), linked_to(nullptr), stored_float(0.0f), stored_bool(false), stored_int(0), stored_string(""), stored_double(0.0L) {
+        : Pin(guid, og, t, n), linked_to(nullptr), stored_float(0.0f), stored_bool(false), stored_int(0), stored_string(""), stored_double(0.0) {
     }
 
     template<typename T>
@@ -110,15 +112,15 @@ public:
     bool stored_bool;
     int stored_int;
     std::string stored_string;
-    long double stored_double;
-    std::vector<float>* array_stored_float;
-    std::vector<bool>* array_stored_bool;
-    std::vector<int>* array_stored_int;
-    std::vector<std::string>* array_stored_string;
-    std::vector<long double>* array_stored_double;
+    Real stored_double;
+    ArrayValue<float>* array_stored_float = nullptr;
+    ArrayValue<bool>* array_stored_bool = nullptr;
+    ArrayValue<int>* array_stored_int = nullptr;
+    ArrayValue<std::string>* array_stored_string = nullptr;
+    ArrayValue<Real>* array_stored_double = nullptr;
 
     PinOut(const std::string& guid, const std::string& og, PinType t, const std::string& n)
-        : Pin(guid, og, t, n), stored_float(0.0f), stored_bool(false), stored_int(0), stored_string(""), stored_double(0.0L) {
+        : Pin(guid, og, t, n), stored_float(0.0f), stored_bool(false), stored_int(0), stored_string(""), stored_double(0.0) {
     }
 
     template<typename T>
@@ -135,22 +137,22 @@ public:
         else if constexpr (std::is_same_v<T, std::string>) {
             stored_string = value;
         }
-        else if constexpr (std::is_same_v<T, long double>) {
+        else if constexpr (std::is_same_v<T, Real>) {
             stored_double = value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<float>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
             array_stored_float = value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
             array_stored_bool = value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<int>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
             array_stored_int = value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
             array_stored_string = value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
             array_stored_double = value;
         }
         propagateValue();
@@ -170,22 +172,22 @@ public:
         else if constexpr (std::is_same_v<T, std::string>) {
             return stored_string;
         }
-        else if constexpr (std::is_same_v<T, long double>) {
+        else if constexpr (std::is_same_v<T, Real>) {
             return stored_double;
         }
-        else if constexpr (std::is_same_v<T, std::vector<float>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
             return array_stored_float;
         }
-        else if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
             return array_stored_bool;
         }
-        else if constexpr (std::is_same_v<T, std::vector<int>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
             return array_stored_int;
         }
-        else if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
             return array_stored_string;
         }
-        else if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+        else if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
             return array_stored_double;
         }
         return T{};
@@ -297,31 +299,31 @@ struct Variable {
     bool global = false;
     int intValue;
     float floatValue;
-    long double doubleValue;
+    Real doubleValue;
     bool boolValue;
     std::string stringValue;
 
-    std::vector<int> arrayIntValue;
-    std::vector<float> arrayFloatValue;
-    std::vector<long double> arrayDoubleValue;
-    std::vector<bool> arrayBoolValue;
-    std::vector<std::string> arrayStringValue;
+    ArrayValue<int> arrayIntValue;
+    ArrayValue<float> arrayFloatValue;
+    ArrayValue<Real> arrayDoubleValue;
+    ArrayValue<bool> arrayBoolValue;
+    ArrayValue<std::string> arrayStringValue;
 
     int def_intValue = 0;
     float def_floatValue = 0.0f;
-    long double def_doubleValue = 0.0L;
+    Real def_doubleValue = 0.0;
     bool def_boolValue = false;
     std::string def_stringValue = "";
 
     std::vector<int> def_arrayIntValue;
     std::vector<float> def_arrayFloatValue;
-    std::vector<long double> def_arrayDoubleValue;
+    std::vector<Real> def_arrayDoubleValue;
     std::vector<bool> def_arrayBoolValue;
     std::vector<std::string> def_arrayStringValue;
 
     Variable(const std::string& n, const std::string& g, PinType t, bool globalActive)
         : name(n), guid(g), type(t),global(globalActive), intValue(0), floatValue(0.0f),
-        doubleValue(0.0L), boolValue(false), stringValue("") {
+        doubleValue(0.0), boolValue(false), stringValue("") {
     }
 
     template<typename T>
@@ -332,7 +334,7 @@ struct Variable {
         else if constexpr (std::is_same_v<T, float>) {
             return floatValue;
         }
-        else if constexpr (std::is_same_v<T, long double>) {
+        else if constexpr (std::is_same_v<T, Real>) {
             return doubleValue;
         }
         else if constexpr (std::is_same_v<T, bool>) {
@@ -341,21 +343,6 @@ struct Variable {
         else if constexpr (std::is_same_v<T, std::string>) {
             return stringValue;
         }
-        else if constexpr (std::is_same_v<T, std::vector<int>*>) {
-            return arrayIntValue;
-        }
-        else if constexpr (std::is_same_v<T, std::vector<float>*>) {
-            return arrayFloatValue;
-        }
-        else if constexpr (std::is_same_v<T, std::vector<long double>*>) {
-            return arrayDoubleValue;
-        }
-        else if constexpr (std::is_same_v<T, std::vector<bool>*>) {
-            return arrayBoolValue;
-        }
-        else if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
-            return arrayStringValue;
-        }
         return T{};
     }
 
@@ -367,7 +354,7 @@ struct Variable {
         else if constexpr (std::is_same_v<T, float>) {
             floatValue = value;
         }
-        else if constexpr (std::is_same_v<T, long double>) {
+        else if constexpr (std::is_same_v<T, Real>) {
             doubleValue = value;
         }
         else if constexpr (std::is_same_v<T, bool>) {
@@ -376,20 +363,20 @@ struct Variable {
         else if constexpr (std::is_same_v<T, std::string>) {
             stringValue = value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<int>*>) {
-            arrayIntValue = value;
+        else if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
+            if (value) arrayIntValue = *value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<float>*>) {
-            arrayFloatValue = value;
+        else if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
+            if (value) arrayFloatValue = *value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<long double>*>) {
-            arrayDoubleValue = value;
+        else if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
+            if (value) arrayDoubleValue = *value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<bool>*>) {
-            arrayBoolValue = value;
+        else if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
+            if (value) arrayBoolValue = *value;
         }
-        else if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
-            arrayStringValue = value;
+        else if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
+            if (value) arrayStringValue = *value;
         }
     }
 
@@ -447,22 +434,22 @@ T PinIn::getValue() {
         else if constexpr (std::is_same_v<T, std::string>) {
             return linked_to->stored_string;
         }
-        else if constexpr (std::is_same_v<T, long double>) {
+        else if constexpr (std::is_same_v<T, Real>) {
             return linked_to->stored_double;
         }
-        if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+        if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
             return linked_to->array_stored_bool;
         }
-        if constexpr (std::is_same_v<T, std::vector<float>*>) {
+        if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
             return linked_to->array_stored_float;
         }
-        if constexpr (std::is_same_v<T, std::vector<int>*>) {
+        if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
             return linked_to->array_stored_int;
         }
-        if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+        if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
             return linked_to->array_stored_string;
         }
-        if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+        if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
             return linked_to->array_stored_double;
         }
     }
@@ -479,22 +466,22 @@ T PinIn::getValue() {
     else if constexpr (std::is_same_v<T, std::string>) {
         return default_stored_string;
     }
-    else if constexpr (std::is_same_v<T, long double>) {
+    else if constexpr (std::is_same_v<T, Real>) {
         return default_stored_double;
     }
-    if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
         return array_default_stored_bool;
     }
-    if constexpr (std::is_same_v<T, std::vector<float>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
         return array_default_stored_float;
     }
-    if constexpr (std::is_same_v<T, std::vector<int>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
         return array_default_stored_int;
     }
-    if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
         return array_default_stored_string;
     }
-    if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
         return array_default_stored_double;
     }
    
@@ -516,22 +503,22 @@ T PinIn::getDefaultValue() {
     else if constexpr (std::is_same_v<T, std::string>) {
         return default_stored_string;
     }
-    else if constexpr (std::is_same_v<T, long double>) {
+    else if constexpr (std::is_same_v<T, Real>) {
         return default_stored_double;
     }
-    if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
         return array_default_stored_bool;
     }
-    if constexpr (std::is_same_v<T, std::vector<float>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
         return array_default_stored_float;
     }
-    if constexpr (std::is_same_v<T, std::vector<int>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
         return array_default_stored_int;
     }
-    if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
         return array_default_stored_string;
     }
-    if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
         return array_default_stored_double;
     }
 
@@ -552,22 +539,22 @@ void PinIn::setValue(T value) {
     else if constexpr (std::is_same_v<T, std::string>) {
         stored_string = value;
     }
-    else if constexpr (std::is_same_v<T, long double>) {
+    else if constexpr (std::is_same_v<T, Real>) {
         stored_double = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
         array_stored_bool = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<float>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
         array_stored_float = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<int>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
         array_stored_int = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
         array_stored_string = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
         array_stored_double = value;
     }
 }
@@ -586,22 +573,22 @@ void PinIn::setDefaultValue(T value) {
     else if constexpr (std::is_same_v<T, std::string>) {
         default_stored_string = value;
     }
-    else if constexpr (std::is_same_v<T, long double>) {
+    else if constexpr (std::is_same_v<T, Real>) {
         default_stored_double = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<bool>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<bool>*>) {
         array_default_stored_bool = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<float>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<float>*>) {
         array_default_stored_float = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<int>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<int>*>) {
         array_default_stored_int = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<std::string>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<std::string>*>) {
         array_default_stored_string = value;
     }
-    if constexpr (std::is_same_v<T, std::vector<long double>*>) {
+    if constexpr (std::is_same_v<T, ArrayValue<Real>*>) {
         array_default_stored_double = value;
     }
 }
@@ -622,12 +609,12 @@ public:
 
     int intValue = 0;
     float floatValue = 0.f;
-    long double doubleValue = 0.0L;
+    Real doubleValue = 0.0;
     bool boolValue = false;
     std::string stringValue = "";
 
     ConstValueNode(const std::string& guid, const std::string& n, BlueprintManager* dManager) : type(PinType::INT), intValue(0), floatValue(0.0f),
-        doubleValue(0.0L), boolValue(false), stringValue(""), PureNode(guid, n, dManager) {}
+        doubleValue(0.0), boolValue(false), stringValue(""), PureNode(guid, n, dManager) {}
 
     bool isPure() const override { return true; }
     bool isLoop() const override { return false; }
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+class BasicNode;
+class BlueprintManager;
+
+using NodeFactory = std::unique_ptr<BasicNode>(*)(const std::string& guid, BlueprintManager* manager);
+
+// Table of blueprint node types keyed by getNodeType() name. Node classes register
+// themselves from Nodes.cpp with REGISTER_NODE_TYPE, so creating a node by name is
+// a single hash lookup instead of a string comparison per known type.
+class NodeRegistry {
+public:
+    static NodeRegistry& getInstance();
+
+    bool registerType(const char* typeName, NodeFactory factory);
+
+    // Accepts the serialized type name ("RSINode") or the menu name without
+    // the "Node" suffix ("RSI"). Returns nullptr for unknown types.
+    std::unique_ptr<BasicNode> create(const std::string& typeName, const std::string& guid, BlueprintManager* manager) const;
+
+    NodeFactory getFactory(const std::string& typeName) const;
+    bool contains(const std::string& typeName) const;
+    std::vector<std::string> getTypeNames() const;
+    size_t size() const { return m_factories.size(); }
+
+private:
+    NodeRegistry() = default;
+    NodeRegistry(const NodeRegistry&) = delete;
+    NodeRegistry& operator=(const NodeRegistry&) = delete;
+
+    std::unordered_map<std::string, NodeFactory> m_factories;
+};
+
+#define REGISTER_NODE_TYPE(NodeClass) \
+    static const bool NodeClass##_registered = NodeRegistry::getInstance().registerType(#NodeClass, \
+        [](const std::string& guid, BlueprintManager* manager) -> std::unique_ptr<BasicNode> { \
+            return std::make_unique<NodeClass>(guid, manager); \
+        })
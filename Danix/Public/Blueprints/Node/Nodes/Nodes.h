@@ -673,6 +673,14 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
 };
 
+class WindowIntArrayElementNode : public ExecNode {
+public:
+    WindowIntArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
+};
+
 class GetFloatArrayElementNode : public PureNode {
 public:
     GetFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
@@ -713,6 +721,14 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
 };
 
+class WindowFloatArrayElementNode : public ExecNode {
+public:
+    WindowFloatArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
+};
+
 class GetDoubleArrayElementNode : public PureNode {
 public:
     GetDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
@@ -753,6 +769,14 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
 };
 
+class WindowDoubleArrayElementNode : public ExecNode {
+public:
+    WindowDoubleArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
+};
+
 class GetBoolArrayElementNode : public PureNode {
 public:
     GetBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
@@ -793,6 +817,14 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
 };
 
+class WindowBoolArrayElementNode : public ExecNode {
+public:
+    WindowBoolArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
+};
+
 class GetStringArrayElementNode : public PureNode {
 public:
     GetStringArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
@@ -833,6 +865,14 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
 };
 
+class WindowStringArrayElementNode : public ExecNode {
+public:
+    WindowStringArrayElementNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::ARRAY; }
+};
+
 class ForLoopNode : public ExecNode {
 public:
     ForLoopNode(const std::string& guid, BlueprintManager* dManager = nullptr);
@@ -874,6 +914,14 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::CHART; }
 };
 
+class GetTimeframeCandleNode : public PureNode {
+public:
+    GetTimeframeCandleNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType()const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::CHART; }
+};
+
 class GetCurrentCandleIndexNode : public PureNode {
 public:
     GetCurrentCandleIndexNode(const std::string& guid, BlueprintManager* dManager = nullptr);
@@ -1018,6 +1066,22 @@ public:
     NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::CHART; }
 };
 
+class OrderBookTopNode : public PureNode {
+public:
+    OrderBookTopNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::CHART; }
+};
+
+class OrderBookDepthNode : public PureNode {
+public:
+    OrderBookDepthNode(const std::string& guid, BlueprintManager* dManager = nullptr);
+    void execute() override;
+    std::string getNodeType() const override;
+    NodeHeaderColor getHeaderColor() const override { return NodeHeaderColor::CHART; }
+};
+
 class BybiyMarginLongNode : public ExecNode {
 public:
     BybiyMarginLongNode(const std::string& guid, BlueprintManager* dManager = nullptr);
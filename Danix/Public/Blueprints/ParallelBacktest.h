@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "../Chart/CandleChartManager.h"
+
+class StrategyTemplate;
+class TradingStatsManager;
+
+// Backtest split into time shards that run on their own threads. Every shard gets an
+// isolated instance of the compiled strategy and first evaluates `warmupCandles`
+// candles before its range with throwaway stats, so global variables and indicator
+// windows have converged when its own range starts. A position opened in a shard's
+// range belongs to that shard; the shard keeps evaluating past its range until all of
+// its positions are closed. The results are stitched into one TradingStatsManager.
+//
+// The stitched result equals the serial run for strategies that are flat at the shard
+// boundaries and whose state reaches back at most the warm-up. Each shard also starts
+// with the full starting balance, so balance-dependent sizing can differ. The stitched
+// balance replays the orders' cash flows and takes each commission once; a serial run
+// closing several margin positions with one order is charged its commission per position.
+// Set verify to run the serial backtest as well and report how far the two are apart.
+class ParallelBacktest {
+public:
+    struct Settings {
+        size_t shards = 4;
+        size_t warmupCandles = 1000;
+        bool verify = false;
+    };
+
+    struct ShardReport {
+        size_t begin = 0;               // first candle of the shard's own range
+        size_t end = 0;                 // one past its last candle
+        size_t warmup = 0;              // candles evaluated before begin
+        size_t runoff = 0;              // candles evaluated past end to close positions
+        bool flatAtStart = true;        // warm-up left no position open at begin
+        size_t positions = 0;           // positions kept in the stitched result
+        double elapsedMs = 0.0;
+    };
+
+    struct Report {
+        bool ok = false;
+        size_t candles = 0;
+        double elapsedMs = 0.0;
+        std::vector<ShardReport> shards;
+
+        bool verified = false;
+        double serialMs = 0.0;
+        size_t serialTrades = 0;        // closed positions
+        size_t shardedTrades = 0;
+        double serialPnL = 0.0;
+        double shardedPnL = 0.0;
+        double serialBalance = 0.0;
+        double shardedBalance = 0.0;
+        size_t mismatchedTrades = 0;    // closed positions found in only one of the runs
+    };
+
+    // Starting balance and commissions are taken from `result`, which then receives the
+    // stitched orders and positions.
+    static Report run(const StrategyTemplate& strategy, CandleSeriesView series,
+        const Settings& settings, TradingStatsManager& result);
+};
@@ -0,0 +1,86 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "../Chart/CandleChartManager.h"
+
+class StrategyTemplate;
+class TradingStatsManager;
+struct Trade;
+
+// Robustness checks of a compiled strategy. Both block the caller and spread the work over
+// threads of their own, one per core, so the shared WorkStealingExecutor stays free for
+// live strategies.
+//
+// Walk-forward rolls an in-sample window followed by an out-of-sample window over the
+// series, advancing by the out-of-sample length. Strategies carry no optimisable
+// parameters, so both segments evaluate the same blueprint; the comparison shows whether
+// the in-sample result holds up on the candles that follow it. Every window runs on its
+// own instance and starts with a warm-up, and each segment starts flat with the full
+// starting balance.
+//
+// Monte Carlo resamples the closed trades of a backtest into new sequences and reports
+// the distribution of the final equity and the maximum drawdown.
+class RobustnessAnalysis {
+public:
+    static constexpr size_t PERCENTILE_COUNT = 5;
+    static constexpr double PERCENTILES[PERCENTILE_COUNT] = { 5.0, 25.0, 50.0, 75.0, 95.0 };
+    static constexpr size_t DRAWDOWN_BINS = 40;
+
+    struct SegmentResult {
+        size_t begin = 0;
+        size_t end = 0;
+        double pnl = 0.0;               // realized
+        double winRate = 0.0;
+        size_t trades = 0;              // closed positions
+        double maxDrawdown = 0.0;       // percent of the peak balance
+    };
+
+    struct WalkForwardSettings {
+        size_t inSampleCandles = 5000;
+        size_t outOfSampleCandles = 1000;
+        size_t warmupCandles = 1000;
+    };
+
+    struct WalkForwardReport {
+        bool ok = false;
+        std::vector<SegmentResult> inSample;
+        std::vector<SegmentResult> outOfSample;
+        double outOfSamplePnL = 0.0;
+        size_t profitableWindows = 0;   // windows with a positive out-of-sample PnL
+        double efficiency = 0.0;        // out-of-sample PnL per candle / in-sample PnL per candle
+        double elapsedMs = 0.0;
+    };
+
+    struct MonteCarloSettings {
+        size_t permutations = 5000;
+        bool resample = true;           // draw with replacement; false only reorders the trades
+        uint64_t seed = 0;              // 0 = random
+    };
+
+    struct MonteCarloReport {
+        bool ok = false;
+        size_t trades = 0;
+        size_t permutations = 0;
+        double startingBalance = 0.0;
+        double finalEquity[PERCENTILE_COUNT] = {};
+        double maxDrawdown[PERCENTILE_COUNT] = {};
+        double lossProbability = 0.0;   // share of runs ending below the starting balance
+        double actualFinalEquity = 0.0; // the backtest's own trade order
+        double actualMaxDrawdown = 0.0;
+        std::vector<float> drawdownHistogram;
+        double drawdownHistogramMax = 0.0;
+        double elapsedMs = 0.0;
+    };
+
+    // Starting balance and commissions are taken from `config`.
+    static WalkForwardReport walkForward(const StrategyTemplate& strategy, CandleSeriesView series,
+        const WalkForwardSettings& settings, const TradingStatsManager& config);
+
+    static MonteCarloReport monteCarlo(const std::vector<Trade>& trades, double startingBalance,
+        const MonteCarloSettings& settings);
+
+    // Largest peak-to-trough fall of an equity curve, in percent of the peak.
+    static double maxDrawdownPercent(const std::vector<double>& equity);
+};
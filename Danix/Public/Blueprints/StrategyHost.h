@@ -0,0 +1,159 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "StrategyTemplate.h"
+#include "BlueprintManager.h"
+#include "../Chart/CandleChartManager.h"
+#include "../StatsManager/TradingStatsManager.h"
+#include "../Exchanges/Bybit/BybitPriceCollector.h"
+#include "../Exchanges/Bybit/BybitTradeAggregator.h"
+#include "../Systems/WorkStealingExecutor.h"
+
+// Runs one compiled strategy across a universe of symbols without a chart tab.
+// Every symbol gets its own data manager, stats and BlueprintManager instance; candles
+// arriving from BybitWebSocketManager are posted to the symbol's strand on the shared
+// WorkStealingExecutor. Candles of one symbol are processed strictly in arrival order,
+// different symbols run in parallel on all cores.
+//
+// Order fills are handed from whichever thread calls BybitOrderGateway::dispatchCompleted()
+// (the UI frame loop in the app; a headless host sets dispatchFills and drains the gateway
+// on its own thread) to the symbol's strand, so they update runtime stats and run the
+// On Filled nodes in order with the candles. Fills of a removed symbol are dropped.
+class StrategyHost {
+public:
+    struct Settings {
+        BybitInterval interval = BybitInterval::MIN_1;
+        BybitCategory category = BybitCategory::LINEAR;
+        size_t historyLimit = 1000;
+        double startingBalance = 10000.0;
+        bool dispatchFills = false;         // drain BybitOrderGateway callbacks on the host thread
+        bool tradeBars = false;             // build bars from publicTrade instead of klines (no history)
+        TradeBarSpec bars;
+        int orderBookDepth = 0;             // orderbook.{depth} for the order book nodes, 0 = none
+        std::string snapshotDir;            // per-symbol StrategySnapshot files, empty = off
+        int snapshotIntervalSec = 60;
+    };
+
+    struct SymbolStats {
+        std::string symbol;
+        bool streaming = false;
+        uint64_t candles = 0;               // confirmed candles received
+        uint64_t evaluations = 0;           // strategy runs
+        double lastClose = 0.0;
+        double realizedPnL = 0.0;
+        double unrealizedPnL = 0.0;
+        double winRate = 0.0;
+        size_t orders = 0;
+        size_t openPositions = 0;
+        size_t trades = 0;
+        double startingBalance = 0.0;
+        double currentBalance = 0.0;
+    };
+
+    struct PortfolioStats {
+        size_t symbols = 0;
+        size_t streaming = 0;
+        double realizedPnL = 0.0;
+        double unrealizedPnL = 0.0;
+        double winRate = 0.0;               // weighted by closed trades
+        size_t orders = 0;
+        size_t openPositions = 0;
+        size_t trades = 0;
+        double startingBalance = 0.0;
+        double currentBalance = 0.0;
+    };
+
+    class Instance;
+
+    // Exclusive view of one instance for the UI. The strategy for that symbol does not
+    // run while the view is held, so keep it for the duration of a frame at most.
+    class AttachedInstance {
+    public:
+        AttachedInstance() = default;
+        explicit operator bool() const { return instance != nullptr; }
+
+        const std::string& getSymbol() const;
+        CandlestickDataManager& getDataManager();
+        BlueprintManager& getBlueprintManager();
+        TradingStatsManager& getTradingStats();
+
+    private:
+        friend class StrategyHost;
+        Instance* instance = nullptr;
+        std::unique_lock<std::mutex> lock;
+    };
+
+    StrategyHost(std::shared_ptr<const StrategyTemplate> strategy, const Settings& settings);
+    explicit StrategyHost(std::shared_ptr<const StrategyTemplate> strategy);
+    ~StrategyHost();
+
+    StrategyHost(const StrategyHost&) = delete;
+    StrategyHost& operator=(const StrategyHost&) = delete;
+
+    // Returns at once; history of the symbols is loaded in parallel on a loader thread and
+    // each symbol starts streaming when its history is in. The host stops by itself if no
+    // symbol could be started.
+    bool start(const std::vector<std::string>& symbols);
+    void stop();
+    bool isRunning() const { return running.load(); }
+    size_t loadingSymbols() const { return loading.load(); }
+
+    // Loads history and subscribes on the calling thread.
+    bool addSymbol(const std::string& symbol);
+    void removeSymbol(const std::string& symbol);
+    std::vector<std::string> getSymbols() const;
+
+    AttachedInstance attach(const std::string& symbol);
+
+    // The trading figures are published from the strand after every evaluation and fill,
+    // so these never wait for a strategy; unrealized P&L uses the last evaluated close.
+    bool getSymbolStats(const std::string& symbol, SymbolStats& stats) const;
+    std::vector<SymbolStats> getAllSymbolStats() const;
+    PortfolioStats getPortfolioStats() const;
+
+    size_t pendingJobs() const;
+
+    // Candle-to-decision latency of all strands on the executor.
+    WorkStealingExecutor::LatencyStats getLatencyStats() const;
+
+    // Each snapshot is taken under the symbol's runMutex, so it never sees an evaluation
+    // or fill half done. With snapshotDir set the host thread also saves them every
+    // snapshotIntervalSec on its own.
+    void saveSnapshots();
+
+private:
+    std::shared_ptr<Instance> createInstance(const std::string& symbol);
+    void releaseOrderBook(Instance& instance);
+    std::string snapshotPath(const std::string& symbol) const;
+    void saveSnapshot(Instance& instance);
+    void restoreSnapshot(Instance& instance);
+    void onCandle(const std::shared_ptr<Instance>& instance, const BybitCandle& candle);
+    void onCandleUpdate(const std::shared_ptr<Instance>& instance, const BybitCandle& candle);
+    void dispatchLoop();
+    void maintainSnapshots(std::chrono::steady_clock::time_point& lastSnapshot);
+    void loadLoop(std::vector<std::string> symbols);
+    void detachInstance(Instance& instance);
+    static void publishStats(Instance& instance);
+    static void collectStats(Instance& instance, SymbolStats& stats);
+
+    std::shared_ptr<const StrategyTemplate> strategy;
+    Settings settings;
+
+    mutable std::mutex instancesMutex;
+    std::map<std::string, std::shared_ptr<Instance>> instances;
+
+    std::thread dispatchThread;
+    std::thread loaderThread;
+    std::atomic<bool> running{ false };
+    std::atomic<bool> stopping{ false };
+    std::atomic<size_t> loading{ 0 };
+
+    static constexpr int DISPATCH_INTERVAL_MS = 50;
+    static constexpr size_t HISTORY_LOADERS = 8;    // concurrent history requests
+};
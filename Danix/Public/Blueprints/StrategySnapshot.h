@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class BlueprintManager;
+class TradingStatsManager;
+
+// Binary snapshot (.dxss) of a running strategy instance for warm restarts: global
+// variable values, the complete TradingStatsManager state and the timestamp of the
+// last evaluated candle. Indicator nodes recompute from the candle history that is
+// loaded on start anyway, and the per-tick indicator cache is rebuilt on the first
+// candle, so neither is stored.
+//
+// Layout (little-endian):
+//   header     "DXSS", u16 version, u16 flags, u64 last candle, u64 saved at (unix ms), symbol
+//   variables  u32 count; guid, u8 type, value by type (arrays: u32 window, u32 count, items)
+//   stats      balances and counters, orders, positions, balance history
+//   strings    u32 length + bytes
+//
+// Variables are matched by GUID on restore; ones the blueprint no longer has are skipped.
+class StrategySnapshot {
+public:
+    static constexpr uint16_t VERSION = 1;
+
+    struct Info {
+        std::string symbol;
+        uint64_t lastCandle = 0;
+        uint64_t savedAt = 0;
+        size_t variables = 0;       // restored variables
+        size_t skipped = 0;         // variables in the snapshot the blueprint does not have
+    };
+
+    static void capture(const BlueprintManager& blueprint, const TradingStatsManager& stats,
+        const std::string& symbol, uint64_t lastCandle, std::vector<uint8_t>& out);
+    static bool restore(const uint8_t* data, size_t size, BlueprintManager& blueprint,
+        TradingStatsManager& stats, Info& info);
+
+    // Written to a temporary file first, so a crash mid-write keeps the previous snapshot.
+    static bool save(const std::string& filename, const BlueprintManager& blueprint,
+        const TradingStatsManager& stats, const std::string& symbol, uint64_t lastCandle);
+    static bool load(const std::string& filename, BlueprintManager& blueprint,
+        TradingStatsManager& stats, Info& info);
+};
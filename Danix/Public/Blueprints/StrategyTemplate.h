@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include "BlueprintBinary.h"
+#include "Node/NodeRegistry.h"
+
+class BlueprintManager;
+class CandlestickDataManager;
+
+// Immutable, compiled form of a blueprint. Node factories, decoded node data,
+// pin GUIDs and the connection plan are resolved once; instantiate() then builds
+// an isolated BlueprintManager with its own node, pin and variable state without
+// going through JSON or GUID lookups, and without generating GUIDs the template
+// already has. A template is safe to share between threads.
+class StrategyTemplate {
+public:
+    static std::shared_ptr<const StrategyTemplate> compile(BlueprintManager& source);
+    static std::shared_ptr<const StrategyTemplate> compileFile(const std::string& filename);
+    static std::shared_ptr<const StrategyTemplate> compileGraph(BlueprintBinary::Graph graph);
+
+    std::unique_ptr<BlueprintManager> instantiate(CandlestickDataManager* dataManager) const;
+
+    // Replaces the contents of an existing manager (e.g. one owned by a chart tab).
+    bool instantiateInto(BlueprintManager& target) const;
+
+    size_t nodeCount() const { return m_nodes.size(); }
+    size_t connectionCount() const { return m_links.size(); }
+    const BlueprintBinary::Graph& graph() const { return m_graph; }
+
+private:
+    StrategyTemplate() = default;
+
+    struct CompiledNode {
+        uint32_t record;
+        NodeFactory factory;
+        nlohmann::json data;
+    };
+
+    struct CompiledLink {
+        uint32_t fromPin;
+        uint32_t toPin;
+        bool direct;        // same pin type and first link for the pin: wire without createConnection checks
+    };
+
+    BlueprintBinary::Graph m_graph;
+    std::vector<CompiledNode> m_nodes;
+    std::vector<CompiledLink> m_links;
+};
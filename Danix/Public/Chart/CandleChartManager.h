@@ -5,22 +5,86 @@
 
 #include <string>
 #include <mutex>
+#include <memory>
+#include <functional>
+#include <cstdint>
+#include <stdexcept>
+#include "IndicatorCache.h"
+#include "../Systems/Config/Numeric.h"
 
 
 struct MarketData {
     int index;
     uint64_t timestamp;
-    long double open;
-    long double high;
-    long double low;
-    long double close;
+    Real open;
+    Real high;
+    Real low;
+    Real close;
     float volume;
     float mcap;
 };
 
+// Non-owning read-only window over contiguous candles. Backed either by the
+// in-memory public_data vector or by a memory-mapped series.
+class CandleSeriesView {
+public:
+    CandleSeriesView() : m_data(nullptr), m_size(0) {}
+    CandleSeriesView(const MarketData* data, size_t size) : m_data(data), m_size(size) {}
+    CandleSeriesView(const std::vector<MarketData>& vec) : m_data(vec.data()), m_size(vec.size()) {}
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const MarketData* data() const { return m_data; }
+
+    const MarketData& operator[](size_t i) const { return m_data[i]; }
+    const MarketData& at(size_t i) const {
+        if (i >= m_size) throw std::out_of_range("CandleSeriesView::at");
+        return m_data[i];
+    }
+    const MarketData& front() const { return m_data[0]; }
+    const MarketData& back() const { return m_data[m_size - 1]; }
+
+    const MarketData* begin() const { return m_data; }
+    const MarketData* end() const { return m_data + m_size; }
+
+private:
+    const MarketData* m_data;
+    size_t m_size;
+};
+
 class CandlestickChart;
 class BlueprintManager;
 class TradingStatsManager;
+class MappedCandleSeries;
+class IndicatorBatch;
+class OrderBook;
+class CandleResampler;
+class CandlestickDataManager;
+
+// Route from an asynchronous order completion back to the data manager that placed it.
+// Completions are handed to the poster (the strategy's strand) and are dropped once the
+// data manager detached the handle on teardown, or when no poster was set. The owner
+// waits for the poster's thread to go idle after detaching before it frees the manager.
+class LiveOrderHandle {
+public:
+    using Task = std::function<void(CandlestickDataManager&)>;
+    using Poster = std::function<void(std::function<void()>)>;
+
+    explicit LiveOrderHandle(CandlestickDataManager* owner) : dataManager(owner) {}
+
+    static void deliver(const std::shared_ptr<LiveOrderHandle>& handle, Task task);
+
+    void setPoster(Poster newPoster);
+    void detach();
+
+private:
+    void run(const Task& task);
+
+    std::mutex mutex;
+    CandlestickDataManager* dataManager;
+    Poster poster;
+};
+
 class CandlestickDataManager {
 private:
     std::string symbol;
@@ -28,12 +92,32 @@ private:
     std::vector<MarketData> public_data;
     bool RuntimeMode = false;
     std::string token_key;
-    CandlestickChart* chart;
-    BlueprintManager* dataManager;
-    TradingStatsManager* backtestStatsManager;
-    TradingStatsManager* runtimeStatsManager;
+    CandlestickChart* chart = nullptr;
+    BlueprintManager* dataManager = nullptr;
+    TradingStatsManager* backtestStatsManager = nullptr;
+    TradingStatsManager* runtimeStatsManager = nullptr;
+
+    std::shared_ptr<MappedCandleSeries> mappedSeries;
+    CandleSeriesView attachedSeries;
+    size_t mappedVisible = 0;
+
+    std::unique_ptr<IndicatorBatch> indicatorBatch;
+
+    // Bumped on every mutation of the candle store; keys the indicator cache.
+    uint64_t seriesVersion = 0;
+    IndicatorCache indicatorCache;
+
+    // Higher timeframes of the public series, created on first use.
+    std::unique_ptr<CandleResampler> resampler;
+
+    // Live book of the symbol, shared with BybitWebSocketManager; null when not subscribed.
+    // Swapped by the UI while the strategy reads it, so only accessed with atomic_load/store.
+    std::shared_ptr<const OrderBook> orderBook;
+
+    std::shared_ptr<LiveOrderHandle> liveOrders;
 public:
     CandlestickDataManager();
+    ~CandlestickDataManager();
     void addData(const std::vector<MarketData>& newData);
 
     void addCandle(const MarketData& candle);
@@ -44,7 +128,7 @@ public:
 
     std::vector<MarketData> getDataRange(size_t start, size_t end) const;
 
-    const std::vector<MarketData>& getPublicData() const;
+    CandleSeriesView getPublicData() const;
     std::vector<MarketData>* getPublicDataPtr();
     std::vector<MarketData> getPublicDataRange(size_t start, size_t end) const;
 
@@ -56,10 +140,40 @@ public:
 
     std::pair<double, double> getPriceRange(size_t start = 0, size_t end = SIZE_MAX) const;
 
-    void SaveCSVFile(const std::string& filename);
-    void LoadSelectedCSVFile(const std::string& filename);
+    // Memory-mapped backtest source. While attached, getPublicData() exposes the
+    // first mappedVisible candles of the file instead of public_data.
+    bool attachMappedSeries(const std::string& filename);
+    void detachMappedSeries();
+    bool hasMappedSeries() const { return mappedSeries != nullptr; }
+    MappedCandleSeries* getMappedSeries() { return mappedSeries.get(); }
+    // Keeps the mapping alive for a background run after it is detached here.
+    std::shared_ptr<const MappedCandleSeries> shareMappedSeries() const { return mappedSeries; }
+    bool exportMappedSeries(const std::string& filename) const;
+    void setMappedVisibleCount(size_t count);
+
+    // Candles owned by the caller, used like a mapped series: getPublicData() exposes the
+    // first setMappedVisibleCount() of them and the indicator batch covers all of them.
+    // They must outlive the attachment; detachMappedSeries() ends it.
+    void attachSeriesView(CandleSeriesView series);
+
+    // Precomputed indicator columns over the full backtest series (mapped file or data).
+    // Nodes use them while the batch exists; the backtest loop brackets itself with these.
+    void beginIndicatorBatch();
+    void endIndicatorBatch();
+    IndicatorBatch* GetIndicatorBatch() { return indicatorBatch.get(); }
+
+    uint64_t GetSeriesVersion() const { return seriesVersion; }
+    // Indicator results already computed for the current series state.
+    IndicatorCache& GetIndicatorCache();
+
+    // Public series resampled to 5, 15, 60, 240 or 1440 minutes; empty for any other value.
+    CandleSeriesView GetTimeframeSeries(int minutes);
+
+    bool SaveCSVFile(const std::string& filename);
+    // Leaves the public series empty; a backtest or runtime mode fills it from the data.
+    bool LoadSelectedCSVFile(const std::string& filename);
     bool RuntimeModeIsActive() { return RuntimeMode; }
-    void SetRuntimeMode(bool newMode) { RuntimeMode = newMode; }
+    void SetRuntimeMode(bool newMode);
 
     void SetChart(CandlestickChart* newChart) { chart = newChart; }
     CandlestickChart* GetChart() { return chart; }
@@ -78,4 +192,14 @@ public:
 
     void SetSymbol(std::string newSymbol) { symbol = newSymbol; }
     std::string GetSymbol() { return symbol; }
+
+    void SetOrderBook(std::shared_ptr<const OrderBook> newBook) { std::atomic_store(&orderBook, std::move(newBook)); }
+    // Null outside runtime mode: a backtest must not see today's book on historical candles.
+    std::shared_ptr<const OrderBook> GetOrderBook() const { return RuntimeMode ? std::atomic_load(&orderBook) : nullptr; }
+
+    // Order callbacks hold this handle instead of the data manager itself.
+    std::shared_ptr<LiveOrderHandle> GetLiveOrderHandle() { return liveOrders; }
+    void SetStrategyPoster(LiveOrderHandle::Poster poster) { liveOrders->setPoster(std::move(poster)); }
+    // Drops completions still in flight; called before the strategy's thread goes away.
+    void DetachLiveOrders() { liveOrders->detach(); }
 };
\ No newline at end of file
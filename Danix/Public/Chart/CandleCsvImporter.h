@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "CandleChartManager.h"
+
+struct CsvImportStats {
+    size_t bytes = 0;
+    size_t rows = 0;
+    size_t skippedRows = 0;
+    size_t duplicateRows = 0;
+    unsigned threads = 0;
+    bool reordered = false;
+    double seconds = 0.0;
+
+    double throughputMBs() const { return seconds > 0.0 ? (bytes / (1024.0 * 1024.0)) / seconds : 0.0; }
+};
+
+// Bulk candle importer for exchange CSV exports (Bybit, Binance, generic OHLCV).
+// Delimiter (',', ';', tab) and column order are detected from the first line;
+// headerless files are read as time,open,high,low,close,volume. Timestamps may be
+// seconds, milliseconds, micro/nanoseconds or ISO-8601 dates and are normalised to ms.
+class CandleCsvImporter {
+public:
+    static constexpr size_t MIN_BYTES_PER_THREAD = 4 * 1024 * 1024;
+
+    static bool load(const std::string& filename, std::vector<MarketData>& out, CsvImportStats* stats = nullptr);
+    static bool parse(const char* begin, const char* end, std::vector<MarketData>& out, CsvImportStats* stats = nullptr);
+    static bool save(const std::string& filename, const std::vector<MarketData>& candles);
+};
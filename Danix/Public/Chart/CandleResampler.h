@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "CandleChartManager.h"
+
+// Higher-timeframe candles derived from the base series of a data manager, so a
+// strategy on 1m candles can read 1h trend bars without a second download. Bars are
+// aligned to UTC like Bybit's own klines and built incrementally: every sync folds
+// only the base candles appended since the previous one, and re-folds the last one
+// because the forming candle is updated in place.
+//
+// The newest bar of each timeframe is still forming while its period is open.
+// Replacing or shrinking the base series rebuilds everything; edits in the middle of
+// the series are not detected.
+class CandleResampler {
+public:
+    enum class Timeframe {
+        MIN_5,
+        MIN_15,
+        HOUR_1,
+        HOUR_4,
+        DAY_1,
+        COUNT
+    };
+
+    static uint64_t periodMs(Timeframe timeframe);
+    static bool fromMinutes(int minutes, Timeframe& timeframe);
+
+    void sync(CandleSeriesView base, uint64_t version);
+    void reset();
+
+    CandleSeriesView getSeries(Timeframe timeframe) const;
+
+private:
+    struct Series {
+        std::vector<MarketData> bars;
+        bool lastOpened = false;        // the last fold started a new bar
+        MarketData lastPrevious{};      // bars.back() before the last fold otherwise
+    };
+
+    void fold(const MarketData& candle);
+    void undoLastFold();
+
+    Series m_series[static_cast<size_t>(Timeframe::COUNT)];
+    size_t m_consumed = 0;
+    uint64_t m_version = 0;
+    uint64_t m_firstTimestamp = 0;
+};
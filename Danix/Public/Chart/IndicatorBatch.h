@@ -0,0 +1,56 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <cstdint>
+#include "IndicatorKernels.h"
+
+// Indicator columns precomputed over a whole backtest series. Built once when the
+// backtest starts; the indicator nodes then read column[index] instead of rescanning
+// the window on every candle. A column is computed on first use for each parameter set.
+// Only valid while the visible series is a prefix of the series it was built from.
+class IndicatorBatch {
+public:
+    enum class Kind : uint8_t {
+        SMA,
+        RSI,
+        BOLLINGER,
+        STOCHASTIC,
+        CCI,
+        MFI
+    };
+
+    explicit IndicatorBatch(CandleSeriesView candles);
+
+    size_t size() const { return series.size(); }
+
+    const double* sma(int period);
+    const double* rsi(int period);
+    const double* cci(int period);
+    const double* mfi(int period);
+
+    // Outputs are upper, middle, lower.
+    const std::vector<double>* bollinger(int period, double multiplier);
+    // Outputs are %K, %D.
+    const std::vector<double>* stochastic(int kPeriod, int dPeriod);
+
+private:
+    struct Key {
+        Kind kind;
+        int a;
+        int b;
+        double c;
+
+        bool operator<(const Key& other) const {
+            if (kind != other.kind) return kind < other.kind;
+            if (a != other.a) return a < other.a;
+            if (b != other.b) return b < other.b;
+            return c < other.c;
+        }
+    };
+
+    std::vector<double>* find(const Key& key, size_t outputs, bool& created);
+
+    IndicatorKernels::Series series;
+    std::map<Key, std::vector<std::vector<double>>> columns;
+};
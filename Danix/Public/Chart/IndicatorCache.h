@@ -0,0 +1,76 @@
+#pragma once
+
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include "../Systems/Config/Numeric.h"
+
+// Per-series memo of indicator results for the current tick. Nodes with the same
+// (kind, params, index) share one computation, and composite nodes reuse the parts
+// (EMA inside MACD, %K inside %D). Entries are tagged with the series version and
+// visible size; any change to either (new candle, tail update, backtest step) drops
+// them on the next access.
+class IndicatorCache {
+public:
+    enum class Kind : uint8_t {
+        SMA,
+        EMA,
+        RSI,
+        MACD,
+        BOLLINGER,
+        STOCHASTIC,
+        STOCHASTIC_K,
+        ATR,
+        CCI,
+        WILLIAMS_R,
+        MFI
+    };
+
+    struct Key {
+        Kind kind;
+        int a;
+        int b;
+        int index;
+        Real c;
+
+        bool operator==(const Key& other) const {
+            return kind == other.kind && a == other.a && b == other.b && index == other.index && c == other.c;
+        }
+    };
+
+    static constexpr size_t MAX_VALUES = 3;
+
+    // Drops every entry if the series changed since the last call.
+    void sync(uint64_t version, size_t size);
+
+    const Real* find(const Key& key) const;
+    void insert(const Key& key, std::initializer_list<Real> values);
+
+    size_t entries() const { return m_entries.size(); }
+    uint64_t hits() const { return m_hits; }
+    uint64_t misses() const { return m_misses; }
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            size_t h = std::hash<int>()(static_cast<int>(key.kind));
+            h = h * 31 + std::hash<int>()(key.a);
+            h = h * 31 + std::hash<int>()(key.b);
+            h = h * 31 + std::hash<int>()(key.index);
+            return h * 31 + std::hash<Real>()(key.c);
+        }
+    };
+
+    struct Values {
+        Real values[MAX_VALUES];
+    };
+
+    // Hashed: a loop over candle indices puts one entry per index into a single tick.
+    std::unordered_map<Key, Values, KeyHash> m_entries;
+    uint64_t m_version = 0;
+    size_t m_size = 0;
+    mutable uint64_t m_hits = 0;
+    mutable uint64_t m_misses = 0;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CandleChartManager.h"
+
+// Whole-series indicator kernels for backtests. Every output column has one value per
+// candle with the same warm-up defaults as the scalar nodes (e.g. RSI is 50 before
+// `period` candles). Kernels vectorise across candles: each SIMD lane evaluates one
+// index with the node's own summation order, so a lane is the scalar formula in double.
+//
+// Tolerance: with the default Real (double) results equal the node path bit for bit.
+// A DANIX_LONG_DOUBLE_MATH build on x87 rounds the node path differently and the two
+// agree to TOLERANCE, relative to max(1, |value|). The worst case is CCI on a window
+// whose mean deviation is at rounding level.
+//
+// The AVX path (4 doubles) is picked at runtime when the CPU supports it, otherwise
+// SSE2 (2 doubles) on x86-64, otherwise plain scalar code.
+class IndicatorKernels {
+public:
+    static constexpr double TOLERANCE = 1e-8;
+
+    // Structure-of-arrays copy of a candle series.
+    struct Series {
+        std::vector<double> high;
+        std::vector<double> low;
+        std::vector<double> close;
+        std::vector<double> volume;
+        std::vector<double> typical;    // (high + low + close) / 3
+
+        size_t size() const { return close.size(); }
+    };
+
+    static void extract(CandleSeriesView candles, Series& out);
+
+    static void sma(const double* close, size_t n, int period, double* out);
+    static void rsi(const double* close, size_t n, int period, double* out);
+    static void bollinger(const double* close, size_t n, int period, double multiplier,
+        double* upper, double* middle, double* lower);
+    static void stochastic(const double* high, const double* low, const double* close, size_t n,
+        int kPeriod, int dPeriod, double* k, double* d);
+    static void cci(const double* typical, size_t n, int period, double* out);
+    static void mfi(const double* typical, const double* volume, size_t n, int period, double* out);
+
+    static const char* instructionSet();
+
+    // Runs every kernel on the scalar lane; used to check the SIMD paths against it.
+    static void setScalarOnly(bool scalarOnly);
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "CandleChartManager.h"
+
+// On-disk layout: a fixed 64-byte header followed by raw MarketData records.
+// recordSize is stored so files written by a build with a different MarketData
+// layout are rejected instead of being silently misread.
+struct MappedSeriesHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t reserved;
+    uint64_t count;
+    uint64_t dataOffset;
+    char symbol[32];
+};
+
+static_assert(sizeof(MappedSeriesHeader) == 64, "MappedSeriesHeader must stay 64 bytes");
+
+class MappedCandleSeries {
+public:
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr size_t PREFETCH_WINDOW = 64 * 1024;
+
+    MappedCandleSeries();
+    ~MappedCandleSeries();
+
+    MappedCandleSeries(const MappedCandleSeries&) = delete;
+    MappedCandleSeries& operator=(const MappedCandleSeries&) = delete;
+
+    bool open(const std::string& filename);
+    void close();
+    bool isOpen() const { return m_view != nullptr; }
+
+    const MarketData* data() const { return m_candles; }
+    size_t size() const { return m_count; }
+    const std::string& getSymbol() const { return m_symbol; }
+    const std::string& getFilename() const { return m_filename; }
+
+    CandleSeriesView view(size_t count = SIZE_MAX) const;
+
+    void adviseSequential();
+    void prefetch(size_t start, size_t count);
+
+    static bool writeFile(const std::string& filename, const std::string& symbol, const std::vector<MarketData>& candles);
+
+private:
+    std::string m_filename;
+    std::string m_symbol;
+    const MarketData* m_candles;
+    size_t m_count;
+
+    void* m_view;
+    size_t m_viewSize;
+
+#ifdef _WIN32
+    void* m_fileHandle;
+    void* m_mappingHandle;
+#else
+    int m_fd;
+#endif
+};
@@ -37,10 +37,7 @@ private:
     std::string m_apiSecret;
     std::string m_baseUrl;
     long m_timeout;
-    CURL* m_curl;
     bool isDebugAPI;
-    
-    void initCurl();
 };
 
 }   
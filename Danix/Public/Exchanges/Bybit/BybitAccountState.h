@@ -0,0 +1,80 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <nlohmann/json.hpp>
+#include "BybitTypes.h"
+
+namespace Bybit {
+
+// Local mirror of the private account stream (order, execution, position, wallet).
+// Fed by BybitWebSocketManager's private connection; readers never touch the network.
+class BybitAccountState {
+public:
+    static BybitAccountState& getInstance();
+
+    void applyMessage(const nlohmann::json& message);
+    void setLive(bool live);
+    bool isLive() const { return m_live.load(); }
+    void clear();
+
+    // REST snapshot taken right after subscribing, so the mirror does not start empty.
+    // Stream updates newer than the snapshot (by seq / updatedTime) are kept.
+    void seed(const std::vector<PositionInfo>& positions, const std::vector<OpenOrder>& orders, uint64_t requestedAt);
+
+    // In hedge mode a symbol has a long (positionIdx 1) and a short (2) position; this
+    // returns the open one updated last, or the one-way position (0).
+    bool getPosition(const std::string& symbol, PositionInfo& position) const;
+    bool getPosition(const std::string& symbol, int positionIdx, PositionInfo& position) const;
+    std::vector<PositionInfo> getPositions() const;
+
+    bool getOrderByLinkId(const std::string& orderLinkId, OpenOrder& order) const;
+    std::vector<OpenOrder> getOpenOrders(const std::string& symbol = "") const;
+    std::vector<Execution> getExecutions(const std::string& symbol = "", size_t limit = 50) const;
+
+    std::vector<Balance> getBalances() const;
+    double getTotalEquity() const;
+    double getAvailableBalance() const;
+
+    // Blocks until the order with this orderLinkId reaches a final status
+    // (Filled, Cancelled, Rejected, Deactivated) or the timeout expires.
+    bool waitForOrderFinal(const std::string& orderLinkId, std::chrono::milliseconds timeout, OpenOrder& order);
+
+    static bool isFinalStatus(const std::string& status);
+
+private:
+    BybitAccountState();
+    BybitAccountState(const BybitAccountState&) = delete;
+    BybitAccountState& operator=(const BybitAccountState&) = delete;
+
+    void applyPositions(const nlohmann::json& data);
+    void applyOrders(const nlohmann::json& data);
+    void applyExecutions(const nlohmann::json& data);
+    void applyWallet(const nlohmann::json& data);
+    void storeOrder(const OpenOrder& order);
+
+    static constexpr size_t MAX_EXECUTIONS = 1000;
+    static constexpr size_t MAX_FINISHED_ORDERS = 500;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_orderCv;
+    std::atomic<bool> m_live;
+
+    std::map<std::pair<std::string, int>, PositionInfo> m_positions;   // (symbol, positionIdx) -> position
+    std::map<std::string, OpenOrder> m_orders;                  // orderId -> order
+    std::map<std::string, std::string> m_orderIdByLinkId;
+    std::deque<std::string> m_finishedOrders;
+    std::deque<Execution> m_executions;
+    std::vector<Balance> m_balances;
+    double m_totalEquity;
+    double m_availableBalance;
+};
+
+}
@@ -20,19 +20,28 @@ public:
         const std::string& symbol,
         double quantity,
         double price = 0.0,      
-        bool reduceOnly = false
+        bool reduceOnly = false,
+        const std::string& orderLinkId = ""
     );
     
     OrderResult openShort(
         const std::string& symbol,
         double quantity,
         double price = 0.0,
-        bool reduceOnly = false
+        bool reduceOnly = false,
+        const std::string& orderLinkId = ""
     );
     
     OrderResult closePosition(
         const std::string& symbol,
-        double quantity = 0.0       
+        double quantity = 0.0,
+        const std::string& orderLinkId = ""
+    );
+
+    OrderResult closePosition(
+        const PositionInfo& position,
+        double quantity = 0.0,
+        const std::string& orderLinkId = ""
     );
     
     bool setStopLoss(const std::string& symbol, double stopLoss, double quantity = 0.0);
@@ -43,7 +52,8 @@ public:
 
 
     
-    std::vector<PositionInfo> getAllPositions();
+    // Linear positions; without a symbol Bybit needs the settle coin (e.g. "USDT").
+    std::vector<PositionInfo> getAllPositions(const std::string& settleCoin = "");
     
     std::vector<Balance> getBalance();
 
@@ -79,7 +89,8 @@ private:
         OrderType orderType,
         double quantity,
         double price = 0.0,
-        bool reduceOnly = false
+        bool reduceOnly = false,
+        const std::string& orderLinkId = ""
     );
     
     OrderResult parseOrderResult(const std::string& response);
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <string>
+#include <map>
+#include <set>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <future>
+#include <functional>
+#include <condition_variable>
+#include "BybitTypes.h"
+
+namespace Bybit {
+
+enum class OrderAction {
+    OPEN_LONG,
+    OPEN_SHORT,
+    CLOSE_POSITION
+};
+
+struct OrderRequest {
+    std::string symbol;
+    OrderAction action;
+    double quantity;
+    double leverage;        // 0 - keep current leverage
+
+    OrderRequest()
+        : action(OrderAction::OPEN_LONG)
+        , quantity(0.0)
+        , leverage(0.0)
+    {}
+};
+
+struct OrderUpdate {
+    std::string clientOrderId;
+    std::string symbol;
+    OrderAction action;
+    OrderResult result;
+    PositionInfo position;
+    double fillPrice;
+    uint64_t timestamp;
+
+    OrderUpdate()
+        : action(OrderAction::OPEN_LONG)
+        , fillPrice(0.0)
+        , timestamp(0)
+    {}
+};
+
+struct OrderTicket {
+    std::string clientOrderId;
+    std::shared_future<OrderUpdate> result;
+};
+
+using OrderCallback = std::function<void(const OrderUpdate&)>;
+
+// Asynchronous order pipeline for the live margin nodes. submit() returns at once
+// with a client order ID (sent to Bybit as orderLinkId); the REST round-trips run
+// on a small worker pool. Orders for the same symbol execute strictly in submission
+// order, different symbols run in parallel. Callbacks are queued and run from
+// dispatchCompleted() on the caller's thread (the UI frame loop). When the private
+// websocket stream is live, fills and positions are read from BybitAccountState.
+class BybitOrderGateway {
+public:
+    static BybitOrderGateway& getInstance();
+
+    void setCredentials(const std::string& apiKey, const std::string& apiSecret, bool isTestnet);
+
+    OrderTicket submit(const OrderRequest& request, OrderCallback callback = nullptr);
+
+    size_t dispatchCompleted();
+
+    bool getCachedPosition(const std::string& symbol, PositionInfo& position) const;
+    void updateCachedPosition(const PositionInfo& position);
+    void invalidateLeverage(const std::string& symbol);
+
+    size_t pendingCount() const;
+
+    void shutdown();
+
+private:
+    BybitOrderGateway();
+    ~BybitOrderGateway();
+    BybitOrderGateway(const BybitOrderGateway&) = delete;
+    BybitOrderGateway& operator=(const BybitOrderGateway&) = delete;
+
+    struct Job {
+        std::string clientOrderId;
+        OrderRequest request;
+        OrderCallback callback;
+        std::shared_ptr<std::promise<OrderUpdate>> promise;
+    };
+
+    void startWorkers();
+    void workerLoop();
+    OrderUpdate execute(const Job& job);
+    std::string nextClientOrderId();
+
+    static constexpr size_t WORKER_COUNT = 4;
+    static constexpr int STREAM_FILL_TIMEOUT_MS = 3000;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::map<std::string, std::deque<Job>> m_pending;
+    std::deque<std::string> m_readySymbols;
+    std::set<std::string> m_scheduledSymbols;
+    std::vector<std::thread> m_workers;
+    bool m_running;
+    size_t m_pendingCount;
+
+    std::string m_apiKey;
+    std::string m_apiSecret;
+    bool m_isTestnet;
+
+    mutable std::mutex m_cacheMutex;
+    std::map<std::string, double> m_leverage;
+    std::map<std::string, PositionInfo> m_positions;
+
+    std::mutex m_completedMutex;
+    std::deque<std::pair<OrderCallback, OrderUpdate>> m_completed;
+
+    std::atomic<uint64_t> m_orderCounter;
+};
+
+}
@@ -89,10 +89,15 @@ public:
 
     const std::string& getCurrentSymbol() const { return m_symbol; }
     BybitCategory getCurrentCategory() const { return m_category; }
+    std::string getCurrentCategoryName() const { return categoryToString(m_category); }
     BybitInterval getCurrentInterval() const { return m_interval; }
 
     void onCandleReceived(const CandleData& candle);
 
+    // Fetches the closed candles the stream skipped over REST, replays them in order and
+    // then the stream messages held back meanwhile. Runs on a BybitWebSocketManager thread.
+    void runBackfill();
+
 private:
     std::vector<BybitCandle> fetchKlines(const std::string& symbol,
         BybitCategory category,
@@ -118,6 +123,13 @@ private:
 
     void addCandlesToDataManager(const std::vector<BybitCandle>& candles);
 
+    void deliverCandle(const BybitCandle& candle);
+
+    std::vector<BybitCandle> fetchMissingCandles(uint64_t lastConfirmed);
+
+    // Upper bound of one candle's length (a month counts as 31 days).
+    uint64_t intervalToMs(BybitInterval interval) const;
+
     static size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::string* userp);
 
 private:
@@ -133,11 +145,20 @@ private:
     std::atomic<bool> m_isLoading;
     std::atomic<bool> m_isStreaming;
 
-    CURL* m_curl;
+    // Gap detection: stream messages past the candle after m_lastConfirmedTime start a
+    // backfill and are deferred until it has replayed the missing range.
+    std::mutex m_streamMutex;
+    uint64_t m_lastConfirmedTime;
+    bool m_backfilling;
+    int64_t m_lastBackfillMs;
+    std::vector<BybitCandle> m_deferred;
 
     std::function<void(const BybitCandle&)> m_onNewCandle;
     std::function<void(const BybitCandle&)> m_onCandleUpdate;
     std::function<void(const std::string&)> m_onStatus;
 
+    static constexpr int BACKFILL_RETRY_SEC = 10;
+    static constexpr size_t MAX_BACKFILL_REQUESTS = 10;
+
     static constexpr const char* REST_API_URL = "https://api.bybit.com";
 };
\ No newline at end of file
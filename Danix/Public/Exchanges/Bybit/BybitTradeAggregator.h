@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include "BybitPriceCollector.h"
+
+struct TradeData;
+
+enum class TradeBarType {
+    TIME,           // size = seconds per bar, sub-minute allowed (5, 15, ...)
+    TICK,           // size = trades per bar
+    VOLUME,         // size = base-asset quantity per bar
+    DOLLAR          // size = quote value (price * quantity) per bar
+};
+
+struct TradeBarSpec {
+    TradeBarType type = TradeBarType::TIME;
+    double size = 5.0;
+};
+
+// Builds candles from the publicTrade stream of one symbol instead of kline topics, so
+// bars of any size cost no REST requests. Bars are reported through the same callbacks
+// as BybitPriceCollector: every change of the forming bar through the update callback,
+// and a finished bar through the new-candle callback right after its last update. The
+// first bar is also reported as new when it opens, so a data manager without history
+// has a forming candle to update.
+//
+// A time bar closes when the first trade of a later bar arrives; periods without trades
+// produce no bars. Trades missed while the stream was down are not recovered.
+class BybitTradeAggregator {
+public:
+    BybitTradeAggregator();
+    ~BybitTradeAggregator();
+
+    void setSymbol(const std::string& symbol, BybitCategory category = BybitCategory::SPOT);
+
+    void setBarSpec(const TradeBarSpec& spec);
+    TradeBarSpec getBarSpec() const;
+
+    bool startRealtimeStream();
+    void stopRealtimeStream();
+    bool isStreaming() const { return m_isStreaming.load(); }
+
+    BybitCandle getLastCandle() const;
+    double getCurrentPrice() const;
+    size_t getBarCount() const;
+
+    void setOnNewCandleCallback(std::function<void(const BybitCandle&)> callback);
+    void setOnCandleUpdateCallback(std::function<void(const BybitCandle&)> callback);
+    void setOnStatusCallback(std::function<void(const std::string&)> callback);
+
+    const std::string& getCurrentSymbol() const { return m_symbol; }
+    BybitCategory getCurrentCategory() const { return m_category; }
+
+    void onTradesReceived(const std::vector<TradeData>& trades);
+
+private:
+    struct Event {
+        BybitCandle candle;
+        bool isNew;
+    };
+
+    void openBar(const TradeData& trade, uint64_t start, std::vector<Event>& events);
+    void closeBar(std::vector<Event>& events);
+    bool isBarComplete() const;
+
+    std::string categoryToString(BybitCategory category) const;
+    void updateStatus(const std::string& status);
+
+private:
+    std::string m_symbol;
+    BybitCategory m_category;
+    TradeBarSpec m_spec;
+
+    BybitCandle m_bar;
+    bool m_hasBar;
+    size_t m_barTrades;
+    int m_barCount;
+    BybitCandle m_lastClosed;
+    mutable std::mutex m_mutex;
+
+    std::atomic<bool> m_isStreaming;
+
+    std::function<void(const BybitCandle&)> m_onNewCandle;
+    std::function<void(const BybitCandle&)> m_onCandleUpdate;
+    std::function<void(const std::string&)> m_onStatus;
+};
@@ -156,6 +156,7 @@ struct OpenOrder {
     bool reduceOnly;
     bool closeOnTrigger;
     std::string placeType;
+    int positionIdx;
     std::string createdTime;
     std::string updatedTime;
     
@@ -163,7 +164,7 @@ struct OpenOrder {
         : price(0.0), qty(0.0), cumExecQty(0.0), cumExecValue(0.0), cumExecFee(0.0)
         , avgPrice(0.0), leavesQty(0.0), leavesValue(0.0), triggerPrice(0.0)
         , takeProfit(0.0), stopLoss(0.0), triggerDirection(0)
-        , reduceOnly(false), closeOnTrigger(false)
+        , reduceOnly(false), closeOnTrigger(false), positionIdx(0)
     {}
 };
 
@@ -1,19 +1,24 @@
 #pragma once
 #include <string>
+#include <vector>
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <condition_variable>
 #include <websocketpp/config/asio_client.hpp>
 #include <websocketpp/client.hpp>
 #include <nlohmann/json.hpp>
+#include "WebSocketIoService.h"
 
 using json = nlohmann::json;
 
 typedef websocketpp::client<websocketpp::config::asio_tls_client> WebSocketClient;
-typedef websocketpp::lib::shared_ptr<websocketpp::lib::asio::ssl::context> ContextPtr;
 
-class BybitWebSocketClient {
+// Runs on the shared WebSocketIoService; callbacks arrive on its I/O threads.
+// Must be owned by a shared_ptr: the connection handlers hold the client weakly.
+class BybitWebSocketClient : public std::enable_shared_from_this<BybitWebSocketClient> {
 public:
     BybitWebSocketClient();
     ~BybitWebSocketClient();
@@ -22,39 +27,64 @@ public:
 
     void disconnect();
 
+    // Starts a close handshake without waiting for it; the close handler reports the end.
+    void close();
+
     bool subscribeToKline(const std::string& symbol, const std::string& interval);
 
     bool unsubscribe(const std::string& topic);
 
+    // Private stream: sends {"op":"auth"} signed with HMAC_SHA256("GET/realtime" + expires).
+    bool authenticate(const std::string& apiKey, const std::string& apiSecret);
+
+    bool subscribeTopics(const std::vector<std::string>& topics);
+    bool unsubscribeTopics(const std::vector<std::string>& topics);
+
+    bool ping();
+
     bool isConnected() const { return m_isConnected.load(); }
 
+    // steady_clock milliseconds of the last frame received (pongs included) or of the open.
+    int64_t getLastMessageTime() const { return m_lastMessageMs.load(); }
+
     void setOnMessageCallback(std::function<void(const std::string&)> callback);
     void setOnErrorCallback(std::function<void(const std::string&)> callback);
     void setOnConnectedCallback(std::function<void()> callback);
     void setOnDisconnectedCallback(std::function<void()> callback);
 
 private:
-    void onOpen(websocketpp::connection_hdl hdl);
-    void onClose(websocketpp::connection_hdl hdl);
-    void onFail(websocketpp::connection_hdl hdl);
-    void onMessage(websocketpp::connection_hdl hdl, WebSocketClient::message_ptr msg);
-
-    ContextPtr onTlsInit(websocketpp::connection_hdl hdl);
+    void onOpen(websocketpp::connection_hdl hdl, uint64_t generation);
+    void onClose(websocketpp::connection_hdl hdl, uint64_t generation);
+    void onFail(websocketpp::connection_hdl hdl, uint64_t generation);
+    void onMessage(websocketpp::connection_hdl hdl, WebSocketClient::message_ptr msg, uint64_t generation);
 
     bool sendMessage(const std::string& message);
 
-    void runEventLoop();
+    void setState(bool active);
 
 private:
+    static constexpr int CLOSE_TIMEOUT_SEC = 15;
+
     WebSocketClient m_client;
     websocketpp::connection_hdl m_hdl;
-    std::thread m_thread;
 
     std::atomic<bool> m_isConnected;
     std::atomic<bool> m_shouldStop;
+    std::atomic<int64_t> m_lastMessageMs;
 
     std::mutex m_mutex;
 
+    // True from connect() until the close or fail handler ran, or disconnect() gave up on it.
+    bool m_active = false;
+    std::mutex m_stateMutex;
+    std::condition_variable m_stateCv;
+
+    // Each connect() starts a generation and disconnect() retires it. Handlers of a retired
+    // connection, e.g. one still closing after CLOSE_TIMEOUT_SEC, return without touching
+    // the client's state or the owner's callbacks. Held while a handler runs.
+    std::atomic<uint64_t> m_generation{ 0 };
+    std::mutex m_callbackMutex;
+
     std::function<void(const std::string&)> m_onMessage;
     std::function<void(const std::string&)> m_onError;
     std::function<void()> m_onConnected;
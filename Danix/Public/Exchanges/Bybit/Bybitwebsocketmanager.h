@@ -4,20 +4,37 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <functional>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include "BybitWebSocketClient.h"
+#include "OrderBook.h"
 
 class BybitPriceCollector;
+class BybitTradeAggregator;
 
 struct Subscription {
     std::string symbol;            
     std::string interval;                
     std::string category;             
+    std::string channel = "kline";      // "kline", "publicTrade" or "orderbook.{depth}"
+
+    std::string getTopic() const {
+        if (channel == "kline") {
+            return "kline." + interval + "." + symbol;
+        }
+        return channel + "." + symbol;
+    }
 
     std::string getKey() const {
-        return category + ":" + symbol + "." + interval;
+        if (channel == "kline") {
+            return category + ":" + symbol + "." + interval;
+        }
+        return category + ":" + getTopic();
     }
 
     bool operator<(const Subscription& other) const {
@@ -43,11 +60,44 @@ struct CandleData {
     bool confirmed;
 };
 
-class WebSocketConnection {
+struct TradeData {
+    std::string symbol;
+    std::string category;
+    uint64_t timestamp;
+    double price;
+    double size;
+    bool buy;               // taker side
+};
+
+struct OrderBookUpdate {
+    std::string topic;
+    std::string category;
+    bool snapshot;
+    uint64_t updateId;
+    uint64_t timestamp;
+    std::vector<OrderBook::Level> bids;
+    std::vector<OrderBook::Level> asks;
+};
+
+// One public stream socket. connect() only starts the handshake; subscriptions added
+// before the socket is open are queued, and everything queued is sent in batched
+// subscribe/unsubscribe ops from the shared I/O threads once it is. A dropped socket is
+// reopened with exponential backoff and every subscription is sent again.
+class WebSocketConnection : public std::enable_shared_from_this<WebSocketConnection> {
 public:
     WebSocketConnection(const std::string& url, const std::string& category);
     ~WebSocketConnection();
 
+    bool connect();
+
+    // Unsubscribes everything and closes the socket; blocks up to the client's close
+    // timeout. Runs once, later calls and the destructor return at once.
+    void close();
+
+    // Heartbeat tick: pings, closes a socket that went silent and reconnects once the
+    // backoff delay has passed. Never blocks.
+    void maintain();
+
     bool addSubscription(const Subscription& sub);
 
     bool removeSubscription(const Subscription& sub);
@@ -59,6 +109,11 @@ public:
     std::string getCategory() const { return m_category; }
 
     void setOnCandleCallback(std::function<void(const CandleData&)> callback);
+    void setOnTradesCallback(std::function<void(const std::vector<TradeData>&)> callback);
+
+    // Returns false when the update did not fit the local book; the topic is then
+    // unsubscribed and subscribed again to get a fresh snapshot.
+    void setOnOrderBookCallback(std::function<bool(const OrderBookUpdate&)> callback);
 
 private:
     void onMessage(const std::string& message);
@@ -67,16 +122,49 @@ private:
     void onDisconnected();
 
     CandleData parseCandleFromJson(const json& data, const std::string& topic);
+    std::vector<TradeData> parseTradesFromJson(const json& data);
+    bool parseOrderBookFromJson(const json& message, OrderBookUpdate& update);
+
+    void resync(const std::string& topic);
+
+    // Called with m_mutex held.
+    void scheduleFlush();
+    void flushPending();
+    void sendInBatches(const std::vector<std::string>& topics, bool subscribe);
+
+    // Called with m_mutex held.
+    void scheduleReconnect();
 
 private:
-    std::unique_ptr<BybitWebSocketClient> m_client;
+    // Bybit accepts at most 10 args in one spot subscribe request; the other categories
+    // allow more, 10 keeps one limit for all of them.
+    static constexpr size_t MAX_TOPICS_PER_REQUEST = 10;
+    static constexpr int PING_INTERVAL_SEC = 20;
+    static constexpr int STALE_TIMEOUT_SEC = 45;        // no frame, not even a pong
+    static constexpr int64_t RECONNECT_BASE_MS = 1000;
+    static constexpr int64_t RECONNECT_MAX_MS = 60000;
+
+    std::shared_ptr<BybitWebSocketClient> m_client;
     std::set<Subscription> m_subscriptions;
     std::string m_url;
     std::string m_category;
     mutable std::mutex m_mutex;
     std::atomic<bool> m_isFullyConnected;
 
+    std::vector<std::string> m_pendingSubscribe;
+    std::vector<std::string> m_pendingUnsubscribe;
+    bool m_flushScheduled = false;
+
+    std::atomic<bool> m_closing;
+    std::mutex m_maintainMutex;         // held by maintain() and while close() sets m_closing
+    bool m_reconnectPending = false;
+    int m_reconnectAttempts = 0;
+    int64_t m_nextReconnectMs = 0;
+    int64_t m_lastPingMs = 0;
+
     std::function<void(const CandleData&)> m_onCandle;
+    std::function<void(const std::vector<TradeData>&)> m_onTrades;
+    std::function<bool(const OrderBookUpdate&)> m_onOrderBook;
     std::function<void()> m_onConnected;
 };
 
@@ -101,37 +189,129 @@ public:
 
     void unsubscribeAll(BybitPriceCollector* collector);
 
+    // publicTrade stream of one symbol; every message's trades go to the aggregator at once.
+    bool subscribeTrades(const std::string& symbol,
+        const std::string& category,
+        BybitTradeAggregator* aggregator);
+
+    void unsubscribeTrades(BybitTradeAggregator* aggregator);
+
+    // orderbook.{depth}.{symbol}; Bybit offers depths 1, 50, 200 and (derivatives) 500.
+    // Books are shared per topic and reference counted by subscribe/unsubscribe.
+    std::shared_ptr<const OrderBook> subscribeOrderBook(const std::string& symbol,
+        const std::string& category,
+        int depth);
+
+    void unsubscribeOrderBook(const std::string& symbol,
+        const std::string& category,
+        int depth);
+
     size_t getConnectionCount() const;
     size_t getTotalSubscriptions() const;
 
     void setMaxSubscriptionsPerConnection(size_t max);
     size_t getMaxSubscriptionsPerConnection() const { return m_maxSubscriptionsPerConnection; }
 
+    // Authenticated private stream (order, execution, position, wallet). Updates are
+    // mirrored into Bybit::BybitAccountState; the stream reconnects until stopped.
+    // Starting with new credentials does not wait for the old connection: the stream
+    // thread closes it and reconnects itself. Only stopping joins the thread.
+    void startPrivateStream(const std::string& apiKey, const std::string& apiSecret, bool isDemo);
+    void stopPrivateStream();
+    bool isPrivateStreamLive() const;
+
+    // Queues a REST backfill of the candles a collector missed; called by the collector
+    // from the dispatch path when its stream skipped ahead.
+    bool requestBackfill(BybitPriceCollector* collector);
+
 private:
     BybitWebSocketManager();
     ~BybitWebSocketManager();
 
     WebSocketConnection* findOrCreateConnection(const std::string& category);
 
-    void cleanupEmptyConnections();
+    // Called with m_mutex held. Returns the removed connections, which the caller closes
+    // after releasing it.
+    std::vector<std::shared_ptr<WebSocketConnection>> cleanupEmptyConnections();
 
     std::string getWebSocketUrl(const std::string& category) const;
 
     void onCandleReceived(const CandleData& candle);
+    void onTradesReceived(const std::vector<TradeData>& trades);
+    bool onOrderBookReceived(const OrderBookUpdate& update);
+
+    void startMaintenance();
+    void stopMaintenance();
+    void heartbeatLoop();
+    void backfillLoop();
+
+    // Drops a queued backfill and waits out one in progress.
+    void cancelBackfill(BybitPriceCollector* collector);
+
+    void privateStreamLoop();
+    void onPrivateMessage(const std::string& message);
+    // Loads open positions and orders over REST into BybitAccountState.
+    bool seedAccountState(const std::string& apiKey, const std::string& apiSecret, bool isDemo);
 
 private:
-    std::map<std::string, std::vector<std::unique_ptr<WebSocketConnection>>> m_connections;
+    std::map<std::string, std::vector<std::shared_ptr<WebSocketConnection>>> m_connections;
 
     std::map<std::string, std::set<BybitPriceCollector*>> m_subscribers;
 
     std::map<BybitPriceCollector*, std::set<std::string>> m_collectorSubscriptions;
 
+    std::map<std::string, std::set<BybitTradeAggregator*>> m_tradeSubscribers;
+
+    std::map<BybitTradeAggregator*, std::set<Subscription>> m_aggregatorSubscriptions;
+
+    struct OrderBookEntry {
+        std::shared_ptr<OrderBook> book;
+        Subscription sub;
+        int refs = 0;
+    };
+    std::map<std::string, OrderBookEntry> m_orderBooks;
+
     mutable std::mutex m_mutex;
 
+    // Guards m_subscribers, m_tradeSubscribers and m_orderBooks for dispatch on the shared I/O threads. Writers hold
+    // m_mutex too, so dispatch never queues behind a connection coming up, while
+    // unsubscribing still waits for a callback already in flight.
+    std::mutex m_dispatchMutex;
+
     size_t m_maxSubscriptionsPerConnection;
 
+    std::thread m_heartbeatThread;
+    std::mutex m_heartbeatMutex;
+    std::condition_variable m_heartbeatCv;
+    std::atomic<bool> m_maintenanceRunning;
+
+    std::vector<std::thread> m_backfillThreads;
+    std::deque<BybitPriceCollector*> m_backfillQueue;
+    std::set<BybitPriceCollector*> m_backfillActive;
+    std::mutex m_backfillMutex;
+    std::condition_variable m_backfillCv;
+
+    static constexpr int HEARTBEAT_TICK_SEC = 1;
+    static constexpr size_t BACKFILL_THREADS = 4;
+
+    std::thread m_privateThread;
+    std::mutex m_privateMutex;
+    std::condition_variable m_privateCv;
+    std::atomic<bool> m_privateRunning;
+    std::atomic<uint64_t> m_privateGeneration;   // bumped when the credentials change
+    std::atomic<bool> m_privateAuthed;
+    std::atomic<bool> m_privateAuthFailed;
+    std::string m_privateApiKey;
+    std::string m_privateApiSecret;
+    bool m_privateDemo;
+
+    static constexpr int PRIVATE_PING_INTERVAL_SEC = 20;
+    static constexpr int PRIVATE_RECONNECT_DELAY_SEC = 5;
+
     static constexpr const char* WS_SPOT_URL = "wss://stream.bybit.com/v5/public/spot";
     static constexpr const char* WS_LINEAR_URL = "wss://stream.bybit.com/v5/public/linear";
     static constexpr const char* WS_INVERSE_URL = "wss://stream.bybit.com/v5/public/inverse";
     static constexpr const char* WS_OPTION_URL = "wss://stream.bybit.com/v5/public/option";
+    static constexpr const char* WS_PRIVATE_URL = "wss://stream.bybit.com/v5/private";
+    static constexpr const char* WS_PRIVATE_DEMO_URL = "wss://stream-demo.bybit.com/v5/private";
 };
\ No newline at end of file
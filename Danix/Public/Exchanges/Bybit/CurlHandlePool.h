@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <curl/curl.h>
+
+namespace Bybit {
+
+class CurlHandlePool;
+
+// RAII lease of a pooled easy handle. Returned to the pool on destruction so the
+// underlying keep-alive connection stays warm for the next request.
+class PooledCurlHandle {
+public:
+    PooledCurlHandle() : m_pool(nullptr), m_handle(nullptr) {}
+    PooledCurlHandle(CurlHandlePool* pool, CURL* handle) : m_pool(pool), m_handle(handle) {}
+    ~PooledCurlHandle();
+
+    PooledCurlHandle(const PooledCurlHandle&) = delete;
+    PooledCurlHandle& operator=(const PooledCurlHandle&) = delete;
+    PooledCurlHandle(PooledCurlHandle&& other) noexcept;
+    PooledCurlHandle& operator=(PooledCurlHandle&& other) noexcept;
+
+    CURL* get() const { return m_handle; }
+    explicit operator bool() const { return m_handle != nullptr; }
+
+private:
+    CurlHandlePool* m_pool;
+    CURL* m_handle;
+};
+
+// Process-wide pool of curl easy handles. All handles are attached to one share
+// handle, so TCP connections, TLS sessions and DNS results are reused across every
+// REST client (BybitAPI and derived classes, BybitPriceCollector).
+class CurlHandlePool {
+public:
+    static CurlHandlePool& getInstance();
+
+    PooledCurlHandle acquire();
+
+    // Opens keep-alive connections to baseUrl in the background so the first
+    // order does not pay the TCP+TLS handshake. Each base URL is warmed once.
+    void prewarm(const std::string& baseUrl, size_t connections = 2);
+
+    size_t idleCount() const;
+
+private:
+    CurlHandlePool();
+    ~CurlHandlePool();
+    CurlHandlePool(const CurlHandlePool&) = delete;
+    CurlHandlePool& operator=(const CurlHandlePool&) = delete;
+
+    friend class PooledCurlHandle;
+    void release(CURL* handle);
+    CURL* createHandle();
+    void applyDefaults(CURL* handle);
+
+    static void lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void unlockShare(CURL* handle, curl_lock_data data, void* userptr);
+
+    static constexpr size_t MAX_IDLE_HANDLES = 16;
+
+    CURLSH* m_share;
+    std::mutex m_shareLocks[CURL_LOCK_DATA_LAST];
+
+    mutable std::mutex m_mutex;
+    std::vector<CURL*> m_idle;
+    std::set<std::string> m_prewarmed;
+    std::vector<std::thread> m_prewarmThreads;
+};
+
+}
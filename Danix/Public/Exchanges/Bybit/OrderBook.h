@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+// Local copy of one orderbook.{depth}.{symbol} stream. Each side is a flat array sorted
+// so that the best level is the last element: the deltas that dominate the stream touch
+// levels near the top, so inserts and erases move only a few elements, and the best
+// bid/ask is read in O(1).
+//
+// Bybit sends no checksum; consistency is checked through the update id, which must grow
+// by one per delta, and by rejecting a crossed book. A rejected update leaves the book
+// invalid until the next snapshot.
+class OrderBook {
+public:
+    struct Level {
+        double price;
+        double size;
+    };
+
+    enum class Side { BID, ASK };
+
+    struct Top {
+        double bid = 0.0;
+        double bidSize = 0.0;
+        double ask = 0.0;
+        double askSize = 0.0;
+        uint64_t updateId = 0;
+        uint64_t timestamp = 0;
+        bool valid = false;
+    };
+
+    explicit OrderBook(size_t depth);
+
+    // Writer side, called from websocket dispatch. Levels with size 0 are removed.
+    bool applySnapshot(const std::vector<Level>& bids, const std::vector<Level>& asks,
+        uint64_t updateId, uint64_t timestamp);
+    bool applyDelta(const std::vector<Level>& bids, const std::vector<Level>& asks,
+        uint64_t updateId, uint64_t timestamp);
+    void invalidate();
+
+    Top getTop() const;
+    double getMid() const;
+    double getSpread() const;
+
+    // Summed size of the first `levels` levels of one side.
+    double getDepth(Side side, size_t levels) const;
+
+    // index 0 = best level.
+    bool getLevel(Side side, size_t index, Level& level) const;
+
+    size_t getLevelCount(Side side) const;
+    size_t getDepthLimit() const { return m_depth; }
+    bool isValid() const;
+
+private:
+    // Bids are stored ascending and asks descending, so both end with the best price.
+    static void applyLevels(std::vector<Level>& levels, const std::vector<Level>& updates, bool ascending);
+    void trim(std::vector<Level>& levels) const;
+    bool isCrossed() const;
+
+    mutable std::mutex m_mutex;
+    std::vector<Level> m_bids;
+    std::vector<Level> m_asks;
+    size_t m_depth;
+    uint64_t m_updateId;
+    uint64_t m_timestamp;
+    bool m_valid;
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <websocketpp/config/asio_client.hpp>
+
+typedef websocketpp::lib::asio::io_service IoService;
+typedef websocketpp::lib::shared_ptr<websocketpp::lib::asio::ssl::context> ContextPtr;
+
+// One asio io_service shared by every websocket connection, served by a fixed set of
+// I/O threads ([network] websocket_io_threads, default 2). Each connection runs its
+// handlers on its own strand, so adding subscriptions or connections never adds threads.
+// The TLS client context is built once and reused by every handshake.
+class WebSocketIoService {
+public:
+    static WebSocketIoService& getInstance();
+
+    WebSocketIoService(const WebSocketIoService&) = delete;
+    WebSocketIoService& operator=(const WebSocketIoService&) = delete;
+
+    // Starts the I/O threads on first use.
+    IoService& getIoService();
+    ContextPtr getTlsContext();
+
+    // Takes effect only before the first connection.
+    void setThreadCount(size_t count);
+    size_t getThreadCount() const;
+
+    void shutdown();
+
+    static constexpr size_t DEFAULT_THREADS = 2;
+
+private:
+    WebSocketIoService();
+    ~WebSocketIoService();
+
+    void start();
+    void run();
+
+    IoService m_ioService;
+    std::unique_ptr<IoService::work> m_work;
+    std::vector<std::thread> m_threads;
+    ContextPtr m_tlsContext;
+    size_t m_threadCount;
+    bool m_started;
+    bool m_stopped;
+    mutable std::mutex m_mutex;
+};
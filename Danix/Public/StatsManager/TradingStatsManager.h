@@ -140,6 +140,8 @@ struct Trade {
 };
 
 class TradingStatsManager {
+    friend class StrategySnapshot;
+    friend class ParallelBacktestStitcher;
 private:
     std::vector<Order> allOrders;
     std::vector<Position> allPositions;
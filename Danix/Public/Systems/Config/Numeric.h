@@ -0,0 +1,13 @@
+#pragma once
+
+// Floating type for candle prices, DOUBLE pins, variables and indicator nodes.
+// double by default, so storage is 8 bytes and the math vectorises on every target.
+// Define DANIX_LONG_DOUBLE_MATH to build with long double instead (80-bit x87 on
+// GCC/Clang x86-64, identical to double on MSVC).
+#ifdef DANIX_LONG_DOUBLE_MATH
+using Real = long double;
+#define DANIX_REAL_NAME "long double"
+#else
+using Real = double;
+#define DANIX_REAL_NAME "double"
+#endif
@@ -3,51 +3,65 @@
 #include <sstream>
 #include <string>
 #include <iomanip>
+#include <cstdint>
 
 class GUIDGenerator {
 public:
+    // While a scope is alive on this thread generate() returns an empty string. Loaders that
+    // overwrite every pin GUID right after constructing a node use it to skip the random work.
+    class DeferScope {
+    public:
+        DeferScope() { ++deferred(); }
+        ~DeferScope() { --deferred(); }
+        DeferScope(const DeferScope&) = delete;
+        DeferScope& operator=(const DeferScope&) = delete;
+    };
+
     static std::string generate() {
-        return getInstance().generateImpl();
-    }
+        if (deferred() > 0) return std::string();
 
-    static std::string generateSimple() {
-        return getInstance().generateSimpleImpl();
-    }
+        std::mt19937_64& gen = engine();
+        uint64_t bits[2] = { gen(), gen() };
 
-private:
-    static GUIDGenerator& getInstance() {
-        static GUIDGenerator instance;
-        return instance;
+        // 8-4-4-4-12 hex layout, 32 random nibbles.
+        std::string guid(36, '-');
+        int nibble = 0;
+        for (int i = 0; i < 36; i++) {
+            if (i == 8 || i == 13 || i == 18 || i == 23) continue;
+            guid[i] = hexDigit(bits[nibble / 16] >> ((nibble % 16) * 4));
+            ++nibble;
+        }
+        return guid;
     }
 
-    std::random_device rd;
-    std::mt19937 gen;
-    std::uniform_int_distribution<> dis;
-
-    GUIDGenerator() : gen(rd()), dis(0, 15) {}
-
-    std::string generateImpl() {
-        std::stringstream ss;
-        ss << std::hex;
+    static std::string generateSimple() {
+        uint64_t bits = engine()();
 
-        for (int i = 0; i < 32; i++) {
-            ss << dis(gen);
-            if (i == 7 || i == 11 || i == 15 || i == 19) {
-                ss << "-";
-            }
+        std::string guid(16, '0');
+        for (int i = 0; i < 16; i++) {
+            guid[i] = hexDigit(bits >> (i * 4));
         }
+        return guid;
+    }
 
-        return ss.str();
+private:
+    static int& deferred() {
+        thread_local int depth = 0;
+        return depth;
     }
 
-    std::string generateSimpleImpl() {
-        std::stringstream ss;
-        ss << std::hex;
+    // One engine per thread: strategy instances are built on worker threads.
+    static std::mt19937_64& engine() {
+        thread_local std::mt19937_64 gen(seed());
+        return gen;
+    }
 
-        for (int i = 0; i < 16; i++) {
-            ss << dis(gen);
-        }
+    static uint64_t seed() {
+        std::random_device rd;
+        return ((uint64_t)rd() << 32) ^ (uint64_t)rd();
+    }
 
-        return ss.str();
+    static char hexDigit(uint64_t value) {
+        return "0123456789abcdef"[value & 0xF];
     }
-};
\ No newline at end of file
+};
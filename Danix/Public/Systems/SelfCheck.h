@@ -0,0 +1,55 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// Runnable performance and accuracy checks for the targets set on the hot paths.
+// `Danix --self-check` runs all of them on synthetic data and exits with 1 if any
+// failed; each result reports the measured value next to the target.
+class SelfCheck {
+public:
+    struct Result {
+        std::string name;
+        bool passed = false;
+        std::string detail;
+    };
+
+    static std::vector<Result> runAll();
+
+    // Prints every result and returns the process exit code.
+    static int run();
+
+    // CSV import throughput against IMPORT_TARGET_MBS, plus a round-trip of the values.
+    static Result csvImport();
+
+    // Loading a GRAPH_NODES / GRAPH_LINKS blueprint from JSON against GRAPH_LOAD_TARGET_MS.
+    static Result graphLoad();
+
+    // Binary blueprint load against JSON load (text parse included) of the same graph.
+    static Result binaryLoad();
+
+    // The indicator nodes reading IndicatorBatch columns (SIMD lane, then scalar lane)
+    // against the same nodes' per-candle execute() path, candle by candle as in a backtest,
+    // within IndicatorKernels::TOLERANCE relative to max(1, |value|).
+    static Result indicatorSimd();
+
+    // The indicator nodes' per-candle path against the same formulas in long double, plus a
+    // BacktestSession of PRECISION_BLUEPRINT. Both are saved under PRECISION_DIR per Real
+    // type; once the other build (DANIX_LONG_DOUBLE_MATH on or off) has run the check too,
+    // the two builds are compared. Everything within IndicatorKernels::TOLERANCE.
+    static Result realPrecision();
+
+    static constexpr size_t IMPORT_ROWS = 2000000;
+    static constexpr double IMPORT_TARGET_MBS = 1024.0;
+
+    static constexpr size_t GRAPH_NODES = 2000;
+    static constexpr size_t GRAPH_LINKS = 5000;
+    static constexpr double GRAPH_LOAD_TARGET_MS = 100.0;
+    static constexpr double BINARY_SPEEDUP_TARGET = 10.0;
+
+    static constexpr size_t INDICATOR_CANDLES = 200000;
+
+    static constexpr const char* PRECISION_BLUEPRINT = "Data/Example #3.json";
+    static constexpr const char* PRECISION_DIR = "Data/SelfCheck";
+    static constexpr size_t PRECISION_SAMPLE_STEP = 97;
+    static constexpr size_t PRECISION_BACKTEST_CANDLES = 50000;
+};
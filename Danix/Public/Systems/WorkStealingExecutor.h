@@ -0,0 +1,105 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+
+// Work-stealing pool for runtime strategy evaluation. Work is posted to a Strand
+// (one per symbol): tasks of a strand run one at a time in posting order, while
+// different strands spread over all workers. Each worker keeps its own deque of
+// ready strands, takes newest first and steals the oldest from other workers when
+// idle. Timed tasks record origin-to-completion latency (candle to decision).
+class WorkStealingExecutor {
+public:
+    using Task = std::function<void()>;
+    using Clock = std::chrono::steady_clock;
+
+    class Strand {
+    public:
+        const std::string& getName() const { return name; }
+        size_t pending() const;
+
+    private:
+        friend class WorkStealingExecutor;
+
+        struct Item {
+            Task task;
+            Clock::time_point origin;
+            bool timed;
+        };
+
+        std::string name;
+        mutable std::mutex mutex;
+        std::condition_variable idleCv;
+        std::deque<Item> queue;
+        bool scheduled = false;         // in a worker deque or running
+    };
+
+    struct LatencyStats {
+        uint64_t samples = 0;           // total timed tasks since reset
+        double p50Us = 0.0;             // percentiles over the last LATENCY_WINDOW samples
+        double p99Us = 0.0;
+        double maxUs = 0.0;
+    };
+
+    static WorkStealingExecutor& getInstance();
+
+    std::shared_ptr<Strand> createStrand(const std::string& name);
+
+    void post(const std::shared_ptr<Strand>& strand, Task task);
+    void post(const std::shared_ptr<Strand>& strand, Task task, Clock::time_point origin);
+
+    // Blocks until the strand has nothing queued or running. Not for use from the strand's own tasks.
+    void waitIdle(const std::shared_ptr<Strand>& strand);
+
+    LatencyStats getLatencyStats() const;
+    void resetLatencyStats();
+
+    size_t getWorkerCount() const { return workers.size(); }
+    uint64_t getStealCount() const { return steals.load(); }
+
+    void shutdown();
+
+    static constexpr size_t MAX_TASKS_PER_TURN = 8;
+    static constexpr size_t LATENCY_WINDOW = 8192;
+
+private:
+    WorkStealingExecutor();
+    ~WorkStealingExecutor();
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::shared_ptr<Strand>> strands;
+    };
+
+    void enqueue(const std::shared_ptr<Strand>& strand, Strand::Item item);
+    void schedule(std::shared_ptr<Strand> strand, bool yielded);
+    std::shared_ptr<Strand> popLocal(size_t index);
+    std::shared_ptr<Strand> steal(size_t index);
+    void runStrand(const std::shared_ptr<Strand>& strand);
+    void workerLoop(size_t index);
+    void recordLatency(Clock::time_point origin);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCv;
+    std::atomic<size_t> queued{ 0 };
+    std::atomic<size_t> nextQueue{ 0 };
+    std::atomic<uint64_t> steals{ 0 };
+    std::atomic<bool> stopping{ false };
+
+    mutable std::mutex latencyMutex;
+    std::vector<uint32_t> latencyUs;    // ring buffer
+    uint64_t latencySamples = 0;
+    uint32_t latencyMaxUs = 0;
+};
@@ -4,6 +4,13 @@
 #include <cstdio>
 #include <cstring>
 #include <cctype>
+#include <memory>
+#include <atomic>
+#include <future>
+#include "../../../Blueprints/RobustnessAnalysis.h"
+#include "../../../Blueprints/ParallelBacktest.h"
+#include "../../../StatsManager/TradingStatsManager.h"
+#include "../../../Systems/WorkStealingExecutor.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -14,6 +21,9 @@
 #endif
 
 class CandlestickDataManager;
+class StrategyHost;
+class BacktestSession;
+class MappedCandleSeries;
 
 class BottomPanel {
 private:
@@ -26,11 +36,63 @@ private:
     int activeTab;       
     bool showStrategyPopup;
 
+    std::unique_ptr<BacktestSession> backtestSession;
+    bool autoContinueBacktest;
+    // Candles are appended on the tab's strategy strand, so the session runs there too.
+    std::shared_ptr<WorkStealingExecutor::Strand> strategyStrand;
+    std::atomic<bool> resumeQueued;
+
+    int shardCount;             // ParallelBacktest time shards
+    int shardWarmup;            // candles evaluated before each shard
+    bool shardVerify;           // also run serially and compare
+    std::string shardReport;
+
+    // The series a background run evaluates: the mapped file itself, shared so the mapping
+    // outlives a detach, or else a copy of the in-memory candles.
+    struct SeriesSource {
+        std::shared_ptr<const MappedCandleSeries> mapped;
+        std::vector<MarketData> candles;
+
+        CandleSeriesView view() const;
+    };
+
+    // Runs off the UI thread; the tab polls it every frame.
+    struct ShardedRun {
+        ParallelBacktest::Report report;
+        TradingStatsManager stats;
+    };
+    std::future<ShardedRun> shardedRun;
+
+    RobustnessAnalysis::WalkForwardSettings walkForwardSettings;
+    RobustnessAnalysis::WalkForwardReport walkForwardReport;
+    std::future<RobustnessAnalysis::WalkForwardReport> walkForwardRun;
+    RobustnessAnalysis::MonteCarloSettings monteCarloSettings;
+    RobustnessAnalysis::MonteCarloReport monteCarloReport;
+    std::future<RobustnessAnalysis::MonteCarloReport> monteCarloRun;
+
+    std::unique_ptr<StrategyHost> strategyHost;
+    std::future<void> hostStop;     // stop() joins the history loader and drains the strands
+    char hostSymbols[256];
+    int hostBarType;            // 0 = klines, otherwise TradeBarType + 1
+    float hostBarSize;
+    bool hostOrderBook;         // subscribe orderbook.50 for the order book nodes
+    bool hostSnapshots;         // save/restore StrategySnapshot files per symbol
+    std::string attachedSymbol;
+
     void scanStrategyFiles();
     void renderPerformanceTab();
     void renderRuntimePerformanceTab();
     void renderSettingsTab();
+    void renderRobustnessTab();
     void renderStrategySelectionPopup();
+    void renderStrategyHostSection();
+    void resumeBacktest();
+    void onStrategyStrand(WorkStealingExecutor::Task task, bool wait);
+    SeriesSource captureSeries();
+    void startShardedRun();
+    void pollShardedRun();
+    void startWalkForward();
+    void startMonteCarlo();
 
     bool fileExists(const std::string& filepath);
     bool hasJsonExtension(const std::string& filename);
@@ -40,6 +102,7 @@ public:
     ~BottomPanel();
 
     void render();
+    void setStrategyStrand(std::shared_ptr<WorkStealingExecutor::Strand> strand) { strategyStrand = std::move(strand); }
     void setVisible(bool visible) { isVisible = visible; }
     bool getVisible() const { return isVisible; }
     void refreshStrategyList();
@@ -6,6 +6,7 @@
 #include "BottomPanel/MainMenuBottomPanel.h"
 #include "../../../Public/StatsManager/TradingStatsManager.h"
 #include "../../Exchanges/Bybit/BybitPriceCollector.h"
+#include "../../Systems/WorkStealingExecutor.h"
 
 enum CEX
 {
@@ -26,16 +27,24 @@ private:
     std::vector<std::string> log_messages;
 
     BybitPriceCollector bybit_priceCollector;
+    std::shared_ptr<WorkStealingExecutor::Strand> strategyStrand;
     char tokenInput[128] = "";
+    char csvPathInput[260] = "";
     int selectedBlockchain = 0;
     int selectedTimeframe = 0;
     std::string statusMessage;
+    std::string orderBookSymbol;
+    std::string orderBookCategory;
+
+    static constexpr int ORDER_BOOK_DEPTH = 50;
 
     bool auto_scroll;
     void generateTestData(int count = 50);
     void addRandomCandle();
+    void setOrderBookSymbol(const std::string& symbol);
 public:
     MainChartTab(const std::string& name, int id);
+    ~MainChartTab();
     virtual void Render();
     virtual void AddLogMessage(const std::string& message);
     virtual void LightUpdate();